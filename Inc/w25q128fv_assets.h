@@ -0,0 +1,160 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's read-only asset pack reader Header file.
+ *
+ * @defgroup w25q128fv_assets W25Q128FV Asset Pack module
+ * @{
+ *
+ * @brief   This module finds, by name, the read-only assets (e.g., fonts, images and audio) of an asset pack that was
+ *          built on the host via the @c Tools/w25q128fv_asset_pack.py tool and then written into the W25Q128FV Flash
+ *          Memory Device, such that each asset is resolved with a single Fast Read of its directory entry and then read
+ *          with a single Fast Read of its payload, unless it is compressed.
+ *
+ * @details The directory of the asset pack is indexed by a minimal perfect hash that the host tool builds via the
+ *          hash-and-displace method: every name is first hashed into one of the buckets of the pack, and each bucket
+ *          holds the seed with which all of its names are hashed again into distinct entries of the directory, which
+ *          has exactly one entry per asset. Since @ref w25q128fv_assets_mount keeps the seeds in RAM, finding an asset
+ *          only requires reading the one directory entry that its name hashes to and comparing the name stored there.
+ * @details Assets may also be stored compressed, which the host tool does for every asset that gets smaller that way,
+ *          in which case they are split into blocks of @ref W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES bytes that are
+ *          compressed independently of each other in the LZ4 block format. Therefore, any range of a compressed asset
+ *          can be read via @ref w25q128fv_assets_read by only decompressing the blocks that it covers. Their compressed
+ *          data is received via @ref w25q128fv_stream_read , such that each chunk is decompressed while the next one is
+ *          being received via DMA, and so the bytes of the asset are obtained faster than the W25Q128FV Device could
+ *          transfer them uncompressed whenever the data is compressible enough.
+ * @details The asset pack is made of the following parts, where every field is little endian and every offset is
+ *          relative to the start of the asset pack:
+ *          <ol>
+ *              <li>
+ *                  A header of @ref W25Q128FV_ASSETS_HEADER_SIZE_IN_BYTES bytes made of the magic number
+ *                  @ref W25Q128FV_ASSETS_MAGIC , the CRC-32 of the rest of the header and of the seeds, the number of
+ *                  assets, the number of buckets, the offset of the directory, the alignment of the payloads, the size
+ *                  in bytes of the whole asset pack and a reserved word, all of them as uint32_t values.
+ *              </li>
+ *              <li>The uint16_t seed of each bucket, right after the header.</li>
+ *              <li>
+ *                  The directory, whose entries of @ref W25Q128FV_ASSETS_ENTRY_SIZE_IN_BYTES bytes are made of the name
+ *                  of the asset padded with zeros up to @ref W25Q128FV_ASSETS_MAX_NAME_SIZE_IN_BYTES bytes, the offset
+ *                  of its payload, its size in bytes, the CRC-32 of its data and its flags (e.g.,
+ *                  @ref W25Q128FV_ASSETS_FLAG_COMPRESSED ), where the size and the CRC-32 are those of the uncompressed
+ *                  data of the asset.
+ *              </li>
+ *              <li>
+ *                  The payloads, each of them starting at a multiple of the alignment of the asset pack. The payload of a
+ *                  compressed asset starts with a table of one uint32_t offset per block plus one, relative to the
+ *                  payload, where each block spans from its offset up to the next one, followed by the blocks. A block
+ *                  whose compressed size equals its uncompressed size is stored as it is.
+ *              </li>
+ *          </ol>
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_ASSETS_H
+#define W25Q128FV_ASSETS_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_ASSETS_MAX_BUCKETS
+#define W25Q128FV_ASSETS_MAX_BUCKETS                (256)           /**< @brief Maximum number of buckets of the asset packs that can be mounted, whose seeds are kept in RAM. */
+#endif
+#ifndef W25Q128FV_ASSETS_BLOCK_TABLE_BATCH_SIZE
+#define W25Q128FV_ASSETS_BLOCK_TABLE_BATCH_SIZE     (16)            /**< @brief Maximum number of blocks of a compressed asset whose offsets are read at once, each batch being then read with a single @ref w25q128fv_stream_read call. */
+#endif
+#define W25Q128FV_ASSETS_MAGIC                      (0x4B504157)    /**< @brief Value that identifies an asset pack (i.e., "WAPK" in little endian). */
+#define W25Q128FV_ASSETS_HEADER_SIZE_IN_BYTES       (32)            /**< @brief Size in bytes of the header of an asset pack. */
+#define W25Q128FV_ASSETS_ENTRY_SIZE_IN_BYTES        (64)            /**< @brief Size in bytes of each entry of the directory of an asset pack. */
+#define W25Q128FV_ASSETS_MAX_NAME_SIZE_IN_BYTES     (48)            /**< @brief Size in bytes of the name field of each entry of the directory, which holds names of up to 47 characters plus their null terminator. */
+#define W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES        (4096)          /**< @brief Uncompressed size in bytes of each block of a compressed asset, except for its last block, which may be smaller. */
+#define W25Q128FV_ASSETS_FLAG_COMPRESSED            (0x00000001)    /**< @brief Flag of the directory entries of the assets that are stored compressed. */
+
+/**@brief	Asset information structure.
+ */
+typedef struct {
+    uint32_t address;       //!< W25Q128FV Device 24-bit Flash Memory Address at which the payload of the asset starts.
+    uint32_t size_in_bytes; //!< Size in bytes of the uncompressed data of the asset.
+    uint32_t crc32;         //!< CRC-32 of the uncompressed data of the asset.
+    uint8_t is_compressed;  //!< Flag indicating whether the asset is stored compressed (i.e., 1) or not (i.e., 0).
+} W25Q128FV_asset_t;
+
+/**@brief   Mounts the asset pack stored at a given address of the W25Q128FV Device, whose header and seeds are read and
+ *          kept in RAM.
+ *
+ * @param address   W25Q128FV Device 24-bit Flash Memory Address at which the asset pack starts.
+ *
+ * @retval	W25Q128FV_EC_OK     if the asset pack was successfully mounted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if there is no asset pack at \p address .
+ * @retval  W25Q128FV_EC_ERR    if the asset pack is corrupted, if it has more than @ref W25Q128FV_ASSETS_MAX_BUCKETS
+ *                              buckets, if it exceeds the existing W25Q128FV Flash Memory locations or if anything else
+ *                              went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_assets_mount(uint32_t address);
+
+/**@brief   Finds an asset of the mounted asset pack by its name.
+ *
+ * @param[in] name      Pointer to the Memory Location Address of the null terminated name of the asset.
+ * @param[out] asset    Pointer to the Memory Location Address where this function will store the information of the
+ *                      asset.
+ *
+ * @retval	W25Q128FV_EC_OK     if the asset was found.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the asset pack has no asset with that name.
+ * @retval  W25Q128FV_EC_ERR    if no asset pack is mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_assets_find(const char *name, W25Q128FV_asset_t *asset);
+
+/**@brief   Reads a range of the uncompressed data of an asset of the mounted asset pack.
+ *
+ * @details If the asset is compressed, only the blocks that cover the range are read and decompressed, while any of
+ *          them that is only partially covered is decompressed into a RAM buffer from which the requested bytes are
+ *          copied.
+ *
+ * @param[in] asset Pointer to the Memory Location Address of the information of the asset, as obtained via
+ *                  @ref w25q128fv_assets_find .
+ * @param offset    Offset in bytes within the uncompressed data of the asset from which it is desired to start reading.
+ * @param[out] dst  Pointer to the Memory Location Address where this function will store the data.
+ * @param size      Size in bytes of the data to be read.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if no asset pack is mounted, if the range exceeds the data of the asset, if its
+ *                              compressed data is corrupted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_assets_read(const W25Q128FV_asset_t *asset, uint32_t offset, uint8_t *dst, uint32_t size);
+
+/**@brief   Finds an asset of the mounted asset pack by its name and reads all of its uncompressed data.
+ *
+ * @note    Assets that do not fit into RAM should rather be found via @ref w25q128fv_assets_find and then read in
+ *          ranges via @ref w25q128fv_assets_read .
+ *
+ * @param[in] name          Pointer to the Memory Location Address of the null terminated name of the asset.
+ * @param[out] dst          Pointer to the Memory Location Address where this function will store the data.
+ * @param dst_size          Size in bytes of the memory at \p dst .
+ * @param[out] size         Pointer to the Memory Location Address where this function will store the size in bytes of
+ *                          the data.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully read and its CRC-32 matches.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the asset pack has no asset with that name.
+ * @retval  W25Q128FV_EC_ERR    if no asset pack is mounted, if the data does not fit into \p dst_size bytes, if its
+ *                              CRC-32 does not match or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_assets_load(const char *name, uint8_t *dst, uint32_t dst_size, uint32_t *size);
+
+#endif /* W25Q128FV_ASSETS_H */
+
+/** @} */
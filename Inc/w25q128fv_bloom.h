@@ -0,0 +1,109 @@
+/**@file
+ * @brief	Blocked Bloom filter Header file for the modules that index data stored into the W25Q128FV Flash Memory.
+ *
+ * @defgroup w25q128fv_bloom W25Q128FV Blocked Bloom Filter module
+ * @{
+ *
+ * @brief   This module provides the Bloom filters that the modules built on top of the @ref w25q128fv store alongside
+ *          each of their segments and cache in RAM, so that a lookup of a key that is not in a segment is answered
+ *          without accessing the SPI bus in most cases.
+ *
+ * @details The filters have a blocked layout: they are made of blocks of @ref W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES
+ *          bytes, which is the size of a cache line of a Cortex-M7, and all the bits of a key fall into a single block
+ *          that is chosen by its hash. Therefore, checking a key costs a single cache line fill no matter how many hashes
+ *          are used. The same property also allows a filter to be built one Page at a time (see
+ *          @ref w25q128fv_bloom_add_to_window ) when there is no RAM for the whole of it.
+ * @details The filters are sized from a false positive rate target given in parts per million, from which
+ *          @ref w25q128fv_bloom_get_size and @ref w25q128fv_bloom_get_total_hashes derive the bits per key and the number of
+ *          hashes of a classic Bloom filter. The size is then increased to compensate for the uneven number of keys per
+ *          block, which matters more the lower the target is (e.g., 11 bits per key for 1% but 27 bits per key for
+ *          0.01%, which is where the sizing is capped at @ref W25Q128FV_BLOOM_MAX_BITS_PER_KEY bits per key). The number
+ *          of hashes must be stored alongside each filter since it is needed to check it.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_BLOOM_H
+#define W25Q128FV_BLOOM_H
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES     (32)    /**< @brief Size in bytes of each block (i.e., 256 bits) of a Bloom filter, whose size is always a multiple of it. */
+#define W25Q128FV_BLOOM_MAX_BITS_PER_KEY        (32)    /**< @brief Maximum number of bits per key that the sizing of a Bloom filter may give. */
+
+/**@brief   Gets the size that a Bloom filter needs to meet a false positive rate target.
+ *
+ * @param total_keys            Number of keys that will be added into the Bloom filter.
+ * @param false_positive_ppm    False positive rate target in parts per million (e.g., 10000 for 1%), which must be
+ *                              greater than 0.
+ *
+ * @return  The size in bytes of the Bloom filter, which is a multiple of @ref W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES and
+ *          which is 0 only if \p total_keys is 0.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_bloom_get_size(uint32_t total_keys, uint32_t false_positive_ppm);
+
+/**@brief   Gets the number of hashes (i.e., of bits set per key) that is optimal for a false positive rate target.
+ *
+ * @param false_positive_ppm    False positive rate target in parts per million, which must be greater than 0.
+ *
+ * @return  The number of hashes.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint8_t w25q128fv_bloom_get_total_hashes(uint32_t false_positive_ppm);
+
+/**@brief   Adds a key into a Bloom filter.
+ *
+ * @param bloom         Pointer to the Memory Location Address of the Bloom filter, whose bytes must have been set to 0
+ *                      before the first key was added.
+ * @param size_in_bytes Size in bytes of the Bloom filter.
+ * @param total_hashes  Number of hashes of the Bloom filter.
+ * @param key           Key to be added.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_bloom_add(uint8_t *bloom, uint32_t size_in_bytes, uint8_t total_hashes, uint32_t key);
+
+/**@brief   Adds a key into a window of a Bloom filter, doing nothing if the block of the key is outside of that window.
+ *
+ * @details This allows a Bloom filter to be built and written one window (e.g., one Page) at a time by adding all of
+ *          its keys into each window.
+ *
+ * @param window        Pointer to the Memory Location Address of the window, whose bytes must have been set to 0 before
+ *                      the first key was added.
+ * @param window_offset Offset in bytes of the window inside of the Bloom filter, which must be a multiple of
+ *                      @ref W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES .
+ * @param window_size   Size in bytes of the window, which must be a multiple of
+ *                      @ref W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES .
+ * @param size_in_bytes Size in bytes of the whole Bloom filter.
+ * @param total_hashes  Number of hashes of the Bloom filter.
+ * @param key           Key to be added.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_bloom_add_to_window(uint8_t *window, uint32_t window_offset, uint32_t window_size, uint32_t size_in_bytes, uint8_t total_hashes, uint32_t key);
+
+/**@brief   Tells whether a key might have been added into a Bloom filter.
+ *
+ * @param[in] bloom     Pointer to the Memory Location Address of the Bloom filter.
+ * @param size_in_bytes Size in bytes of the Bloom filter.
+ * @param total_hashes  Number of hashes of the Bloom filter.
+ * @param key           Key to be checked.
+ *
+ * @return  0 if the key was certainly not added or 1 if it might have been.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint8_t w25q128fv_bloom_may_contain(const uint8_t *bloom, uint32_t size_in_bytes, uint8_t total_hashes, uint32_t key);
+
+#endif /* W25Q128FV_BLOOM_H */
+
+/** @} */
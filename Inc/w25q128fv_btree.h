@@ -0,0 +1,179 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's copy-on-write B+tree Header file.
+ *
+ * @defgroup w25q128fv_btree W25Q128FV Copy-on-Write B+tree module
+ * @{
+ *
+ * @brief   This module provides an index of sorted 32-bit keys, each of them with a 32-bit value (e.g., the address of an
+ *          event record whose key is its ID or its timestamp), that is stored into the W25Q128FV Flash Memory Device as a
+ *          copy-on-write B+tree so that point lookups and the start of range scans only cost O(log n) Page reads.
+ *
+ * @details The way that the @ref w25q128fv_btree works is that each node of the tree is exactly one Page of the
+ *          W25Q128FV Device, which holds up to @ref W25Q128FV_BTREE_LEAF_MAX_ENTRIES key/value pairs when it is a leaf or
+ *          up to @ref W25Q128FV_BTREE_INTERNAL_MAX_KEYS keys when it is an internal node. Nodes are never rewritten in
+ *          place: @ref w25q128fv_btree_insert writes new copies of the leaf and of all the nodes on its path up to the
+ *          root, in that order, into the next free Pages, where the new root is flagged as such. Therefore, a power loss
+ *          at any point leaves the previous root and all of its nodes intact, and @ref w25q128fv_btree_mount recovers
+ *          the latest complete root by finding the first free Page via a binary search and then searching backwards
+ *          for the last root Page whose CRC-32 is valid.
+ * @details The managed region of Sectors is split into two halves that are used alternately. Once the active half does
+ *          not have enough free Pages for another insertion, the live nodes of the tree are copied, in post-order, into
+ *          the other half, which is erased first and which then becomes the active half. The region must therefore be
+ *          sized such that each half can hold the whole tree plus a healthy margin of free Pages, since that margin
+ *          is what amortizes the cost of each copy.
+ * @details Since nodes are immutable, a small RAM cache of @ref W25Q128FV_BTREE_CACHE_NODES nodes (which typically holds
+ *          the root and the upper levels of the tree) never needs to be invalidated, except when the active half changes.
+ *          For the same reason, a @ref W25Q128FV_btree_cursor_t keeps iterating over the version of the tree that it was
+ *          positioned on, even if keys are inserted in the meantime.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_BTREE_H
+#define W25Q128FV_BTREE_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_BTREE_CACHE_NODES
+#define W25Q128FV_BTREE_CACHE_NODES         (8)     /**< @brief Number of nodes that the RAM node cache of the @ref w25q128fv_btree can hold. */
+#endif
+#ifndef W25Q128FV_BTREE_MAX_HEIGHT
+#define W25Q128FV_BTREE_MAX_HEIGHT          (6)     /**< @brief Maximum number of levels of the tree, including the leaves. */
+#endif
+#define W25Q128FV_BTREE_LEAF_MAX_ENTRIES    (30)    /**< @brief Maximum number of key/value pairs that a leaf node can hold. */
+#define W25Q128FV_BTREE_INTERNAL_MAX_KEYS   (40)    /**< @brief Maximum number of keys that an internal node can hold, which has one more child than keys. */
+#define W25Q128FV_BTREE_MAX_REGION_SECTORS  (4096)  /**< @brief Maximum number of Sectors that the managed region may have, since nodes address each other with 16-bit Page indexes. */
+
+/**@brief	W25Q128FV Copy-on-Write B+tree Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_btree .
+    uint32_t total_sectors; //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_btree , which must be an even number of at least 2.
+} W25Q128FV_btree_def_t;
+
+/**@brief	Cursor used to scan the keys of the tree in ascending order.
+ *
+ * @details The contents of this structure are managed by @ref w25q128fv_btree_seek and @ref w25q128fv_btree_next and
+ *          must not be modified by the implementer.
+ */
+typedef struct {
+    uint16_t pages[W25Q128FV_BTREE_MAX_HEIGHT];     //!< Page index, relative to the managed region, of the node at each level of the current path.
+    uint8_t positions[W25Q128FV_BTREE_MAX_HEIGHT];  //!< Position of the followed child at each internal level or of the next key at the leaf level.
+    uint8_t height;                                 //!< Number of levels of the version of the tree that the cursor is positioned on.
+    uint32_t generation;                            //!< Generation of the half of the managed region that the cursor is positioned on.
+} W25Q128FV_btree_cursor_t;
+
+/**@brief   Initializes the @ref w25q128fv_btree in order to be able to use its provided functions.
+ *
+ * @details After calling this function, the implementer must either call @ref w25q128fv_btree_mount to recover the tree
+ *          that was stored before or @ref w25q128fv_btree_format to start with an empty one.
+ *
+ * @param[in] btree_def Pointer to the W25Q128FV Copy-on-Write B+tree Definition parameters structure, whose contents will
+ *                      be copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_btree was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region does not have an even number of at least 2 Sectors, if it has more
+ *                              than @ref W25Q128FV_BTREE_MAX_REGION_SECTORS or if it exceeds the existing Sectors of the
+ *                              W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_btree_module(W25Q128FV_btree_def_t *btree_def);
+
+/**@brief   Erases all the Sectors of the managed region and starts an empty tree.
+ *
+ * @retval	W25Q128FV_EC_OK     if the empty tree was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_btree_format(void);
+
+/**@brief   Recovers the latest complete root of the tree that is stored into the managed region.
+ *
+ * @retval	W25Q128FV_EC_OK     if the tree was successfully recovered.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the managed region does not hold a tree (e.g., if it was never formatted), in which
+ *                              case @ref w25q128fv_btree_format should be called.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_btree_mount(void);
+
+/**@brief   Inserts a key into the tree or replaces its value if it already exists.
+ *
+ * @details This writes a new copy of every node on the path from the leaf of the \p key up to the root, plus one more
+ *          node for each of those that has to be split. If the value of the \p key is already \p value , then nothing
+ *          is written.
+ *
+ * @param key       Key to be inserted.
+ * @param value     Value of the \p key .
+ *
+ * @retval	W25Q128FV_EC_OK     if the key was successfully inserted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the tree is not mounted, if it would exceed @ref W25Q128FV_BTREE_MAX_HEIGHT levels,
+ *                              if the live nodes do not fit into a half of the managed region or if anything else went
+ *                              wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_btree_insert(uint32_t key, uint32_t value);
+
+/**@brief   Gets the value of a key.
+ *
+ * @param key           Key to be searched for.
+ * @param[out] value    Pointer to the Memory Location Address where this function will store the value of the \p key .
+ *
+ * @retval	W25Q128FV_EC_OK     if the key was found.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the key does not exist.
+ * @retval  W25Q128FV_EC_ERR    if the tree is not mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_btree_find(uint32_t key, uint32_t *value);
+
+/**@brief   Positions a cursor right before the smallest key that is greater than or equal to a given one.
+ *
+ * @param[out] cursor   Pointer to the Memory Location Address of the cursor to be positioned.
+ * @param key           Key at which the range scan starts.
+ *
+ * @retval	W25Q128FV_EC_OK     if the cursor was successfully positioned.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the tree is not mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_btree_seek(W25Q128FV_btree_cursor_t *cursor, uint32_t key);
+
+/**@brief   Gets the next key/value pair of a range scan and advances the cursor.
+ *
+ * @param cursor        Pointer to the Memory Location Address of a cursor positioned by @ref w25q128fv_btree_seek .
+ * @param[out] key      Pointer to the Memory Location Address where this function will store the key.
+ * @param[out] value    Pointer to the Memory Location Address where this function will store the value of the key.
+ *
+ * @retval	W25Q128FV_EC_OK     if the next key/value pair was successfully obtained.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if there are no more keys.
+ * @retval  W25Q128FV_EC_ERR    if the nodes of the cursor were erased because the active half of the managed region
+ *                              changed since the cursor was positioned, in which case it has to be positioned again, or
+ *                              if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_btree_next(W25Q128FV_btree_cursor_t *cursor, uint32_t *key, uint32_t *value);
+
+#endif /* W25Q128FV_BTREE_H */
+
+/** @} */
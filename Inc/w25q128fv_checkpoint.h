@@ -0,0 +1,121 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's checkpoint of RAM index structures Header file.
+ *
+ * @defgroup w25q128fv_checkpoint W25Q128FV RAM Index Checkpoint module
+ * @{
+ *
+ * @brief   This module provides checkpoints of the RAM index structures of the storage layers that are built on top of
+ *          the @ref w25q128fv (e.g., the live Page table that is given to the @ref w25q128fv_gc or the map from keys to
+ *          the Pages of a log), so that they can be restored at boot by reading just the checkpoint plus the log tail
+ *          written after it instead of scanning large parts of the W25Q128FV Flash Memory Device.
+ *
+ * @details The way that the @ref w25q128fv_checkpoint works is that the implementer designates to it, via the
+ *          @ref init_w25q128fv_checkpoint_module function, a region of twice the given number of Sectors, which holds two
+ *          copies (i.e., A and B) of the checkpoint. A checkpoint is a list of RAM buffers (i.e., the parts, see
+ *          @ref W25Q128FV_checkpoint_part_t ) that are serialized one after the other, together with a log position that
+ *          is chosen by the implementer (e.g., the write sequence number of the last log Page that the checkpoint
+ *          covers) and that is given back when the checkpoint is loaded.
+ * @details @ref w25q128fv_checkpoint_save always writes into the copy that does not hold the newest valid checkpoint,
+ *          with the next generation number and with a CRC-32 of its header and of all its parts, where the magic of its
+ *          header is written last. Therefore, a power loss while saving leaves the previous checkpoint intact.
+ *          @ref w25q128fv_checkpoint_load reads both headers, reads the parts of the newest checkpoint directly into the
+ *          given RAM buffers with one Fast Read per part and falls back to the other copy if the CRC-32 does not match.
+ *          The implementer then only has to replay the log records that are newer than the returned log position:
+ *
+ * @code
+  W25Q128FV_checkpoint_part_t parts[2] = {{(uint8_t *) page_table, sizeof(page_table)}, {(uint8_t *) &page_table_count, sizeof(page_table_count)}};
+  uint32_t log_position;
+  if (w25q128fv_checkpoint_load(parts, 2, &log_position) == W25Q128FV_EC_OK)
+  {
+      replay_log_pages_written_after(log_position);
+  }
+  else
+  {
+      rebuild_page_table_by_scanning_the_whole_log();
+  }
+ * @endcode
+ *
+ * @note    A checkpoint does not have to be saved after every change: the longer the log tail, the longer the replay,
+ *          while each save costs erasing and writing one copy. A common choice is to save one whenever the log tail
+ *          reaches a given length and before a controlled power down.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_CHECKPOINT_H
+#define W25Q128FV_CHECKPOINT_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define W25Q128FV_CHECKPOINT_COPIES     (2)     /**< @brief Number of copies of the checkpoint (i.e., A and B). */
+
+/**@brief	W25Q128FV RAM Index Checkpoint Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;      //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_checkpoint .
+    uint32_t sectors_per_copy;  //!< Number of consecutive Flash Memory Sectors of each copy of the checkpoint, whose first Page holds its header and whose remaining Pages hold its parts.
+} W25Q128FV_checkpoint_def_t;
+
+/**@brief	RAM buffer that is serialized as a part of a checkpoint.
+ */
+typedef struct {
+    uint8_t *data;          //!< Pointer to the Memory Location Address of the RAM buffer.
+    uint32_t size_in_bytes; //!< Size in bytes of the RAM buffer.
+} W25Q128FV_checkpoint_part_t;
+
+/**@brief   Initializes the @ref w25q128fv_checkpoint in order to be able to use its provided functions.
+ *
+ * @param[in] checkpoint_def    Pointer to the W25Q128FV RAM Index Checkpoint Definition parameters structure, whose
+ *                              contents will be copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_checkpoint was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the copies have no Sectors or if they exceed the existing Sectors of the W25Q128FV
+ *                              Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_checkpoint_module(W25Q128FV_checkpoint_def_t *checkpoint_def);
+
+/**@brief   Saves a new checkpoint into the copy that does not hold the newest valid one.
+ *
+ * @details This erases the Sectors of that copy and waits for each of those Sector Erases.
+ *
+ * @param[in] parts     Pointer to the Memory Location Address of the list of parts to be serialized, in order.
+ * @param total_parts   Number of parts in the \p parts list.
+ * @param log_position  Log position covered by the checkpoint, which @ref w25q128fv_checkpoint_load will give back.
+ *
+ * @retval	W25Q128FV_EC_OK     if the checkpoint was successfully saved.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the parts do not fit into a copy or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_checkpoint_save(W25Q128FV_checkpoint_part_t *parts, uint8_t total_parts, uint32_t log_position);
+
+/**@brief   Loads the newest valid checkpoint into the RAM buffers of its parts.
+ *
+ * @param parts             Pointer to the Memory Location Address of the list of parts to be deserialized, which must
+ *                          have the same sizes, in the same order, as the ones that the checkpoint was saved with.
+ * @param total_parts       Number of parts in the \p parts list.
+ * @param[out] log_position Pointer to the Memory Location Address where this function will store the log position
+ *                          covered by the checkpoint.
+ *
+ * @retval	W25Q128FV_EC_OK     if the checkpoint was successfully loaded.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if there is no valid checkpoint with the total size of the \p parts (e.g., if none was
+ *                              ever saved), in which case the contents of the RAM buffers are undefined and the
+ *                              implementer has to rebuild them by other means.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_checkpoint_load(W25Q128FV_checkpoint_part_t *parts, uint8_t total_parts, uint32_t *log_position);
+
+#endif /* W25Q128FV_CHECKPOINT_H */
+
+/** @} */
@@ -0,0 +1,131 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's append-only configuration store Header file.
+ *
+ * @defgroup w25q128fv_config W25Q128FV Configuration Store module
+ * @{
+ *
+ * @brief   This module provides a store of named configuration parameters (e.g., calibration constants, baud rates or
+ *          feature flags) that is kept in the W25Q128FV Flash Memory Device, where all the parameters are loaded at boot
+ *          via a single bulk Fast Read and where updating a parameter never erases it in place.
+ *
+ * @details The way that the @ref w25q128fv_config works is that each parameter is identified by a 32-bit hash of its
+ *          name (i.e., FNV-1a), which C++ implementers get computed at compile time through the
+ *          @ref w25q128fv_config.hpp wrapper, together with values that are typed through templates. The store uses two
+ *          Sectors of the W25Q128FV Device (i.e., the A and B copies), where only the one with the greatest generation
+ *          is active. The active Sector is a log of records, each of them with the key hash, the size of its value and a
+ *          written flag that is cleared once the whole record has been programmed, such that updating a parameter just
+ *          appends a new version of it.
+ * @details @ref w25q128fv_config_mount reads the whole active Sector with a single Fast Read into a RAM image and
+ *          builds a compact table, sorted by key hash, that points to the latest version of each parameter within that
+ *          image. Therefore, @ref w25q128fv_config_get never accesses the SPI bus.
+ * @details Only once the active Sector is full, its latest versions are compacted into the other Sector, whose header
+ *          gets the next generation and whose magic is written last. Since the previously active Sector is left intact
+ *          until then, a power loss at any point never loses a parameter.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_CONFIG_H
+#define W25Q128FV_CONFIG_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_CONFIG_MAX_KEYS
+#define W25Q128FV_CONFIG_MAX_KEYS                   (32)    /**< @brief Maximum number of distinct parameters that the @ref w25q128fv_config can hold. */
+#endif
+#ifndef W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES
+#define W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES    (64)    /**< @brief Maximum size in bytes of the value of a single parameter. */
+#endif
+#define W25Q128FV_CONFIG_SECTORS                    (2)             /**< @brief Number of consecutive Sectors of the W25Q128FV Device that the @ref w25q128fv_config uses. */
+#define W25Q128FV_CONFIG_BLANK_KEY                  (0xFFFFFFFF)    /**< @brief Key hash that is reserved to identify records that have not been written, which cannot be used by any parameter. */
+
+/**@brief	W25Q128FV Configuration Store Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First of the @ref W25Q128FV_CONFIG_SECTORS consecutive Flash Memory Sectors of the W25Q128FV Device managed by the @ref w25q128fv_config .
+} W25Q128FV_config_def_t;
+
+/**@brief   Initializes the @ref w25q128fv_config in order to be able to use its provided functions.
+ *
+ * @details After calling this function, the implementer must either call @ref w25q128fv_config_mount to load the
+ *          parameters that were stored before or @ref w25q128fv_config_format to start with an empty store.
+ *
+ * @param[in] config_def    Pointer to the W25Q128FV Configuration Store Definition parameters structure, whose contents
+ *                          will be copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_config was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given Sectors exceed the existing ones of the W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_config_module(W25Q128FV_config_def_t *config_def);
+
+/**@brief   Erases both Sectors of the store and starts an empty one.
+ *
+ * @retval	W25Q128FV_EC_OK     if the empty store was successfully started and loaded.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_config_format(void);
+
+/**@brief   Loads all the parameters of the store via a single bulk Fast Read of its active Sector.
+ *
+ * @details Records whose writing was interrupted by a power loss are detected because their written flag was never
+ *          cleared, in which case they are ignored and the next update will compact the store.
+ *
+ * @retval	W25Q128FV_EC_OK     if the parameters were successfully loaded.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if none of the Sectors holds a valid header (e.g., if the store was never formatted), in
+ *                              which case @ref w25q128fv_config_format should be called.
+ * @retval  W25Q128FV_EC_ERR    if the store holds more than @ref W25Q128FV_CONFIG_MAX_KEYS distinct parameters or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_config_mount(void);
+
+/**@brief   Gets the value of a parameter from the RAM table without accessing the W25Q128FV Device.
+ *
+ * @param key_hash      FNV-1a hash of the name of the parameter.
+ * @param[out] dst      Pointer to the Memory Location Address where this function will store the value.
+ * @param size          Size in bytes of the value, which must match the size with which it was stored.
+ *
+ * @retval	W25Q128FV_EC_OK     if the value was successfully obtained.
+ * @retval  W25Q128FV_EC_NA     if the parameter has never been stored.
+ * @retval  W25Q128FV_EC_ERR    if the store is not loaded or if the stored value has a different size than \p size .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_config_get(uint32_t key_hash, uint8_t *dst, uint16_t size);
+
+/**@brief   Stores a new version of the value of a parameter.
+ *
+ * @details If the parameter already holds the given value, then nothing is written. Otherwise, the new version is
+ *          appended at the end of the active Sector, which is first compacted into the other Sector if it is full.
+ *
+ * @param key_hash      FNV-1a hash of the name of the parameter, which must not be @ref W25Q128FV_CONFIG_BLANK_KEY .
+ * @param[in] src       Pointer to the Memory Location Address where the value is located at.
+ * @param size          Size in bytes of the value, which may be any from 1 up to
+ *                      @ref W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES .
+ *
+ * @retval	W25Q128FV_EC_OK     if the value was successfully stored.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the store is not loaded, if the \p key_hash or the \p size are invalid, if there is
+ *                              no room for another parameter or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_config_set(uint32_t key_hash, uint8_t *src, uint16_t size);
+
+#endif /* W25Q128FV_CONFIG_H */
+
+/** @} */
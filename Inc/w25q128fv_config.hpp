@@ -0,0 +1,154 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's typed configuration store C++ Header file.
+ *
+ * @defgroup w25q128fv_config_cpp W25Q128FV Typed Configuration Store C++ wrapper
+ * @{
+ *
+ * @brief   This header-only wrapper lets C++ implementers access the @ref w25q128fv_config through typed keys whose
+ *          names are hashed at compile time.
+ *
+ * @details Each parameter is declared once as a constexpr @ref w25q128fv::config::Key , whose template argument is the
+ *          type of its value and whose constructor computes the FNV-1a hash of its name at compile time. Therefore,
+ *          neither the names nor any hand-maintained offsets end up in the firmware, and reading a parameter with a
+ *          different type than the one that it was declared with fails to compile. For example:
+ * @code
+ *          constexpr w25q128fv::config::Key<uint32_t> UART_BAUD_RATE("uart.baud_rate");
+ *          uint32_t baud_rate = w25q128fv::config::get(UART_BAUD_RATE, 115200);
+ *          w25q128fv::config::set(UART_BAUD_RATE, 921600);
+ * @endcode
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_CONFIG_HPP
+#define W25Q128FV_CONFIG_HPP
+
+extern "C" {
+#include "w25q128fv_config.h" // This custom Mortrack's library contains the functions, definitions and variables of the W25Q128FV Configuration Store module.
+}
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <type_traits> // Library from which "std::is_trivially_copyable", "std::common_type" and "std::enable_if" are located at.
+
+namespace w25q128fv
+{
+namespace config
+{
+
+/**@brief   Computes the 32-bit FNV-1a hash of a null terminated string, at compile time whenever it is used in a constant
+ *          expression.
+ *
+ * @param[in] name  Pointer to the Memory Location Address where the null terminated string is located at.
+ * @param hash      Hash of the characters that precede \p name , which must be left with its default value by the
+ *                  implementer.
+ *
+ * @return  The FNV-1a hash of \p name .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+constexpr uint32_t fnv1a(const char *name, uint32_t hash = 2166136261u)
+{
+    return (*name == '\0') ? hash : fnv1a(name + 1, (hash ^ static_cast<uint8_t>(*name)) * 16777619u);
+}
+
+/**@brief	Key of a parameter of the @ref w25q128fv_config whose value has the type \p T .
+ *
+ * @tparam T    Type of the value of the parameter, which must be trivially copyable and no larger than
+ *              @ref W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES .
+ */
+template <typename T>
+struct Key
+{
+    static_assert(std::is_trivially_copyable<T>::value, "The values of the W25Q128FV Configuration Store must be trivially copyable.");
+    static_assert(sizeof(T) <= W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES, "The value exceeds W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES.");
+
+    uint32_t hash;  //!< FNV-1a hash of the name of the parameter.
+
+    /**@brief   Declares a parameter by hashing its name.
+     *
+     * @param[in] name  Name of the parameter.
+     *
+     * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+     * @date	October 17, 2026.
+     */
+    constexpr explicit Key(const char *name) : hash(fnv1a(name)) {}
+};
+
+/**@brief   Gets the value of a parameter from the RAM table of the @ref w25q128fv_config .
+ *
+ * @param key           Key of the parameter.
+ * @param[out] value    Reference to the variable where this function will store the value.
+ *
+ * @retval	W25Q128FV_EC_OK     if the value was successfully obtained.
+ * @retval  W25Q128FV_EC_NA     if the parameter has never been stored.
+ * @retval  W25Q128FV_EC_ERR    if the store is not loaded or if the parameter was stored with a different size.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+template <typename T>
+inline W25Q128FV_Status get(const Key<T> &key, T &value)
+{
+    return w25q128fv_config_get(key.hash, reinterpret_cast<uint8_t *>(&value), sizeof(T));
+}
+
+/**@brief   Rejects, at compile time, reading a parameter into a variable of a different type than the one that it was
+ *          declared with, which would otherwise silently resolve to the overload that takes a default value.
+ *
+ * @param key           Key of the parameter.
+ * @param[out] value    Reference to a variable whose type is not the one of the parameter.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+template <typename T, typename U, typename = typename std::enable_if<!std::is_const<U>::value && !std::is_same<T, U>::value>::type>
+W25Q128FV_Status get(const Key<T> &key, U &value) = delete;
+
+/**@brief   Gets the value of a parameter from the RAM table of the @ref w25q128fv_config or a default one.
+ *
+ * @param key               Key of the parameter.
+ * @param default_value     Value to be returned if the parameter could not be obtained, which is converted to the type
+ *                          of the parameter (e.g., an \c int literal for a \c uint32_t parameter) since only \p key
+ *                          determines \p T .
+ *
+ * @return  The value of the parameter or \p default_value if it could not be obtained.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+template <typename T>
+inline T get(const Key<T> &key, const typename std::common_type<T>::type &default_value)
+{
+    /** <b>Local variable value:</b> Variable of the type of the parameter used to hold its value. */
+    T value;
+
+    return (get(key, value) == W25Q128FV_EC_OK) ? value : default_value;
+}
+
+/**@brief   Stores a new version of the value of a parameter into the @ref w25q128fv_config .
+ *
+ * @param key       Key of the parameter.
+ * @param value     Value to be stored, which is converted to the type of the parameter since only \p key determines
+ *                  \p T .
+ *
+ * @retval	W25Q128FV_EC_OK     if the value was successfully stored.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the store is not loaded, if there is no room for another parameter or if anything
+ *                              else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+template <typename T>
+inline W25Q128FV_Status set(const Key<T> &key, const typename std::common_type<T>::type &value)
+{
+    return w25q128fv_config_set(key.hash, reinterpret_cast<uint8_t *>(const_cast<T *>(&value)), sizeof(T));
+}
+
+} // namespace config
+} // namespace w25q128fv
+
+#endif /* W25Q128FV_CONFIG_HPP */
+
+/** @} */
@@ -0,0 +1,75 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's pipelined copier into the internal Flash Memory of our MCU Header file.
+ *
+ * @defgroup w25q128fv_copier W25Q128FV Internal Flash Copier module
+ * @{
+ *
+ * @brief   This module copies data, such as a staged firmware image, from the W25Q128FV Flash Memory Device into the
+ *          internal Flash Memory of our MCU/MPU (e.g., from a bootloader), such that reading the next chunk from the
+ *          W25Q128FV Device overlaps with programming the current one into the internal Flash Memory.
+ *
+ * @details The way that the @ref w25q128fv_copier works is that the data is read via @ref w25q128fv_stream_read , which
+ *          receives the next chunk via DMA while the current one is being handed to the implementer's
+ *          @ref W25Q128FV_copier_program_callback_t , which programs it into the internal Flash Memory. Right after
+ *          that, the programmed internal Flash Memory is read back from its memory-mapped addresses, compared with the
+ *          chunk and added into a running CRC-32. Therefore, a chunk that was not correctly programmed stops the copy
+ *          right away, and the CRC-32 of the whole copy, as it ended up in the internal Flash Memory, is obtained without
+ *          a separate verification pass, such that it can be compared with the expected one (e.g., from the manifest of
+ *          the image).
+ * @details Since the programming process of the internal Flash Memory differs between MCU families (e.g., Pages on the
+ *          STM32F1 series and Sectors on the STM32F4 series), it is done by the implementer's callback, which would
+ *          typically erase each Page or Sector of the internal Flash Memory when the first chunk within it arrives and
+ *          then program the chunk via @ref HAL_FLASH_Program .
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_COPIER_H
+#define W25Q128FV_COPIER_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+/**@brief   Programs a chunk of data into the internal Flash Memory of our MCU/MPU.
+ *
+ * @note    This function is called while the next chunk is being received from the W25Q128FV Device, so it must not
+ *          call any function of the @ref w25q128fv .
+ *
+ * @param[out] dst  Pointer to the memory-mapped Memory Location Address of the internal Flash Memory where the chunk is
+ *                  to be programmed.
+ * @param[in] src   Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk, which is @ref W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES except,
+ *                  possibly, for the last chunk.
+ *
+ * @retval  W25Q128FV_EC_OK     if the chunk was successfully programmed.
+ * @retval  other               to stop the copy, in which case @ref w25q128fv_copy_to_internal_flash will return this
+ *                              same value.
+ */
+typedef W25Q128FV_Status (*W25Q128FV_copier_program_callback_t)(uint8_t *dst, const uint8_t *src, uint16_t size);
+
+/**@brief   Copies a range of the Flash Memory of the W25Q128FV Device into the internal Flash Memory of our MCU/MPU.
+ *
+ * @param address       W25Q128FV Device 24-bit Flash Memory Address from which it is desired to start copying data.
+ * @param size          Size in bytes of the data to be copied.
+ * @param[out] dst      Pointer to the memory-mapped Memory Location Address of the internal Flash Memory where the
+ *                      data is to be copied.
+ * @param program       Function that will program each chunk into the internal Flash Memory.
+ * @param[out] crc32    Pointer to the Memory Location Address where this function will store the CRC-32 of the copied
+ *                      data, as read back from the internal Flash Memory, or \c NULL if it is not needed.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully copied and every chunk in the internal Flash Memory
+ *                              matches the one read from the W25Q128FV Device.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the range exceeds the existing W25Q128FV Flash Memory locations, if any chunk was not
+ *                              correctly programmed into the internal Flash Memory or if anything else went wrong.
+ * @retval  other               value returned by \p program if it asked to stop the copy.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_copy_to_internal_flash(uint32_t address, uint32_t size, uint8_t *dst, W25Q128FV_copier_program_callback_t program, uint32_t *crc32);
+
+#endif /* W25Q128FV_COPIER_H */
+
+/** @} */
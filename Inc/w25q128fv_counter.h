@@ -0,0 +1,107 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's bit-clearing monotonic counters Header file.
+ *
+ * @defgroup w25q128fv_counter W25Q128FV Monotonic Counter module
+ * @{
+ *
+ * @brief   This module provides persistent monotonic counters (e.g., boot counters, uptime counters or sequence numbers)
+ *          that are stored into the W25Q128FV Flash Memory Device and whose increments cost a single 1-byte Page
+ *          Program instead of a Sector Erase.
+ *
+ * @details The way that the @ref w25q128fv_counter works is that each counter is given two consecutive Sectors of the
+ *          W25Q128FV Device (i.e., the A and B copies), where only one of them is active at a time. The active Sector
+ *          starts with a header that holds a base value and a generation number, and the rest of it is a bitmap where
+ *          each increment clears the next bit, starting from the least significant bit of the first byte. Therefore,
+ *          the value of a counter is its base value plus the number of cleared bits, which allows
+ *          @ref W25Q128FV_COUNTER_INCREMENTS_PER_ERASE increments per Sector Erase.
+ * @details Only once all the bits of the active Sector have been cleared, the counter is folded: the other Sector is
+ *          erased and its header is written with the current value as its base value and with the next generation,
+ *          after which that Sector becomes the active one. Since the previously active Sector is left intact, a power
+ *          loss during a fold never loses the value of the counter.
+ * @details Mounting a counter via @ref w25q128fv_counter_mount reads both Sector headers and then finds the number of
+ *          cleared bits via a binary search over the bytes of the bitmap, which costs only about a dozen reads.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_COUNTER_H
+#define W25Q128FV_COUNTER_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_COUNTER_MAX_COUNTERS
+#define W25Q128FV_COUNTER_MAX_COUNTERS          (4)     /**< @brief Maximum number of counters that can be mounted at the same time. */
+#endif
+#define W25Q128FV_COUNTER_SECTORS_PER_COUNTER   (2)     /**< @brief Number of consecutive Sectors of the W25Q128FV Device that each counter uses. */
+#define W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES  (16)    /**< @brief Size in bytes of the header at the beginning of each Sector of a counter. */
+#define W25Q128FV_COUNTER_INCREMENTS_PER_ERASE  ((W25Q128FV_SECTOR_SIZE_IN_BYTES - W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES) * 8) /**< @brief Number of increments that a counter can make before it has to be folded, which costs one Sector Erase. */
+
+/**@brief   Erases both Sectors of a counter and starts it at a given value.
+ *
+ * @param counter_id        ID of the counter, which may be any from 0 up to @ref W25Q128FV_COUNTER_MAX_COUNTERS minus one.
+ * @param first_sector      First of the @ref W25Q128FV_COUNTER_SECTORS_PER_COUNTER Flash Memory Sectors of the
+ *                          W25Q128FV Device that are reserved for the counter.
+ * @param initial_value     Value with which the counter starts.
+ *
+ * @retval	W25Q128FV_EC_OK     if the counter was successfully started and mounted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the \p counter_id is invalid, if the Sectors exceed the existing ones of the W25Q128FV
+ *                              Device or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_counter_format(uint8_t counter_id, uint32_t first_sector, uint32_t initial_value);
+
+/**@brief   Loads the value of a counter that was stored before.
+ *
+ * @param counter_id        ID of the counter, which may be any from 0 up to @ref W25Q128FV_COUNTER_MAX_COUNTERS minus one.
+ * @param first_sector      First of the @ref W25Q128FV_COUNTER_SECTORS_PER_COUNTER Flash Memory Sectors of the
+ *                          W25Q128FV Device that are reserved for the counter.
+ *
+ * @retval	W25Q128FV_EC_OK     if the counter was successfully mounted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if none of the Sectors of the counter holds a valid header (e.g., if it was never
+ *                              formatted), in which case @ref w25q128fv_counter_format should be called.
+ * @retval  W25Q128FV_EC_ERR    if the \p counter_id is invalid, if the Sectors exceed the existing ones of the W25Q128FV
+ *                              Device or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_counter_mount(uint8_t counter_id, uint32_t first_sector);
+
+/**@brief   Increments a mounted counter by one.
+ *
+ * @details This costs a single 1-byte Page Program, except for one every
+ *          @ref W25Q128FV_COUNTER_INCREMENTS_PER_ERASE increments, which also folds the counter into its other Sector.
+ *
+ * @param counter_id    ID of the counter.
+ *
+ * @retval	W25Q128FV_EC_OK     if the counter was successfully incremented.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the counter is not mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_counter_increment(uint8_t counter_id);
+
+/**@brief   Gets the current value of a mounted counter without accessing the W25Q128FV Device.
+ *
+ * @param counter_id    ID of the counter.
+ * @param[out] value    Pointer to the Memory Location Address where this function will store the value of the counter.
+ *
+ * @retval	W25Q128FV_EC_OK     if the value was successfully obtained.
+ * @retval  W25Q128FV_EC_ERR    if the counter is not mounted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_counter_get(uint8_t counter_id, uint32_t *value);
+
+#endif /* W25Q128FV_COUNTER_H */
+
+/** @} */
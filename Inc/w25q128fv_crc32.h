@@ -0,0 +1,40 @@
+/**@file
+ * @brief	CRC-32 calculation Header file for the modules that persist metadata into the W25Q128FV Flash Memory.
+ *
+ * @defgroup w25q128fv_crc32 W25Q128FV CRC-32 module
+ * @{
+ *
+ * @brief   This module provides the CRC-32 (i.e., the IEEE 802.3 polynomial 0x04C11DB7 in its reflected form, as used by
+ *          zlib) that the modules built on top of the @ref w25q128fv use to validate the metadata that they persist into
+ *          the W25Q128FV Flash Memory Device.
+ *
+ * @details The calculation is made with a 16 entries table (i.e., 4 bits at a time) so that it only costs 64 bytes of
+ *          Flash Memory of our MCU/MPU while still being several times faster than a bit by bit calculation.
+ * @details The CRC of a data that is split in several parts can be calculated by feeding the result of each call to
+ *          @ref w25q128fv_crc32_update into the next one, starting with a 0.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_CRC32_H
+#define W25Q128FV_CRC32_H
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+/**@brief   Updates a CRC-32 value with some more data.
+ *
+ * @param crc       CRC-32 of the previous parts of the data or 0 if this is the first part.
+ * @param[in] data  Pointer to the Memory Location Address where the data to be added into the CRC-32 is located at.
+ * @param size      Size in bytes of the data to be added into the CRC-32.
+ *
+ * @return  The CRC-32 of all the data given so far.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_crc32_update(uint32_t crc, const uint8_t *data, uint32_t size);
+
+#endif /* W25Q128FV_CRC32_H */
+
+/** @} */
@@ -0,0 +1,132 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's cache-coherent DMA buffer policy Header file.
+ *
+ * @defgroup w25q128fv_dma W25Q128FV DMA Buffer Policy module
+ * @{
+ *
+ * @brief   This module keeps the buffers into which the @ref w25q128fv receives data via DMA coherent with the data
+ *          cache of MCUs that have one (e.g., the Cortex-M7 of the STM32F7 and STM32H7 series), since otherwise the CPU
+ *          could read stale cached data instead of the data that the DMA wrote into RAM.
+ *
+ * @details The @ref W25Q128FV_DMA_POLICY selects one of the following policies:
+ *          <ul>
+ *              <li>
+ *                  @ref W25Q128FV_DMA_POLICY_NONE , for MCUs without data cache (e.g., the STM32F1 series), in which
+ *                  no cache maintenance is made at all.
+ *              </li>
+ *              <li>
+ *                  @ref W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE , in which each buffer is invalidated by address range,
+ *                  in whole cache lines of @ref W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES bytes, both before the DMA
+ *                  starts writing it and after it has finished (i.e., to also drop the lines that the CPU may have
+ *                  speculatively fetched meanwhile). Since invalidating a line that is only partially covered by the
+ *                  buffer would also discard any data of the CPU that shares that line, only the whole lines of a
+ *                  buffer are received into it via DMA, whereas its unaligned head and tail bytes are received into a
+ *                  bounce buffer that is taken from the @ref w25q128fv_mempool and then copied by the CPU.
+ *              </li>
+ *              <li>
+ *                  @ref W25Q128FV_DMA_POLICY_NON_CACHEABLE , in which the buffers of the @ref w25q128fv are placed in
+ *                  the @ref W25Q128FV_DMA_NON_CACHEABLE_SECTION linker section, which the implementer must map to a RAM
+ *                  region that the MPU configures as non-cacheable. The buffers given by the implementer must then be
+ *                  placed there too (e.g., via @ref W25Q128FV_DMA_BUFFER_ATTRIBUTES ).
+ *              </li>
+ *          </ul>
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_DMA_H
+#define W25Q128FV_DMA_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define W25Q128FV_DMA_POLICY_NONE               (0)     /**< @brief Policy in which no cache maintenance is made, which is meant for MCUs without data cache. */
+#define W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE  (1)     /**< @brief Policy in which the DMA buffers are invalidated by address range and their unaligned bytes go through a bounce buffer. */
+#define W25Q128FV_DMA_POLICY_NON_CACHEABLE      (2)     /**< @brief Policy in which the DMA buffers live in a non-cacheable RAM region. */
+#ifndef W25Q128FV_DMA_POLICY
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define W25Q128FV_DMA_POLICY                    (W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE)    /**< @brief Cache policy of the DMA buffers, which by default depends on whether the MCU has a data cache. */
+#else
+#define W25Q128FV_DMA_POLICY                    (W25Q128FV_DMA_POLICY_NONE)                 /**< @brief Cache policy of the DMA buffers, which by default depends on whether the MCU has a data cache. */
+#endif
+#endif
+#define W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES  (32)    /**< @brief Size in bytes of a line of the data cache of the Cortex-M7. */
+#ifndef W25Q128FV_DMA_NON_CACHEABLE_SECTION
+#define W25Q128FV_DMA_NON_CACHEABLE_SECTION     ".w25q128fv_dma"    /**< @brief Linker section of the DMA buffers when the @ref W25Q128FV_DMA_POLICY is @ref W25Q128FV_DMA_POLICY_NON_CACHEABLE . */
+#endif
+#ifndef W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES
+#define W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES    (0)     /**< @brief Minimum size in bytes from which @ref w25q128fv_read_flash_memory and @ref w25q128fv_fast_read_flash_memory receive their data via DMA instead of via polling, or 0 if they never do so. @note The SPI given to @ref init_w25q128fv_module must then have a DMA channel linked to its reception. */
+#endif
+
+#if W25Q128FV_DMA_POLICY == W25Q128FV_DMA_POLICY_NON_CACHEABLE
+#define W25Q128FV_DMA_BUFFER_ATTRIBUTES         __attribute__ ((section (W25Q128FV_DMA_NON_CACHEABLE_SECTION), aligned (W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES)))  /**< @brief Attributes with which the DMA buffers are declared. */
+#else
+#define W25Q128FV_DMA_BUFFER_ATTRIBUTES         __attribute__ ((aligned (W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES)))  /**< @brief Attributes with which the DMA buffers are declared. */
+#endif
+#define W25Q128FV_DMA_ROUND_UP_TO_LINE(size)    (((size) + W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES-1) & ~(W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES-1))    /**< @brief Rounds up a size in bytes to whole cache lines. */
+#ifndef W25Q128FV_DMA_CLEAN_DCACHE
+#define W25Q128FV_DMA_CLEAN_DCACHE(address, size)       SCB_CleanDCache_by_Addr((void *) (address), (int32_t) (size))       /**< @brief Writes the dirty cache lines of an address range, which must be whole lines, back into RAM. */
+#endif
+#ifndef W25Q128FV_DMA_INVALIDATE_DCACHE
+#define W25Q128FV_DMA_INVALIDATE_DCACHE(address, size)  SCB_InvalidateDCache_by_Addr((void *) (address), (int32_t) (size))  /**< @brief Discards the cache lines of an address range, which must be whole lines. */
+#endif
+
+/**@brief   Writes back into RAM the cache lines that hold a buffer that the DMA is about to read (i.e., to transmit).
+ *
+ * @note    This does nothing unless the @ref W25Q128FV_DMA_POLICY is @ref W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE .
+ *
+ * @param[in] buffer    Pointer to the Memory Location Address of the buffer, whose partially covered lines are also
+ *                      written back.
+ * @param size          Size in bytes of the buffer.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_dma_clean(const void *buffer, uint32_t size);
+
+/**@brief   Discards the cache lines that hold a buffer that the DMA is about to write or has just written (i.e., to
+ *          receive), so that the CPU reads it from RAM.
+ *
+ * @note    This does nothing unless the @ref W25Q128FV_DMA_POLICY is @ref W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE .
+ *
+ * @param[in,out] buffer    Pointer to the Memory Location Address of the buffer, which must start at a cache line.
+ * @param size              Size in bytes of the buffer, which must be a whole number of cache lines.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_dma_invalidate(void *buffer, uint32_t size);
+
+/**@brief   Gets how many bytes at the start of a buffer must be received via a bounce buffer, because they only
+ *          partially cover their cache line.
+ *
+ * @param[in] buffer    Pointer to the Memory Location Address of the buffer.
+ * @param size          Size in bytes of the buffer.
+ *
+ * @return  The number of bytes, which is always 0 unless the @ref W25Q128FV_DMA_POLICY is
+ *          @ref W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE , and which is \p size if the buffer does not cover any whole
+ *          cache line.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_dma_get_head_size(const void *buffer, uint32_t size);
+
+/**@brief   Gets how many bytes, right after the head given by @ref w25q128fv_dma_get_head_size , may be received
+ *          directly into a buffer via DMA, the rest of it being its tail, which must be received via a bounce buffer.
+ *
+ * @param[in] buffer    Pointer to the Memory Location Address of the buffer.
+ * @param size          Size in bytes of the buffer.
+ *
+ * @return  The number of bytes, which is a whole number of cache lines if the @ref W25Q128FV_DMA_POLICY is
+ *          @ref W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_dma_get_body_size(const void *buffer, uint32_t size);
+
+#endif /* W25Q128FV_DMA_H */
+
+/** @} */
@@ -544,6 +544,32 @@
 #include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
 
 #define W25Q128FV_SPI_TIMEOUT   (8500)    /**< @brief Designated timeout in milliseconds for our MCU/MPU to send/receive SPI transactions/data. @note Make sure to adapt this value so that your MCU/MPU is able to complete a full read, write or any other type of request to your W25Q128FV Flash Memory Device. The best value for this definition will vary depending on the Clock Frequency that you set in your MCU/MPU. */
+#define W25Q128FV_SECTOR_SIZE_IN_PAGES                          (16)        /**< @brief Size in pages of a single Sector of a W25Q128FV Flash Memory Device. */
+#define W25Q128FV_PAGE_SIZE_IN_BYTES                            (256)       /**< @brief Size in bytes of a single page of a W25Q128FV Flash Memory Device. */
+#define W25Q128FV_TOTAL_PAGES                                   (65356)     /**< @brief Total number of pages in a W25Q128FV Flash Memory Device. */
+#define W25Q128FV_TOTAL_SECTORS                                 (4085)      /**< @brief Total number of sectors in a W25Q128FV Flash Memory Device. */
+#define W25Q128FV_TOTAL_SECTORS_MINUS_ONE                       (4084)      /**< @brief Total number of sectors in a W25Q128FV Flash Memory Device minus one. */
+#define W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES              (16731136)  /**< @brief Total size in bytes that can be read/written in the W25Q128FV Flash Memory Device. */
+#define W25Q128FV_SECTOR_SIZE_IN_BYTES                          (4096)      /**< @brief Total size in bytes of a Sector in the W25Q128FV Flash Memory Device. @details The value of this definition should equal that of @ref W25Q128FV_SECTOR_SIZE_IN_PAGES times @ref W25Q128FV_PAGE_SIZE_IN_BYTES . */
+#define W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS                   (400)       /**< @brief Maximum time in milliseconds that the W25Q128FV datasheet states that a W25Q128FV Device requires in order to finish erasing a Sector. */
+#define W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS                    (16)        /**< @brief Size in Sectors of a single 64KB Block of a W25Q128FV Flash Memory Device. */
+#define W25Q128FV_TOTAL_BLOCKS_64KB                             (255)       /**< @brief Total number of 64KB Blocks whose Sectors are all within the @ref W25Q128FV_TOTAL_SECTORS of a W25Q128FV Flash Memory Device. */
+#define W25Q128FV_BLOCK_64KB_ERASE_MAX_TIME_IN_MS               (2000)      /**< @brief Maximum time in milliseconds that the W25Q128FV datasheet states that a W25Q128FV Device requires in order to finish erasing a 64KB Block. */
+#ifndef W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES
+#define W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES               (256)       /**< @brief Size in bytes of each of the two RAM buffers into which the @ref w25q128fv_stream_read function receives the data that it hands to its callback. */
+#endif
+#ifndef W25Q128FV_READV_MAX_ENTRIES
+#define W25Q128FV_READV_MAX_ENTRIES                             (32)        /**< @brief Maximum number of entries that can be given to a single call of the @ref w25q128fv_readv function. */
+#endif
+#ifndef W25Q128FV_READV_GAP_THRESHOLD_IN_BYTES
+#define W25Q128FV_READV_GAP_THRESHOLD_IN_BYTES                  (32)        /**< @brief Maximum number of unrequested bytes between two ranges given to the @ref w25q128fv_readv function for them to be read with the same Fast Read Instruction. @details Reading a gap costs one SPI byte per byte, whereas starting a new Fast Read Instruction costs its 5 bytes plus the CS toggling and the setup of another HAL transfer, which on a typical MCU take roughly as long as a few tens of SPI bytes. */
+#endif
+#ifndef W25Q128FV_HARDWARE_NSS
+#define W25Q128FV_HARDWARE_NSS                                  (0)         /**< @brief Flag that indicates whether the CS Pin of the W25Q128FV Device is driven by the NSS output of the SPI given to @ref init_w25q128fv_module (i.e., 1) or by the GPIO Pin given to it (i.e., 0). @details With 1, this @ref w25q128fv enables the SPI right before each Instruction and disables it right after, so that the NSS output of the SPI frames the whole Instruction without any GPIO write. The SPI must then be configured with its NSS as Hardware NSS Output Signal and, on the SPIs that have the NSS Pulse Mode (e.g., those of the STM32F3, STM32F7 and STM32L4 series), with that mode disabled (i.e., \c SPI_NSS_PULSE_DISABLE ), since it pulses the NSS high between consecutive bytes, which the W25Q128FV Device takes as the end of the Instruction. @note Since the NSS output is released rather than driven high while the SPI is disabled, the CS line requires a pull-up resistor. @note The SPIs whose HAL disables them at the end of every transfer (e.g., those of the STM32H7 series) cannot be used with 1. */
+#endif
+#ifndef W25Q128FV_INTERRUPT_SHORT_COMMANDS
+#define W25Q128FV_INTERRUPT_SHORT_COMMANDS                      (0)         /**< @brief Flag that indicates whether the short Instructions (i.e., Write Enable, Write Disable, Read Status Register-1 and the other one byte Instructions) are sent via interrupts (i.e., 1) or via polling (i.e., 0). @details With 1, the caller waits for these Instructions exactly as it waits for a DMA transfer, so that with the @ref W25Q128FV_os_hooks_t::wait_for_dma hook the CPU is free for other tasks during them. @note The interrupts of the SPI given to @ref init_w25q128fv_module must then be enabled. */
+#endif
 
 /**@brief	W25Q128FV Exception codes.
  *
@@ -579,6 +605,43 @@ typedef struct __attribute__ ((__packed__)) {
     W25Q128FV_GPIO_def_t CS;	//!< Type Definition of the GPIO peripheral port to which the CS terminal of the W25Q128FV device is connected to.
 } W25Q128FV_peripherals_def_t;
 
+/**@brief	W25Q128FV Read Entry structure, which describes one of the ranges to be read by the @ref w25q128fv_readv
+ *          function.
+ */
+typedef struct {
+    uint32_t address;   //!< W25Q128FV Device 24-bit Flash Memory Address from which it is desired to start reading data.
+    uint32_t size;      //!< Size in bytes to read from the W25Q128FV Device, where a 0 means that this entry will be ignored.
+    uint8_t *dst;       //!< Pointer to the start of the Memory Location Address of our MCU/MPU where it is desired to store the data read from the W25Q128FV Device.
+} W25Q128FV_read_entry_t;
+
+/**@brief   Consumer of the chunks of data that are read by the @ref w25q128fv_stream_read function.
+ *
+ * @details This function is called once per chunk, in the order in which the chunks are located in the W25Q128FV Device,
+ *          while the next chunk is being received via DMA. Therefore, it must not call any other function of the
+ *          @ref w25q128fv , since the W25Q128FV Device is still in the middle of a Fast Read Instruction.
+ *
+ * @param[in] chunk Pointer to the Memory Location Address where the chunk is located at, which is only valid until
+ *                  this function returns.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval  W25Q128FV_EC_OK     if the next chunk is desired.
+ * @retval  other               to stop reading, in which case @ref w25q128fv_stream_read will return this same value
+ *                              (e.g., @ref W25Q128FV_EC_STOP if the consumer needs no more data).
+ */
+typedef W25Q128FV_Status (*W25Q128FV_stream_read_callback_t)(uint8_t *chunk, uint16_t size);
+
+/**@brief	W25Q128FV Driver Operating System hooks structure.
+ *
+ * @details This contains the functions that the @ref w25q128fv uses, instead of busy-waiting, whenever it has to wait
+ *          for the W25Q128FV Device or for a DMA transfer, such that an RTOS (e.g., via the @ref w25q128fv_rtos ) can
+ *          block the calling task and run the other ones meanwhile. Any of them may be \c NULL , in which case the
+ *          @ref w25q128fv will busy-wait as usual.
+ */
+typedef struct {
+    void (*delay)(uint32_t delay_in_ms);                        //!< Function that blocks the caller for at least the given number of milliseconds.
+    W25Q128FV_Status (*wait_for_dma)(uint32_t timeout_in_ms);   //!< Function that blocks the caller until the DMA transfer (or, with @ref W25Q128FV_INTERRUPT_SHORT_COMMANDS , the interrupt-driven transfer) that the @ref w25q128fv started in its SPI completes or fails, where it must return @ref W25Q128FV_EC_OK once it did or @ref W25Q128FV_EC_NR if the given timeout passed.
+} W25Q128FV_os_hooks_t;
+
 /**@brief   Sends a Software Reset request to the W25Q128FV Flash Memory Device.
  *
  * @details For this purpose, both the Enable Reset and the Reset Device Instructions described in the datasheet are
@@ -648,6 +711,8 @@ W25Q128FV_Status w25q128fv_read_id(uint32_t *w25q128fv_id);
  * @note    Note that the valid values for both the \p page_bytes_offset and \p size params can be any from 0 up to
  *          @ref W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES , as long as the W25Q128FV Flash Memory Addresses to read
  *          data are existing ones.
+ * @note    Reads of at least @ref W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES bytes are received via DMA, keeping \p dst
+ *          coherent with the data cache as stated by the @ref W25Q128FV_DMA_POLICY (see @ref w25q128fv_dma ).
  *
  * @retval	W25Q128FV_EC_OK     if the W25Q128FV Read Data Instruction was successfully sent to the W25Q128FV Device and
  *                              if the data that was read from the Device was successfully stored into the Memory
@@ -684,6 +749,8 @@ W25Q128FV_Status w25q128fv_read_flash_memory(uint32_t start_page, uint8_t page_b
  * @note    Note that the valid values for both the \p page_bytes_offset and \p size params can be any from 0 up to
  *          @ref W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES , as long as the W25Q128FV Flash Memory Addresses to read
  *          data are existing ones.
+ * @note    Reads of at least @ref W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES bytes are received via DMA, keeping \p dst
+ *          coherent with the data cache as stated by the @ref W25Q128FV_DMA_POLICY (see @ref w25q128fv_dma ).
  *
  * @retval	W25Q128FV_EC_OK     if the W25Q128FV Fast Read Instruction was successfully sent to the W25Q128FV Device and
  *                              if the data that was read from the Device was successfully stored into the Memory
@@ -697,6 +764,60 @@ W25Q128FV_Status w25q128fv_read_flash_memory(uint32_t start_page, uint8_t page_b
  */
 W25Q128FV_Status w25q128fv_fast_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst);
 
+/**@brief   Reads several ranges of the Flash Memory of the W25Q128FV Device with as few Fast Read Instructions as
+ *          possible.
+ *
+ * @details The given entries are visited in ascending order of their addresses, and each range that starts no more than
+ *          @ref W25Q128FV_READV_GAP_THRESHOLD_IN_BYTES bytes after the end of the ranges that precede it is read within
+ *          the same Fast Read Instruction, during which the CS pin of the W25Q128FV Device is kept low and the bytes of
+ *          the gap are read and discarded. Otherwise, a new Fast Read Instruction is started.
+ * @details The data of each range is received directly into its destination. The only exception are the bytes of a
+ *          range that overlap with the ones of a previous range, which are copied from the destination of the latter
+ *          since they were already received.
+ * @note    The given entries are not modified, so their order is irrelevant.
+ *
+ * @param[in] entries       Pointer to the Memory Location Address of the array of entries that describe the ranges to
+ *                          be read.
+ * @param total_entries     Number of entries in \p entries , which may be any from 0 up to
+ *                          @ref W25Q128FV_READV_MAX_ENTRIES .
+ *
+ * @retval	W25Q128FV_EC_OK     if all the ranges were successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if there are more than @ref W25Q128FV_READV_MAX_ENTRIES entries or if any range exceeds
+ *                              the existing W25Q128FV Flash Memory locations, in which case no data is read, or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_readv(W25Q128FV_read_entry_t *entries, uint8_t total_entries);
+
+/**@brief   Reads a range of the Flash Memory of the W25Q128FV Device, of any size, by handing it in chunks to a
+ *          callback, such that no RAM buffer as large as the range is required.
+ *
+ * @details A single Fast Read Instruction is sent for the whole range, during which the CS pin of the W25Q128FV Device is
+ *          kept low, and its data is received via DMA into two RAM buffers of
+ *          @ref W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES bytes that are used alternately. As soon as a chunk has been
+ *          received, the DMA transfer of the next one is started and only then \p callback is called with the former,
+ *          so that parsing, hashing or forwarding each chunk runs concurrently with the transfer of the next one.
+ * @note    The SPI given to @ref init_w25q128fv_module must have a DMA channel linked to its reception.
+ *
+ * @param address   W25Q128FV Device 24-bit Flash Memory Address from which it is desired to start reading data.
+ * @param size      Size in bytes to read from the W25Q128FV Device.
+ * @param callback  Function that will consume each chunk of the data read.
+ *
+ * @retval	W25Q128FV_EC_OK     if the whole range was successfully read and consumed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device or if a DMA transfer
+ *                              took longer than @ref W25Q128FV_SPI_TIMEOUT milliseconds.
+ * @retval  W25Q128FV_EC_ERR    if the range exceeds the existing W25Q128FV Flash Memory locations or if anything else
+ *                              went wrong.
+ * @retval  other               value returned by \p callback if it asked to stop reading.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_stream_read(uint32_t address, uint32_t size, W25Q128FV_stream_read_callback_t callback);
+
 /**@brief   Erases the data contained in a desired Flash Memory Sector of the W25Q128FV Flash Memory Device.
  *
  * @note    A Sector Erase stands for the minimum amount of erasable bytes in a W25Q128FV Device.
@@ -737,7 +858,145 @@ W25Q128FV_Status w25q128fv_fast_read_flash_memory(uint32_t start_page, uint8_t p
  * @date	April 10, 2024.
  */
 W25Q128FV_Status w25q128fv_erase_sector(uint32_t sector_number);
-// TODO: Pending to write a function for the "32KB Block Erase" and "64KB Block Erase"Instructions of a W25Q128FV Device, which should both have a very similar (almost identical) code with respect to the @ref w25q128fv_erase_sector function.
+
+/**@brief   Starts erasing a desired Flash Memory Sector of the W25Q128FV Flash Memory Device without waiting for the
+ *          W25Q128FV Device to finish erasing it.
+ *
+ * @details This function does the same as @ref w25q128fv_erase_sector , except that it will not make the 400ms Delay nor
+ *          send the Write Disable Instruction afterwards (the W25Q128FV Device clears its Write Enable Latch by itself
+ *          once the erase is finished). Instead, the implementer is expected to call
+ *          @ref w25q128fv_poll_background_erase from time to time until it reports that the Sector Erase has finished.
+ * @details While that Sector Erase is in progress, the read and write functions of the @ref w25q128fv will
+ *          automatically send the Erase/Program Suspend Instruction to the W25Q128FV Device before sending their own
+ *          Instructions, which takes about 1ms instead of having to wait up to 400ms. The suspended Sector Erase is then
+ *          resumed the next time that @ref w25q128fv_poll_background_erase is called. On the other hand, any other erase
+ *          function (including this one) and @ref w25q128fv_software_reset will first wait for that Sector Erase to
+ *          finish.
+ *
+ * @note    <b style="color:red">WARNING:</b> Only one Sector Erase can be in progress in the background at a time and
+ *          the data of the Sector being erased must not be read nor written until it has finished being erased.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device whose data wants to be erased. Note that this
+ *                          value may be any from 0 up to @ref W25Q128FV_TOTAL_SECTORS_MINUS_ONE .
+ *
+ * @retval	W25Q128FV_EC_OK     if the Write Enable and Sector Erase instructions were successfully sent to the
+ *                              W25Q128FV Device.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the value of the \p sector_number param corresponds to a non-existent Sector or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_start_erase_sector(uint32_t sector_number);
+
+/**@brief   Checks whether the Sector Erase that was started via @ref w25q128fv_start_erase_sector is still in
+ *          progress.
+ *
+ * @details If that Sector Erase was suspended by the @ref w25q128fv in order to send another Instruction, then this
+ *          function will resume it and report it as still in progress. Otherwise, the BUSY bit of the Status Register-1
+ *          of the W25Q128FV Device will be checked.
+ *
+ * @param[out] is_erase_in_progress Pointer to the Memory Location Address where this function will write a 1 if the
+ *                                  Sector Erase is still in progress or a 0 if otherwise (including the case in which
+ *                                  no Sector Erase was started at all).
+ *
+ * @retval	W25Q128FV_EC_OK     if the state of the Sector Erase was successfully obtained.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_poll_background_erase(uint8_t *is_erase_in_progress);
+
+/**@brief   Waits until the Sector Erase that was started via @ref w25q128fv_start_erase_sector , if any, is finished.
+ *
+ * @details This is what the other functions of the @ref w25q128fv do before sending an Instruction that cannot be sent
+ *          while that Sector Erase is merely suspended (e.g., another erase), which only takes as long as the W25Q128FV
+ *          Device actually needs rather than the worst case that @ref w25q128fv_erase_sector waits for.
+ * @details If that Sector Erase was suspended, then it will first be resumed. After that, the Status Register-1 of the
+ *          W25Q128FV Device will be polled every 1ms until its BUSY bit is cleared or until
+ *          @ref W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS milliseconds pass.
+ *
+ * @retval	W25Q128FV_EC_OK     if there is no Sector Erase in progress after calling this function.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device or if it remained busy
+ *                              for longer than @ref W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS milliseconds.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_wait_for_background_erase(void);
+
+/**@brief   Starts erasing a desired Flash Memory Sector of the W25Q128FV Flash Memory Device in the background, but only
+ *          if no other Sector Erase started via @ref w25q128fv_start_erase_sector is still in progress.
+ *
+ * @details This is meant for the bus-time bounded slices of work of other modules (e.g., a garbage collection slice),
+ *          which would otherwise wait inside of @ref w25q128fv_start_erase_sector for up to
+ *          @ref W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS milliseconds. Instead, such a slice should be concluded whenever
+ *          this function does not start the Sector Erase and be retried by the next slice.
+ * @details A slice should also be concluded right after this function does start the Sector Erase, since any other
+ *          read or write made by it would only suspend that Sector Erase again.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device whose data wants to be erased. Note that this
+ *                          value may be any from 0 up to @ref W25Q128FV_TOTAL_SECTORS_MINUS_ONE .
+ * @param[out] is_started   Pointer to the Memory Location Address where this function will write a 1 if the Sector
+ *                          Erase was started or a 0 if another one is still in progress.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector Erase was either started or left for later because another one is still
+ *                              in progress.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the value of the \p sector_number param corresponds to a non-existent Sector or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_try_start_erase_sector(uint32_t sector_number, uint8_t *is_started);
+
+/**@brief   Reads the Status Register-1 of the W25Q128FV Flash Memory Device.
+ *
+ * @note    The bit 0 (i.e., S0) of the Status Register-1 is the BUSY bit, which is set to 1 by the W25Q128FV Device
+ *          whenever it is executing a Page Program, Erase or Write Status Register Instruction.
+ *
+ * @param[out] status_register_1    Pointer to the Memory Location Address where it is desired to store the value of the
+ *                                  Status Register-1 of the W25Q128FV Device.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Status Register-1 was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_read_status_register_1(uint8_t *status_register_1);
+
+/**@brief   Erases the data contained in a desired 64KB Block of the W25Q128FV Flash Memory Device.
+ *
+ * @note    The size of a 64KB Block is 16 Sectors (i.e., 65536 bytes) in a W25Q128FV Device, and erasing one of them
+ *          takes much less time than erasing each of its 16 Sectors one by one.
+ *
+ * @details This function does the same as @ref w25q128fv_erase_sector , except that it sends the 64KB Block Erase
+ *          Instruction instead and that it makes a 2000ms Delay, as stated in the W25Q128FV datasheet, in order to give
+ *          sufficient time to the W25Q128FV Device to finish erasing the desired 64KB Block.
+ *
+ * @param block_number      64KB Block of the W25Q128FV Device whose data wants to be erased. Note that this value may
+ *                          be any from 0 up to @ref W25Q128FV_TOTAL_BLOCKS_64KB minus one, where the first Sector of
+ *                          the Block is \p block_number times @ref W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS .
+ *
+ * @retval	W25Q128FV_EC_OK     if the Write enable, 64KB Block Erase and Write Disable instructions were successfully
+ *                              sent to the W25Q128FV Device.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the value of the \p block_number param corresponds to a non-existent 64KB Block,
+ *                              if either the Write Enable or the Write Disable Instruction could not be successfully
+ *                              sent to the W25Q128FV Device or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_erase_block_64kb(uint32_t block_number);
+// TODO: Pending to write a function for the "32KB Block Erase" Instruction of a W25Q128FV Device, which should have a very similar (almost identical) code with respect to the @ref w25q128fv_erase_block_64kb function.
 
 /**@brief   Erases all the data contained in the W25Q128FV Flash Memory Device.
  *
@@ -844,6 +1103,29 @@ W25Q128FV_Status w25q128fv_chip_erase(void);
  */
 W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src);
 
+/**@brief   Sets the functions that the @ref w25q128fv will use to wait instead of busy-waiting.
+ *
+ * @param[in] os_hooks  Pointer to the W25Q128FV Driver Operating System hooks structure, which must remain valid while
+ *                      it is set, or \c NULL to go back to busy-waiting.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_set_os_hooks(const W25Q128FV_os_hooks_t *os_hooks);
+
+/**@brief   Waits for a given number of milliseconds via the delay hook that was set with @ref w25q128fv_set_os_hooks ,
+ *          if any, or otherwise via @ref HAL_Delay .
+ *
+ * @note    The modules built on top of the @ref w25q128fv wait through this function, so that they also let an RTOS run
+ *          other tasks meanwhile.
+ *
+ * @param delay_in_ms   Number of milliseconds to wait.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_delay(uint32_t delay_in_ms);
+
 /**@brief   Initializes the @ref w25q128fv in order to be able to use its provided functions.
  *
  * @details This function stores in the @ref p_hspi Global Static Pointer the address of the SPI Handle Structure of
@@ -859,6 +1141,9 @@ W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_
  *                          that should contain the required data of the Pin Peripherals at which the W25Q128FV Flash
  *                          Memory Device is expected to be connected at.
  *
+ * @note    If @ref W25Q128FV_HARDWARE_NSS is 1, then the CS field of \p peripherals is not used and the SPI given in
+ *          \p hspi is left disabled between Instructions.
+ *
  * @author	César Miranda Meza (cmirandameza3@hotmail.com)
  * @date	April 16, 2024.
  */
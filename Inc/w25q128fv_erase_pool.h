@@ -0,0 +1,161 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's erase-ahead pool of pre-erased Sectors Header file.
+ *
+ * @defgroup w25q128fv_erase_pool W25Q128FV Erase-Ahead Pool module
+ * @{
+ *
+ * @brief   This module provides a free Sector manager that keeps a configurable number of Sectors of the W25Q128FV Flash
+ *          Memory Device already erased, so that the writers of the application firmware do not have to wait for the
+ *          45ms-400ms that a Sector Erase takes whenever they need to start writing into a new Sector.
+ *
+ * @details The way that the @ref w25q128fv_erase_pool works is that the implementer designates to it, via the
+ *          @ref init_w25q128fv_erase_pool_module function, a region of consecutive Sectors of the W25Q128FV Device and
+ *          the desired depth of the pool (i.e., how many erased Sectors it should try to keep ready). Then, the
+ *          implementer must call @ref w25q128fv_erase_pool_refill whenever the application firmware is idle (e.g., from
+ *          the idle hook or once per main loop iteration). Each call will either check if the previously started
+ *          Sector Erase has finished or start erasing the next dirty Sector via @ref w25q128fv_start_erase_sector , but
+ *          it will never wait for a Sector Erase to finish.
+ * @details The writers get their Sectors via @ref w25q128fv_erase_pool_allocate_sector , which will only wait for a
+ *          Sector Erase whenever the pool is exhausted. Each of those cases is counted as a stall in the statistics of
+ *          this module (see @ref W25Q128FV_erase_pool_stats_t ) so that the implementer can tune the pool depth.
+ *          Sectors that are no longer needed are given back via @ref w25q128fv_erase_pool_release_sector .
+ *
+ * @note    The @ref w25q128fv_erase_pool keeps the state of each Sector only in RAM. Therefore, after a reset, the
+ *          implementer must register the Sectors that are still in use via
+ *          @ref w25q128fv_erase_pool_mark_sector_as_allocated . Every other Sector will be treated as dirty unless it
+ *          is registered via @ref w25q128fv_erase_pool_mark_sector_as_erased .
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_ERASE_POOL_H
+#define W25Q128FV_ERASE_POOL_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_ERASE_POOL_MAX_SECTORS
+#define W25Q128FV_ERASE_POOL_MAX_SECTORS    (256)   /**< @brief Maximum number of Sectors that can be managed by the @ref w25q128fv_erase_pool . @note Each managed Sector costs 3 bytes of RAM. */
+#endif
+
+/**@brief	W25Q128FV Erase-Ahead Pool Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_erase_pool .
+    uint32_t total_sectors; //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_erase_pool , which may be any from 1 up to @ref W25Q128FV_ERASE_POOL_MAX_SECTORS .
+    uint32_t target_depth;  //!< Number of erased Sectors that @ref w25q128fv_erase_pool_refill will try to keep ready in the pool.
+} W25Q128FV_erase_pool_def_t;
+
+/**@brief	W25Q128FV Erase-Ahead Pool statistics structure.
+ */
+typedef struct {
+    uint32_t pool_depth;            //!< Number of erased Sectors that are currently ready in the pool.
+    uint32_t min_pool_depth;        //!< Lowest value that @ref W25Q128FV_erase_pool_stats_t::pool_depth has had after an allocation.
+    uint32_t allocations;           //!< Number of Sectors handed out by @ref w25q128fv_erase_pool_allocate_sector .
+    uint32_t stalls;                //!< Number of allocations that had to wait for a Sector Erase because the pool was exhausted.
+    uint32_t background_erases;     //!< Number of Sector Erases completed by @ref w25q128fv_erase_pool_refill .
+} W25Q128FV_erase_pool_stats_t;
+
+/**@brief   Initializes the @ref w25q128fv_erase_pool in order to be able to use its provided functions.
+ *
+ * @note    The @ref w25q128fv must have been initialized before calling this function.
+ *
+ * @param[in] erase_pool_def    Pointer to the W25Q128FV Erase-Ahead Pool Definition parameters structure, whose
+ *                              contents will be copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_erase_pool was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region has no Sectors, more than @ref W25Q128FV_ERASE_POOL_MAX_SECTORS
+ *                              Sectors or if it exceeds the existing Sectors of the W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_erase_pool_module(W25Q128FV_erase_pool_def_t *erase_pool_def);
+
+/**@brief   Registers a Sector of the managed region as one that is still in use by the application firmware.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device that is in use.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully registered.
+ * @retval  W25Q128FV_EC_ERR    if the Sector is outside of the managed region or if it is being erased.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_erase_pool_mark_sector_as_allocated(uint32_t sector_number);
+
+/**@brief   Registers a Sector of the managed region as one that is known to be already erased.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device that is known to be erased.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully registered.
+ * @retval  W25Q128FV_EC_ERR    if the Sector is outside of the managed region or if it is not a dirty one.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_erase_pool_mark_sector_as_erased(uint32_t sector_number);
+
+/**@brief   Hands out an erased Sector of the managed region.
+ *
+ * @details If the pool has erased Sectors, then the one that has been waiting for the longest time is handed out
+ *          without any access to the W25Q128FV Device. Otherwise, this function will wait via
+ *          @ref w25q128fv_wait_for_background_erase for the Sector Erase that @ref w25q128fv_erase_pool_refill had
+ *          started or, if there was none, for one that it starts on a dirty Sector via
+ *          @ref w25q128fv_start_erase_sector , which will be counted as a stall. Thus, a stall only lasts for as long
+ *          as the W25Q128FV Device takes to erase a Sector, rather than for @ref W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS .
+ *
+ * @param[out] sector_number    Pointer to the Memory Location Address where this function will store the Flash Memory
+ *                              Sector of the W25Q128FV Device that has been handed out.
+ *
+ * @retval	W25Q128FV_EC_OK     if an erased Sector was successfully handed out.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if all the managed Sectors are allocated or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_erase_pool_allocate_sector(uint32_t *sector_number);
+
+/**@brief   Gives back to the @ref w25q128fv_erase_pool a Sector whose data is no longer needed.
+ *
+ * @details The Sector is marked as dirty so that @ref w25q128fv_erase_pool_refill erases it whenever the pool needs it.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device that is no longer needed.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully given back.
+ * @retval  W25Q128FV_EC_ERR    if the Sector is outside of the managed region or if it was not allocated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_erase_pool_release_sector(uint32_t sector_number);
+
+/**@brief   Makes one non-blocking step towards refilling the pool up to its target depth.
+ *
+ * @details If a Sector Erase started by a previous call is still in progress, then this function returns right away.
+ *          If it has finished, then that Sector is added to the pool. Finally, if the pool (counting the Sector being
+ *          erased) is below its target depth, then the erase of the next dirty Sector is started in the background.
+ *
+ * @retval	W25Q128FV_EC_OK     if the step was successfully made (including when there was nothing to do).
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_erase_pool_refill(void);
+
+/**@brief   Gets the current statistics of the @ref w25q128fv_erase_pool .
+ *
+ * @param[out] stats    Pointer to the Memory Location Address where this function will store the statistics.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_erase_pool_get_stats(W25Q128FV_erase_pool_stats_t *stats);
+
+#endif /* W25Q128FV_ERASE_POOL_H */
+
+/** @} */
@@ -0,0 +1,263 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's extent allocator Header file.
+ *
+ * @defgroup w25q128fv_extent W25Q128FV Extent Allocator module
+ * @{
+ *
+ * @brief   This module provides a Sector-granular allocator of variable sized blobs (e.g., firmware images, audio clips
+ *          or certificates) for the W25Q128FV Flash Memory Device, so that the implementer does not have to carve fixed
+ *          regions of the W25Q128FV Device by hand.
+ *
+ * @details The way that the @ref w25q128fv_extent works is that the implementer designates to it, via the
+ *          @ref init_w25q128fv_extent_module function, a region of consecutive Sectors of the W25Q128FV Device. The
+ *          first two Sectors of that region are reserved to persist two copies (i.e., A and B) of the allocation table,
+ *          while all the remaining Sectors are handed out as extents (i.e., runs of consecutive Sectors), each of them
+ *          identified by a blob ID chosen by the implementer.
+ * @details In RAM, the allocated Sectors are tracked with a bitmap, while the free space is tracked as free extents that
+ *          are indexed by two AVL trees: one ordered by length, which is used to find the best-fit free extent for an
+ *          allocation in O(log n), and one ordered by starting Sector, which is used to coalesce a freed extent with its
+ *          free neighbours in O(log n).
+ * @details The allocation table is only written into the W25Q128FV Device whenever @ref w25q128fv_extent_commit is
+ *          called, which always writes it into the copy that does not hold the latest committed table and with the
+ *          next generation number. Therefore, a power loss during a commit leaves the previous table intact. Mounting
+ *          via @ref w25q128fv_extent_mount only reads both copies of the allocation table and never the blobs
+ *          themselves.
+ *
+ * @details Since freeing blobs over time scatters the free space, the implementer may call
+ *          @ref w25q128fv_extent_defrag_run_slice periodically (e.g., once per main loop iteration) to relocate the
+ *          allocated extents towards the beginning of the managed region, such that the free Sectors coalesce into
+ *          whole 64KB Blocks at its end. Each call is bounded by a bus-time budget and the relocation of each extent is
+ *          power-fail safe: its data is first copied into free Sectors and only then the allocation table pointing to
+ *          the new location is written into the copy that does not hold the latest committed one.
+ *
+ * @note    The Sectors of a newly allocated extent may still contain the data of a previously freed blob. Therefore,
+ *          the implementer must call @ref w25q128fv_extent_erase before writing into them.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_EXTENT_H
+#define W25Q128FV_EXTENT_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_EXTENT_MAX_EXTENTS
+#define W25Q128FV_EXTENT_MAX_EXTENTS    (64)    /**< @brief Maximum number of blobs that can be allocated at the same time. @note This value may be any from 1 up to 340 so that the allocation table fits into a single Sector. */
+#endif
+#ifndef W25Q128FV_EXTENT_MAX_SECTORS
+#define W25Q128FV_EXTENT_MAX_SECTORS    (4096)  /**< @brief Maximum number of Sectors that can be managed by the @ref w25q128fv_extent , which costs one bit of RAM per Sector. */
+#endif
+#ifndef W25Q128FV_EXTENT_DEFRAG_PAGE_COPY_MAX_TIME_IN_MS
+#define W25Q128FV_EXTENT_DEFRAG_PAGE_COPY_MAX_TIME_IN_MS    (10)    /**< @brief Worst case time in milliseconds that it takes to read and write one page with the @ref w25q128fv (including a possible Erase Suspend). @details This is used by @ref w25q128fv_extent_defrag_run_slice to decide whether another unit of work still fits in its bus-time budget. */
+#endif
+#define W25Q128FV_EXTENT_TABLE_SECTORS  (2)     /**< @brief Number of Sectors, at the beginning of the managed region, that are reserved to persist the A and B copies of the allocation table. */
+
+/**@brief	W25Q128FV Extent Allocator Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_extent .
+    uint32_t total_sectors; //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_extent , including the @ref W25Q128FV_EXTENT_TABLE_SECTORS reserved ones.
+} W25Q128FV_extent_def_t;
+
+/**@brief	W25Q128FV extent structure.
+ *
+ * @details This contains all the fields that describe where a blob is located in the W25Q128FV Flash Memory Device.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t blob_id;       //!< ID with which the implementer identifies the blob.
+    uint16_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device that belongs to the blob.
+    uint16_t total_sectors; //!< Number of consecutive Flash Memory Sectors that belong to the blob.
+    uint32_t size;          //!< Size in bytes of the blob, as given at @ref w25q128fv_extent_allocate .
+} W25Q128FV_extent_t;
+
+/**@brief   Initializes the @ref w25q128fv_extent in order to be able to use its provided functions.
+ *
+ * @details After calling this function, the implementer must either call @ref w25q128fv_extent_mount to load the
+ *          allocation table that was committed before or @ref w25q128fv_extent_format to start with an empty one.
+ *
+ * @param[in] extent_def    Pointer to the W25Q128FV Extent Allocator Definition parameters structure, whose contents
+ *                          will be copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_extent was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region has no Sectors besides the reserved ones, more than
+ *                              @ref W25Q128FV_EXTENT_MAX_SECTORS Sectors or if it exceeds the existing Sectors of the
+ *                              W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_extent_module(W25Q128FV_extent_def_t *extent_def);
+
+/**@brief   Erases both copies of the allocation table and commits an empty one.
+ *
+ * @retval	W25Q128FV_EC_OK     if the empty allocation table was successfully committed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_format(void);
+
+/**@brief   Loads the latest valid allocation table from the W25Q128FV Flash Memory Device and rebuilds the RAM bitmap
+ *          and free extent trees from it.
+ *
+ * @retval	W25Q128FV_EC_OK     if a valid allocation table was successfully loaded.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if none of the two copies of the allocation table is valid (e.g., if the region was
+ *                              never formatted), in which case @ref w25q128fv_extent_format should be called.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_mount(void);
+
+/**@brief   Allocates the best-fit run of free consecutive Sectors for a blob.
+ *
+ * @details The allocation only modifies the RAM copy of the allocation table. It will persist after a reset only once
+ *          @ref w25q128fv_extent_commit is called.
+ *
+ * @param blob_id           ID with which the implementer wants to identify the blob, which must not be in use.
+ * @param size              Size in bytes of the blob, which must be greater than 0.
+ * @param[out] extent       Pointer to the Memory Location Address where this function will store the allocated extent.
+ *
+ * @retval	W25Q128FV_EC_OK     if the extent was successfully allocated.
+ * @retval  W25Q128FV_EC_ERR    if the \p blob_id is already in use, if the \p size is 0, if there is no free run of
+ *                              consecutive Sectors large enough or if @ref W25Q128FV_EXTENT_MAX_EXTENTS blobs are
+ *                              already allocated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_allocate(uint32_t blob_id, uint32_t size, W25Q128FV_extent_t *extent);
+
+/**@brief   Frees the extent of a blob and coalesces it with its free neighbours.
+ *
+ * @details The data of the blob is not erased and the change only persists after a reset once
+ *          @ref w25q128fv_extent_commit is called.
+ * @details If the extent was already committed, then its Sectors are only handed out again after the next successful
+ *          @ref w25q128fv_extent_commit , since until then the allocation table in the W25Q128FV Device still points
+ *          to them and a power loss would bring the blob back. Otherwise, they are freed right away.
+ *
+ * @param blob_id   ID of the blob to free.
+ *
+ * @retval	W25Q128FV_EC_OK     if the extent was successfully freed.
+ * @retval  W25Q128FV_EC_ERR    if there is no blob with the given \p blob_id .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_free(uint32_t blob_id);
+
+/**@brief   Gets the extent of a blob.
+ *
+ * @param blob_id       ID of the desired blob.
+ * @param[out] extent   Pointer to the Memory Location Address where this function will store the extent of the blob.
+ *
+ * @retval	W25Q128FV_EC_OK     if the blob was found.
+ * @retval  W25Q128FV_EC_NA     if there is no blob with the given \p blob_id .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_find(uint32_t blob_id, W25Q128FV_extent_t *extent);
+
+/**@brief   Erases all the Sectors of an extent so that the blob can be written into them.
+ *
+ * @details Every 64KB Block of the W25Q128FV Device that is fully covered by the extent is erased at once via
+ *          @ref w25q128fv_erase_block_64kb , while the remaining Sectors are erased one by one.
+ *
+ * @param[in] extent    Pointer to the extent to be erased.
+ *
+ * @retval	W25Q128FV_EC_OK     if all the Sectors of the extent were successfully erased.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_erase(W25Q128FV_extent_t *extent);
+
+/**@brief   Persists the RAM copy of the allocation table into the W25Q128FV Flash Memory Device.
+ *
+ * @details The allocation table is written, with the next generation number, into the copy (i.e., A or B) that does
+ *          not hold the latest committed one, which requires erasing that Sector first.
+ * @details If @ref w25q128fv_extent_defrag_run_slice has already copied all the data of the extent that it is
+ *          relocating, then this commit also persists the new location of that extent.
+ * @details Once the allocation table is written, the Sectors of the committed extents that were freed since the
+ *          previous commit become free.
+ *
+ * @retval	W25Q128FV_EC_OK     if the allocation table was successfully committed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_commit(void);
+
+/**@brief   Gets the number of free Sectors and the length of the largest run of free consecutive Sectors.
+ *
+ * @note    The Sectors of the committed extents that were freed after the latest commit are not counted as free until
+ *          the next commit.
+ *
+ * @param[out] free_sectors             Pointer to the Memory Location Address where this function will store the number
+ *                                      of free Sectors.
+ * @param[out] largest_free_extent      Pointer to the Memory Location Address where this function will store the length,
+ *                                      in Sectors, of the largest run of free consecutive Sectors.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_extent_get_free_space(uint32_t *free_sectors, uint32_t *largest_free_extent);
+
+/**@brief   Gets the number of 64KB Blocks of the W25Q128FV Device whose Sectors are all free data Sectors.
+ *
+ * @return  The number of fully free 64KB Blocks.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_extent_get_free_blocks_64kb(void);
+
+/**@brief   Runs one bus-time bounded slice of defragmentation.
+ *
+ * @details Each slice will first check whether the Sector Erase that a previous slice started is finished. Then, if
+ *          no extent is being relocated and more fully free 64KB Blocks can still be gained, the next extent to be
+ *          relocated is chosen and the free Sectors where it will be moved into are reserved. The relocation itself
+ *          goes through erasing those Sectors in the background (one per slice), copying the pages of the blob (as
+ *          many per slice as fit into the budget) and, finally, writing the allocation table with the new location,
+ *          after which the old location is freed. The pages are copied through a block of the @ref w25q128fv_mempool
+ *          or, if none is free, through a page buffer of the @ref w25q128fv_extent itself.
+ * @details Only Sectors that are also free in the committed allocation table are chosen as the new location of an
+ *          extent. Moreover, while there are allocations or frees that have not been committed yet, the allocation
+ *          table is not written by this function, since that would also persist them. Instead, the relocation of an
+ *          extent whose data has been fully copied is then concluded by the next @ref w25q128fv_extent_commit .
+ * @details Otherwise, at least one unit of work (i.e., one page copy, starting one Sector Erase or writing the
+ *          allocation table) is always made per slice so that the defragmentation always progresses, except that a
+ *          slice whose next unit of work is starting a Sector Erase concludes without it while a Sector Erase started
+ *          by anything else is still in progress (see @ref w25q128fv_try_start_erase_sector ).
+ *
+ * @note    The implementer must not write into the blob that is being relocated. Freeing it, however, is safe and
+ *          makes the defragmentation abandon its relocation.
+ *
+ * @param bus_time_budget_in_ms     Time budget in milliseconds that this slice may keep the SPI bus busy.
+ * @param[out] is_compacted         Pointer to the Memory Location Address where this function will write a 1 if there
+ *                                  is nothing left to defragment or a 0 if otherwise.
+ *
+ * @retval	W25Q128FV_EC_OK     if the slice was successfully executed (including when there was nothing to do).
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong, in which case the interrupted step will be retried by the
+ *                              next slice.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_extent_defrag_run_slice(uint32_t bus_time_budget_in_ms, uint8_t *is_compacted);
+
+#endif /* W25Q128FV_EXTENT_H */
+
+/** @} */
@@ -0,0 +1,164 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's persistent FIFO queue Header file.
+ *
+ * @defgroup w25q128fv_fifo W25Q128FV Persistent FIFO module
+ * @{
+ *
+ * @brief   This module provides a durable First-In First-Out queue of variable sized records (e.g., outbound messages of
+ *          a store-and-forward application) that is stored into a region of Sectors of the W25Q128FV Flash Memory
+ *          Device, where both the enqueue and the dequeue operations are O(1) and never rewrite any pointer into a fixed
+ *          location of the W25Q128FV Device.
+ *
+ * @details The way that the @ref w25q128fv_fifo works is that the implementer designates to it, via the
+ *          @ref init_w25q128fv_fifo_module function, a region of consecutive Sectors of the W25Q128FV Device, which are
+ *          used as a circular log. Each Sector starts with a Sector header that holds a sequence number, which is
+ *          incremented each time that the writer moves into the next Sector, and is followed by the records. Each
+ *          record has a small header with its length and a flags byte whose bits are only ever cleared (i.e., only
+ *          programmed, never erased): one bit marks the record as completely written and another one marks it as
+ *          consumed. In the same way, the Sector header has a flag that is cleared once all the records of that Sector
+ *          have been consumed.
+ * @details A Sector is reclaimed (i.e., erased) only once the writer needs it again and only if all of its records
+ *          have been consumed. Therefore, @ref w25q128fv_fifo_enqueue will only wait for a Sector Erase once every
+ *          Sector, while @ref w25q128fv_fifo_pop costs a single 1-byte Page Program.
+ * @details After a reset, @ref w25q128fv_fifo_mount recovers the tail Sector via a binary search over the sequence
+ *          numbers of the Sector headers and the head Sector via a binary search over their consumed flags, such that
+ *          only O(log n) Sector headers plus the record headers of those two Sectors are read.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_FIFO_H
+#define W25Q128FV_FIFO_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES  (12)    /**< @brief Size in bytes of the header at the beginning of each Sector of the @ref w25q128fv_fifo . */
+#define W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES  (4)     /**< @brief Size in bytes of the header that precedes each record of the @ref w25q128fv_fifo . */
+#define W25Q128FV_FIFO_MAX_RECORD_SIZE_IN_BYTES     (W25Q128FV_SECTOR_SIZE_IN_BYTES - W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES - W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES)  /**< @brief Maximum size in bytes of a single record, since records never span two Sectors. */
+
+/**@brief	W25Q128FV Persistent FIFO Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_fifo .
+    uint32_t total_sectors; //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_fifo , which must be at least 2.
+} W25Q128FV_fifo_def_t;
+
+/**@brief   Initializes the @ref w25q128fv_fifo in order to be able to use its provided functions.
+ *
+ * @details After calling this function, the implementer must either call @ref w25q128fv_fifo_mount to recover the
+ *          queue that was stored before or @ref w25q128fv_fifo_format to start with an empty one.
+ *
+ * @param[in] fifo_def  Pointer to the W25Q128FV Persistent FIFO Definition parameters structure, whose contents will be
+ *                      copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_fifo was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region has less than 2 Sectors or if it exceeds the existing Sectors of the
+ *                              W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_fifo_module(W25Q128FV_fifo_def_t *fifo_def);
+
+/**@brief   Erases all the Sectors of the managed region and starts an empty queue.
+ *
+ * @retval	W25Q128FV_EC_OK     if the empty queue was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_fifo_format(void);
+
+/**@brief   Recovers the head and the tail of the queue that is stored into the managed region.
+ *
+ * @details Records whose writing was interrupted by a power loss are detected because their written flag was never
+ *          cleared and they are skipped.
+ *
+ * @retval	W25Q128FV_EC_OK     if the queue was successfully recovered.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the managed region does not hold a queue (e.g., if it was never formatted), in which
+ *                              case @ref w25q128fv_fifo_format should be called.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_fifo_mount(void);
+
+/**@brief   Appends a record at the tail of the queue.
+ *
+ * @details The record header is written first, followed by the record data and, finally, the written flag of the
+ *          record header is cleared, such that a power loss at any point never leaves a partial record that looks
+ *          complete. If the record does not fit into the rest of the tail Sector, then the next Sector is erased and
+ *          becomes the tail Sector.
+ *
+ * @param[in] src   Pointer to the Memory Location Address where the data of the record is located at.
+ * @param size      Size in bytes of the record, which may be any from 1 up to
+ *                  @ref W25Q128FV_FIFO_MAX_RECORD_SIZE_IN_BYTES .
+ *
+ * @retval	W25Q128FV_EC_OK     if the record was successfully appended.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the \p size is invalid, if the queue is full (i.e., if the next Sector still holds
+ *                              records that have not been consumed) or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_fifo_enqueue(uint8_t *src, uint16_t size);
+
+/**@brief   Reads the record at the head of the queue without consuming it.
+ *
+ * @param[out] dst      Pointer to the Memory Location Address where this function will store the data of the record.
+ * @param max_size      Size in bytes of the buffer pointed by \p dst .
+ * @param[out] size     Pointer to the Memory Location Address where this function will store the size in bytes of the
+ *                      record.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the queue is empty.
+ * @retval  W25Q128FV_EC_ERR    if the record is larger than \p max_size or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_fifo_peek(uint8_t *dst, uint16_t max_size, uint16_t *size);
+
+/**@brief   Consumes the record at the head of the queue by clearing its consumed flag.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record was successfully consumed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the queue is empty.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_fifo_pop(void);
+
+/**@brief   Reads and consumes the record at the head of the queue.
+ *
+ * @details This is the same as calling @ref w25q128fv_fifo_peek and then @ref w25q128fv_fifo_pop . Implementers that
+ *          must not lose a record until it has been delivered should call those two functions separately instead.
+ *
+ * @param[out] dst      Pointer to the Memory Location Address where this function will store the data of the record.
+ * @param max_size      Size in bytes of the buffer pointed by \p dst .
+ * @param[out] size     Pointer to the Memory Location Address where this function will store the size in bytes of the
+ *                      record.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record was successfully read and consumed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the queue is empty.
+ * @retval  W25Q128FV_EC_ERR    if the record is larger than \p max_size or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_fifo_dequeue(uint8_t *dst, uint16_t max_size, uint16_t *size);
+
+#endif /* W25Q128FV_FIFO_H */
+
+/** @} */
@@ -0,0 +1,213 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's incremental Garbage Collector Header file.
+ *
+ * @defgroup w25q128fv_gc W25Q128FV Garbage Collector module
+ * @{
+ *
+ * @brief   This module provides an incremental Garbage Collector for log-structured data that is stored, page by page,
+ *          into a region of Sectors of the W25Q128FV Flash Memory Device via the @ref w25q128fv .
+ *
+ * @details The way that the @ref w25q128fv_gc works is that the implementer designates to it, via the
+ *          @ref init_w25q128fv_gc_module function, a region of consecutive Sectors of the W25Q128FV Device. Then, each
+ *          time that the implementer wants to append a page of data, it must ask the @ref w25q128fv_gc for the page
+ *          where it has to be written via @ref w25q128fv_gc_allocate_page , which will be taken from the Sector that
+ *          is currently open for writing (i.e., the write frontier). Whenever the data of a page stops being useful,
+ *          the implementer must tell it to the @ref w25q128fv_gc via @ref w25q128fv_gc_invalidate_page .
+ * @details The Garbage Collection itself is made by calling @ref w25q128fv_gc_run_slice periodically (e.g., once per
+ *          main loop iteration or from a low priority task). Each call will do only as much work as fits in the time
+ *          budget that was given at @ref init_w25q128fv_gc_module , where that work consists on copying the live pages
+ *          of a victim Sector, one page at a time, into the write frontier and then erasing that victim Sector once it
+ *          has no live pages left. The Sector Erase itself is started via @ref w25q128fv_try_start_erase_sector , such
+ *          that no slice ever waits for the 45ms-400ms that the W25Q128FV Device takes to erase a Sector. The victim
+ *          Sectors are chosen by the cost-benefit score of the LFS log-structured file system, which is
+ *          ((1-u) * age) / (1+u), where "u" is the fraction of live pages in the Sector and "age" is the number of
+ *          pages allocated since that Sector was last written.
+ * @details Because the live pages of a victim are moved into a different page, the implementer must provide a
+ *          relocation callback that updates the index of whatever log-structured layer is built on top of this module.
+ *
+ * @note    The @ref w25q128fv_gc keeps the liveness of each page only in RAM. Therefore, after a reset, the implementer
+ *          must call @ref init_w25q128fv_gc_module again and then register every page that is still referenced by its
+ *          index via @ref w25q128fv_gc_mark_page_as_live . Any Sector with no live pages will be treated as dirty and
+ *          will be erased by the Garbage Collector before using it, unless it is registered as already erased via
+ *          @ref w25q128fv_gc_mark_sector_as_erased .
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_GC_H
+#define W25Q128FV_GC_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_GC_MAX_SECTORS
+#define W25Q128FV_GC_MAX_SECTORS                (256)   /**< @brief Maximum number of Sectors that can be managed by the @ref w25q128fv_gc . @note Each managed Sector costs 7 bytes of RAM. */
+#endif
+#ifndef W25Q128FV_GC_MIN_FREE_SECTORS
+#define W25Q128FV_GC_MIN_FREE_SECTORS           (2)     /**< @brief Number of erased Sectors below which the @ref w25q128fv_gc starts relocating live pages out of victim Sectors. @details Victim Sectors without live pages are erased regardless of this value, since they cost no copies. */
+#endif
+#ifndef W25Q128FV_GC_PAGE_COPY_MAX_TIME_IN_MS
+#define W25Q128FV_GC_PAGE_COPY_MAX_TIME_IN_MS   (10)    /**< @brief Worst case time in milliseconds that it takes to read and write one page with the @ref w25q128fv (including a possible Erase Suspend). @details This is used by @ref w25q128fv_gc_run_slice to decide whether another page copy still fits in its time budget. */
+#endif
+#define W25Q128FV_GC_RESERVED_FREE_SECTORS      (1)     /**< @brief Number of erased Sectors that @ref w25q128fv_gc_allocate_page will never hand out so that the Garbage Collector can always relocate the live pages of a victim Sector. */
+
+/**@brief	W25Q128FV Garbage Collector relocation callback.
+ *
+ * @details This function is called by the @ref w25q128fv_gc each time that it has copied the data of a live page into a
+ *          different page, so that the implementer can update the index of its log-structured layer.
+ *
+ * @param old_page  Flash Memory Page of the W25Q128FV Device where the data used to be.
+ * @param new_page  Flash Memory Page of the W25Q128FV Device where the data is now.
+ */
+typedef void (*W25Q128FV_gc_relocation_callback_t)(uint32_t old_page, uint32_t new_page);
+
+/**@brief	W25Q128FV Garbage Collector Definition parameters structure.
+ *
+ * @details This contains all the fields required to designate to the @ref w25q128fv_gc the region of the W25Q128FV
+ *          Flash Memory that it will manage and how much time each Garbage Collection slice is allowed to take.
+ */
+typedef struct {
+    uint32_t first_sector;                                      //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_gc .
+    uint32_t total_sectors;                                     //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_gc , which may be any from 2 up to @ref W25Q128FV_GC_MAX_SECTORS .
+    uint32_t slice_time_budget_in_ms;                           //!< Time budget in milliseconds of each call to @ref w25q128fv_gc_run_slice .
+    W25Q128FV_gc_relocation_callback_t relocation_callback;    //!< Function that will be called each time that a live page is relocated.
+} W25Q128FV_gc_def_t;
+
+/**@brief	W25Q128FV Garbage Collector statistics structure.
+ */
+typedef struct {
+    uint32_t free_sectors;              //!< Number of erased Sectors that are currently ready to become the write frontier.
+    uint32_t relocated_pages;           //!< Number of live pages that have been copied out of victim Sectors.
+    uint32_t erased_sectors;            //!< Number of victim Sectors that have been erased.
+    uint32_t max_slice_time_in_ms;      //!< Longest time in milliseconds that a single call to @ref w25q128fv_gc_run_slice has taken.
+} W25Q128FV_gc_stats_t;
+
+/**@brief   Initializes the @ref w25q128fv_gc in order to be able to use its provided functions.
+ *
+ * @details All the Sectors of the designated region will be treated as dirty Sectors without live pages, meaning that
+ *          they will be erased by the Garbage Collector before being used, unless the implementer registers them
+ *          otherwise via @ref w25q128fv_gc_mark_page_as_live or @ref w25q128fv_gc_mark_sector_as_erased .
+ *
+ * @note    The @ref w25q128fv must have been initialized before calling this function.
+ *
+ * @param[in] gc_def    Pointer to the W25Q128FV Garbage Collector Definition parameters structure, whose contents will
+ *                      be copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_gc was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region has less than 2 Sectors, more than @ref W25Q128FV_GC_MAX_SECTORS
+ *                              Sectors, exceeds the existing Sectors of the W25Q128FV Device or if no relocation
+ *                              callback was given.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_gc_module(W25Q128FV_gc_def_t *gc_def);
+
+/**@brief   Registers a page of the managed region as one that holds live data.
+ *
+ * @details This is meant to be called right after @ref init_w25q128fv_gc_module for every page that the index of the
+ *          log-structured layer still references after a reset. The Sector that contains the given page will be
+ *          considered as full (i.e., it will not be written again until it is erased).
+ *
+ * @param page              Flash Memory Page of the W25Q128FV Device that holds live data.
+ * @param page_write_sequence Sequence number (i.e., the relative age) with which the log-structured layer wrote that page.
+ *                          If the log-structured layer does not keep one, then 0 may be given.
+ *
+ * @retval	W25Q128FV_EC_OK     if the page was successfully registered.
+ * @retval  W25Q128FV_EC_ERR    if the page is outside of the managed region.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_gc_mark_page_as_live(uint32_t page, uint32_t page_write_sequence);
+
+/**@brief   Registers a Sector of the managed region as one that is known to be already erased.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device that is known to be erased.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully registered.
+ * @retval  W25Q128FV_EC_ERR    if the Sector is outside of the managed region or if it has live pages registered.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_gc_mark_sector_as_erased(uint32_t sector_number);
+
+/**@brief   Gets the next erased page of the write frontier so that the implementer can write a page of data into it.
+ *
+ * @details The obtained page is registered as live immediately. Therefore, the implementer is expected to write its
+ *          data into it via @ref w25q128fv_write_flash_memory right after calling this function.
+ *
+ * @param[out] page     Pointer to the Memory Location Address where this function will store the Flash Memory Page of
+ *                      the W25Q128FV Device that has been allocated.
+ *
+ * @retval	W25Q128FV_EC_OK     if a page was successfully allocated.
+ * @retval  W25Q128FV_EC_ERR    if there are no erased pages left outside of the ones reserved for the Garbage
+ *                              Collector (see @ref W25Q128FV_GC_RESERVED_FREE_SECTORS ), in which case
+ *                              @ref w25q128fv_gc_run_slice must be called until space is reclaimed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_gc_allocate_page(uint32_t *page);
+
+/**@brief   Tells the @ref w25q128fv_gc that the data of a page is no longer useful.
+ *
+ * @param page  Flash Memory Page of the W25Q128FV Device whose data is no longer useful.
+ *
+ * @retval	W25Q128FV_EC_OK     if the page was successfully invalidated.
+ * @retval  W25Q128FV_EC_ERR    if the page is outside of the managed region.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_gc_invalidate_page(uint32_t page);
+
+/**@brief   Runs one time-bounded slice of Garbage Collection.
+ *
+ * @details Each slice will first check whether the Sector Erase that a previous slice started is finished. Then, it
+ *          will copy the live pages of the current victim Sector into the write frontier, one page at a time, for as
+ *          long as another page copy fits into the time budget of the slice. Finally, once the victim Sector has no live
+ *          pages left, the erase of that Sector will be started in the background and the slice will conclude.
+ * @details Each page copy passes through a block of the @ref w25q128fv_mempool or, whenever the pool is exhausted,
+ *          through a page buffer that the @ref w25q128fv_gc keeps for that purpose, so that the relocations never
+ *          depend on how many blocks other tasks are holding.
+ * @details At least one unit of work (i.e., one page copy or starting one Sector Erase) is always made per slice so
+ *          that the Garbage Collector keeps progressing even with very small time budgets. The only exception is that
+ *          a slice concludes without starting the erase of the victim Sector while a Sector Erase that was started via
+ *          @ref w25q128fv_start_erase_sector by anything else is still in progress, since starting it would wait for
+ *          up to @ref W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS milliseconds (see @ref w25q128fv_try_start_erase_sector ).
+ *          Therefore, the pause that a slice can cause is bounded by the value returned by
+ *          @ref w25q128fv_gc_get_guaranteed_pause_in_ms .
+ *
+ * @retval	W25Q128FV_EC_OK     if the slice was successfully executed (including when there was nothing to do).
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_gc_run_slice(void);
+
+/**@brief   Gets the maximum time in milliseconds that a call to @ref w25q128fv_gc_run_slice is guaranteed to take.
+ *
+ * @return  The largest value between the time budget of the slices and @ref W25Q128FV_GC_PAGE_COPY_MAX_TIME_IN_MS .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_gc_get_guaranteed_pause_in_ms(void);
+
+/**@brief   Gets the current statistics of the @ref w25q128fv_gc .
+ *
+ * @param[out] stats    Pointer to the Memory Location Address where this function will store the statistics.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_gc_get_stats(W25Q128FV_gc_stats_t *stats);
+
+#endif /* W25Q128FV_GC_H */
+
+/** @} */
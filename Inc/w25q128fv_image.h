@@ -0,0 +1,167 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's firmware image staging Header file.
+ *
+ * @defgroup w25q128fv_image W25Q128FV Image Staging module
+ * @{
+ *
+ * @brief   This module stages an image (e.g., a firmware update received over the air) into a region of the W25Q128FV
+ *          Flash Memory Device, verifies it against a SHA-256 digest and only then marks it as installable, such that a
+ *          bootloader never installs an image that was not completely and correctly stored.
+ *
+ * @details The way that the @ref w25q128fv_image works is that the first Sector of the managed region holds the header
+ *          of the installable image, if any, whereas the image itself is stored from the second Sector onwards. The
+ *          implementer stages an image as follows:
+ *          <ol>
+ *              <li>
+ *                  @ref w25q128fv_image_begin erases the header, so that any previously installable image stops being
+ *                  so, and starts writing the image through a @ref w25q128fv_writer .
+ *              </li>
+ *              <li>
+ *                  @ref w25q128fv_image_write is called for each chunk of the image as it arrives. Each chunk is fed
+ *                  into a SHA-256 calculation as soon as it is written, so that the digest of the image is obtained
+ *                  without reading it back from the W25Q128FV Device.
+ *              </li>
+ *              <li>
+ *                  @ref w25q128fv_image_end finishes that digest and, if the expected digest is known (e.g., from a
+ *                  signed manifest), compares both.
+ *              </li>
+ *              <li>
+ *                  @ref w25q128fv_image_verify reads the whole image back via @ref w25q128fv_stream_read , such that
+ *                  each chunk is hashed while the next one is being received via DMA, and compares the resulting
+ *                  digest with the one obtained while writing, which detects any data that was not correctly stored.
+ *              </li>
+ *              <li>
+ *                  @ref w25q128fv_image_install , which fails unless the previous step succeeded, writes the header
+ *                  with the size and the digest of the image, where its magic number is written last.
+ *              </li>
+ *          </ol>
+ * @details The bootloader gets the installable image, if any, via @ref w25q128fv_image_get_installed .
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_IMAGE_H
+#define W25Q128FV_IMAGE_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include "w25q128fv_sha256.h" // This custom Mortrack's library contains the functions, definitions and variables of the W25Q128FV SHA-256 module.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+/**@brief	W25Q128FV Image Staging Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_image .
+    uint32_t total_sectors; //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_image , which must be at least 2 and of which all but the first one hold the image.
+} W25Q128FV_image_def_t;
+
+/**@brief	Installable image information structure.
+ */
+typedef struct {
+    uint32_t address;                                       //!< W25Q128FV Device 24-bit Flash Memory Address at which the image starts.
+    uint32_t size_in_bytes;                                 //!< Size in bytes of the image.
+    uint8_t digest[W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES];  //!< SHA-256 digest of the image.
+} W25Q128FV_image_info_t;
+
+/**@brief   Initializes the @ref w25q128fv_image in order to be able to use its provided functions.
+ *
+ * @param[in] image_def Pointer to the W25Q128FV Image Staging Definition parameters structure, whose contents will be
+ *                      copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_image was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region has less than 2 Sectors or if it exceeds the existing Sectors of the
+ *                              W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_image_module(W25Q128FV_image_def_t *image_def);
+
+/**@brief   Starts staging a new image, which also makes the previously installable image, if any, not installable.
+ *
+ * @retval	W25Q128FV_EC_OK     if the staging was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_image_begin(void);
+
+/**@brief   Writes the next chunk of the image being staged and hashes it.
+ *
+ * @param[in] data  Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK     if the chunk was successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if no image is being staged, if the chunk does not fit into the managed region or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_image_write(uint8_t *data, uint32_t size);
+
+/**@brief   Finishes writing the image being staged and, optionally, checks its digest.
+ *
+ * @param[in] expected_digest   Pointer to the Memory Location Address where the
+ *                              @ref W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES bytes of the SHA-256 digest that the image
+ *                              must have are located at, or \c NULL if it is unknown.
+ *
+ * @retval	W25Q128FV_EC_OK     if the image was successfully written and, if given, its digest matches
+ *                              \p expected_digest .
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if no image is being staged, if the digest of the image does not match
+ *                              \p expected_digest , in which case the image is discarded, or if anything else went
+ *                              wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_image_end(const uint8_t *expected_digest);
+
+/**@brief   Reads back the whole image that was staged and checks that its digest matches the one obtained while
+ *          writing it.
+ *
+ * @retval	W25Q128FV_EC_OK     if the image was successfully verified.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if @ref w25q128fv_image_end was not successfully called for the image, if the data read
+ *                              back does not match the data that was written, in which case the image is discarded,
+ *                              or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_image_verify(void);
+
+/**@brief   Marks the staged image as installable by writing its header.
+ *
+ * @retval	W25Q128FV_EC_OK     if the image was successfully marked as installable.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the image was not successfully verified via @ref w25q128fv_image_verify or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_image_install(void);
+
+/**@brief   Gets the information of the installable image, if any.
+ *
+ * @param[out] info Pointer to the Memory Location Address where this function will store the information of the
+ *                  installable image.
+ *
+ * @retval	W25Q128FV_EC_OK     if there is an installable image.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if there is no installable image.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_image_get_installed(W25Q128FV_image_info_t *info);
+
+#endif /* W25Q128FV_IMAGE_H */
+
+/** @} */
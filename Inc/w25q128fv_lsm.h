@@ -0,0 +1,215 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's log-structured merge store of sorted runs Header file.
+ *
+ * @defgroup w25q128fv_lsm W25Q128FV LSM Sorted Runs module
+ * @{
+ *
+ * @brief   This module provides a store of 32-bit keys, each of them with a 32-bit value, for write-heavy keyed data,
+ *          which follows the write pattern of a Log-Structured Merge tree such that the W25Q128FV Flash Memory Device is
+ *          only ever written with full Page bursts into freshly erased Sectors.
+ *
+ * @details The way that the @ref w25q128fv_lsm works is that @ref w25q128fv_lsm_put inserts into a sorted RAM table
+ *          (i.e., the memtable) of @ref W25Q128FV_LSM_MEMTABLE_ENTRIES entries. Once it is full, or whenever
+ *          @ref w25q128fv_lsm_flush is called, the memtable is written into free Sectors of the managed region as an
+ *          immutable sorted run (i.e., an SSTable), which consists of:
+ *          - a header Page with the sequence number of the run and its key range, which is written last;
+ *          - the data Pages, each one holding 32 key/value pairs in ascending order of key;
+ *          - the sparse index Pages, which hold the first key of each data Page;
+ *          - the Bloom filter Pages of the keys of the run.
+ * @details The Bloom filters (see @ref w25q128fv_bloom ), which are sized for a false positive rate of
+ *          @ref W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM , and the first key of each sparse index Page are cached in RAM,
+ *          such that a lookup skips any run that cannot hold the key without accessing the SPI bus and otherwise costs
+ *          one sparse index Page read plus one data Page read. Therefore, most lookups of missing keys never touch the
+ *          SPI bus. Lookups check the memtable first and then the runs from the newest to the oldest.
+ * @details Since lookups get slower with each run, the implementer should call @ref w25q128fv_lsm_compact_run_slice
+ *          periodically (e.g., once per main loop iteration). Whenever there are more than
+ *          @ref W25Q128FV_LSM_MERGE_TRIGGER_RUNS runs, it incrementally merges the two adjacent (in age) runs with the
+ *          fewest entries into a new run, erasing its Sectors in the background and writing one Page per unit of work,
+ *          such that lookups keep checking at most a handful of runs. The merged run covers the sequence numbers of
+ *          both of its inputs, which is how @ref w25q128fv_lsm_mount recognizes that they are obsolete if a power loss
+ *          happened before they were released.
+ * @details Deleting a key writes a tombstone, which is only dropped when it is merged into the oldest run.
+ *
+ * @note    The memtable is volatile, so the implementer must call @ref w25q128fv_lsm_flush before a controlled power
+ *          down and whenever the entries that have been put so far must survive a power loss.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_LSM_H
+#define W25Q128FV_LSM_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include "w25q128fv_bloom.h" // This custom Mortrack's library contains the blocked Bloom filters that are stored alongside each sorted run.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_LSM_MEMTABLE_ENTRIES
+#define W25Q128FV_LSM_MEMTABLE_ENTRIES          (128)   /**< @brief Number of key/value pairs that the memtable can hold before it has to be flushed. */
+#endif
+#ifndef W25Q128FV_LSM_MAX_RUNS
+#define W25Q128FV_LSM_MAX_RUNS                  (8)     /**< @brief Maximum number of sorted runs that the managed region can hold. */
+#endif
+#ifndef W25Q128FV_LSM_MERGE_TRIGGER_RUNS
+#define W25Q128FV_LSM_MERGE_TRIGGER_RUNS        (4)     /**< @brief Number of sorted runs above which @ref w25q128fv_lsm_compact_run_slice merges them. */
+#endif
+#ifndef W25Q128FV_LSM_MAX_RUN_ENTRIES
+#define W25Q128FV_LSM_MAX_RUN_ENTRIES           (4096)  /**< @brief Maximum number of key/value pairs of a single sorted run, which bounds the runs that are merged. */
+#endif
+#ifndef W25Q128FV_LSM_MAX_SECTORS
+#define W25Q128FV_LSM_MAX_SECTORS               (1024)  /**< @brief Maximum number of Sectors that the managed region may have. */
+#endif
+#ifndef W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM
+#define W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM  (10000) /**< @brief False positive rate target, in parts per million, from which the Bloom filter of each sorted run is sized (see @ref w25q128fv_bloom ). */
+#endif
+#ifndef W25Q128FV_LSM_BLOOM_POOL_SIZE_IN_BYTES
+#define W25Q128FV_LSM_BLOOM_POOL_SIZE_IN_BYTES  (4096)  /**< @brief Size in bytes of the RAM pool that caches the Bloom filters of all the sorted runs. @details Runs whose Bloom filter does not fit into it, including the runs merged while it is full, still store it on flash but are looked up without it until @ref w25q128fv_lsm_compact_run_slice finds room to cache it. */
+#endif
+#define W25Q128FV_LSM_MERGE_UNIT_MAX_TIME_IN_MS (10)    /**< @brief Worst case time in milliseconds of a unit of work of a merge (i.e., up to two Page reads plus one Page write with the @ref w25q128fv , including a possible Erase Suspend). @details This is used by @ref w25q128fv_lsm_compact_run_slice to decide whether another unit of work still fits in its bus-time budget. */
+#define W25Q128FV_LSM_TOMBSTONE                 (0xFFFFFFFF)    /**< @brief Value that marks a deleted key, which therefore cannot be stored as the value of a key. */
+
+/**@brief	W25Q128FV LSM Sorted Runs Definition parameters structure.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device managed by the @ref w25q128fv_lsm .
+    uint32_t total_sectors; //!< Number of consecutive Flash Memory Sectors managed by the @ref w25q128fv_lsm , which may be up to @ref W25Q128FV_LSM_MAX_SECTORS .
+} W25Q128FV_lsm_def_t;
+
+/**@brief   Initializes the @ref w25q128fv_lsm in order to be able to use its provided functions.
+ *
+ * @details After calling this function, the implementer must either call @ref w25q128fv_lsm_mount to recover the runs
+ *          that were stored before or @ref w25q128fv_lsm_format to start with an empty store.
+ *
+ * @param[in] lsm_def   Pointer to the W25Q128FV LSM Sorted Runs Definition parameters structure, whose contents will be
+ *                      copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_lsm was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the given region is empty, if it has more than @ref W25Q128FV_LSM_MAX_SECTORS or if it
+ *                              exceeds the existing Sectors of the W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_lsm_module(W25Q128FV_lsm_def_t *lsm_def);
+
+/**@brief   Erases all the Sectors of the managed region and starts an empty store.
+ *
+ * @retval	W25Q128FV_EC_OK     if the empty store was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_format(void);
+
+/**@brief   Recovers the sorted runs that are stored into the managed region and loads their Bloom filters and sparse
+ *          indexes into RAM.
+ *
+ * @details This reads the first bytes of every Sector of the managed region, discards the runs whose sequence numbers
+ *          are covered by a merged run (invalidating their headers, which a power loss may have left behind the merge)
+ *          and abandons any merge that was in progress. The memtable is left empty.
+ *
+ * @retval	W25Q128FV_EC_OK     if the store was successfully recovered.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the managed region holds more than @ref W25Q128FV_LSM_MAX_RUNS runs or if anything
+ *                              else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_mount(void);
+
+/**@brief   Inserts a key into the memtable or replaces its value, flushing the memtable first if it is full.
+ *
+ * @param key       Key to be inserted.
+ * @param value     Value of the \p key , which must not be @ref W25Q128FV_LSM_TOMBSTONE .
+ *
+ * @retval	W25Q128FV_EC_OK     if the key was successfully inserted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the store is not mounted, if the \p value is invalid, if the memtable had to be
+ *                              flushed but that failed (see @ref w25q128fv_lsm_flush ) or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_put(uint32_t key, uint32_t value);
+
+/**@brief   Deletes a key by inserting a tombstone for it into the memtable.
+ *
+ * @param key   Key to be deleted.
+ *
+ * @retval	W25Q128FV_EC_OK     if the tombstone was successfully inserted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the store is not mounted, if the memtable had to be flushed but that failed or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_delete(uint32_t key);
+
+/**@brief   Gets the latest value of a key.
+ *
+ * @param key           Key to be searched for.
+ * @param[out] value    Pointer to the Memory Location Address where this function will store the value of the \p key .
+ *
+ * @retval	W25Q128FV_EC_OK     if the key was found.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the key does not exist or if it was deleted.
+ * @retval  W25Q128FV_EC_ERR    if the store is not mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_get(uint32_t key, uint32_t *value);
+
+/**@brief   Writes the memtable into free Sectors of the managed region as a new sorted run and empties it.
+ *
+ * @details This erases the Sectors of the new run and waits for each of those Sector Erases. Nothing is written if the
+ *          memtable is empty.
+ *
+ * @retval	W25Q128FV_EC_OK     if the memtable was successfully flushed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the store is not mounted, if there are already @ref W25Q128FV_LSM_MAX_RUNS runs, if
+ *                              there are not enough consecutive free Sectors (in both of which cases
+ *                              @ref w25q128fv_lsm_compact_run_slice has to make room first) or if anything else went
+ *                              wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_flush(void);
+
+/**@brief   Runs one bus-time bounded slice of merge compaction.
+ *
+ * @details Each slice will first check whether the Sector Erase that a previous slice started is finished. Then, if no
+ *          merge is in progress, the Bloom filters of the runs that did not fit into the RAM pool before are cached, one
+ *          per unit of work, if they fit now. Otherwise, if there are more than @ref W25Q128FV_LSM_MERGE_TRIGGER_RUNS runs, the two adjacent
+ *          runs with the fewest entries, whose merge would not exceed @ref W25Q128FV_LSM_MAX_RUN_ENTRIES , are chosen
+ *          and the free Sectors of the merged run are reserved. The merge itself goes through erasing those Sectors in
+ *          the background (one per slice), writing the merged data Pages, the sparse index Pages and the Bloom filter
+ *          Pages (as many per slice as fit into the budget, a Bloom filter that does not fit into the RAM pool being
+ *          built one Page at a time by reading back every merged data Page) and, finally, the header of the merged run, after which the
+ *          Sectors of both input runs are released.
+ * @details At least one unit of work is always made per slice so that the merge always progresses, unless the next one
+ *          is starting a Sector Erase while another Sector Erase is still in progress, in which case the slice concludes
+ *          and leaves it for a later one (see @ref w25q128fv_try_start_erase_sector ).
+ *
+ * @param bus_time_budget_in_ms     Time budget in milliseconds that this slice may keep the SPI bus busy.
+ * @param[out] is_compacted         Pointer to the Memory Location Address where this function will write a 1 if there
+ *                                  is nothing left to merge or to cache or a 0 if otherwise.
+ *
+ * @retval	W25Q128FV_EC_OK     if the slice was successfully executed (including when there was nothing to do).
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the store is not mounted or if anything else went wrong, in which case the
+ *                              interrupted step will be retried by the next slice.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_lsm_compact_run_slice(uint32_t bus_time_budget_in_ms, uint8_t *is_compacted);
+
+#endif /* W25Q128FV_LSM_H */
+
+/** @} */
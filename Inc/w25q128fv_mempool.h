@@ -0,0 +1,99 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's fixed-block memory pool Header file.
+ *
+ * @defgroup w25q128fv_mempool W25Q128FV Memory Pool module
+ * @{
+ *
+ * @brief   This module provides, without the need of malloc, the transient RAM buffers of up to a Page that are only
+ *          held during a single call, namely the Page Program Instructions and the DMA bounce buffers of the
+ *          @ref w25q128fv and the Page copies of the @ref w25q128fv_gc and of the @ref w25q128fv_extent , as well as
+ *          the buffers that the implementer hands over to them (e.g., the data of the requests of a
+ *          @ref W25Q128FV_ring_t ).
+ *
+ * @details The buffers that hold state from one call to the next or that are larger than a block (e.g., the RAM image
+ *          of the @ref w25q128fv_config , the staging Page of each @ref W25Q128FV_writer_t , the lookup and merge
+ *          buffers of the @ref w25q128fv_lsm , the decompression block of the @ref w25q128fv_assets and the patch
+ *          buffers of the @ref w25q128fv_slots ) are not taken from the pool but owned by their modules, so that those
+ *          never fail just because the pool is exhausted. Likewise, the @ref w25q128fv , the @ref w25q128fv_gc and the
+ *          @ref w25q128fv_extent fall back to a buffer of their own whenever the pool is exhausted.
+ * @details The pool is a static arena of @ref W25Q128FV_MEMPOOL_TOTAL_BLOCKS blocks of
+ *          @ref W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES bytes each, where every block is aligned to
+ *          @ref W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES bytes so that it can be used by the DMA and so that it never
+ *          shares a cache line with other data. The free blocks are linked through their own first bytes, so that both
+ *          @ref w25q128fv_mempool_alloc and @ref w25q128fv_mempool_free take constant time, and the blocks that have
+ *          never been allocated are handed out in order, so that the pool needs no initialization.
+ * @details Both @ref w25q128fv_mempool_alloc and @ref w25q128fv_mempool_free may be called from interrupts, since they
+ *          only touch the pool within a very short critical section (see @ref W25Q128FV_MEMPOOL_ENTER_CRITICAL ).
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_MEMPOOL_H
+#define W25Q128FV_MEMPOOL_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES        (32)    /**< @brief Alignment in bytes of each block, which is the size of a cache line of the Cortex-M7. */
+#ifndef W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES
+#define W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES       (W25Q128FV_PAGE_SIZE_IN_BYTES + W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES)   /**< @brief Size in bytes of each block, which must be a multiple of @ref W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES and which by default holds a whole Page plus the Instruction that precedes it. */
+#endif
+#ifndef W25Q128FV_MEMPOOL_TOTAL_BLOCKS
+#define W25Q128FV_MEMPOOL_TOTAL_BLOCKS              (4)     /**< @brief Number of blocks of the pool, which should be at least the number of tasks and interrupts that may hold a block at the same time. */
+#endif
+#ifndef W25Q128FV_MEMPOOL_ENTER_CRITICAL
+#define W25Q128FV_MEMPOOL_ENTER_CRITICAL()          uint32_t mempool_primask = __get_PRIMASK(); __disable_irq()    /**< @brief Starts the critical section that guards the pool, which by default masks the interrupts. */
+#endif
+#ifndef W25Q128FV_MEMPOOL_EXIT_CRITICAL
+#define W25Q128FV_MEMPOOL_EXIT_CRITICAL()           __set_PRIMASK(mempool_primask)                                  /**< @brief Ends the critical section that was started via @ref W25Q128FV_MEMPOOL_ENTER_CRITICAL . */
+#endif
+
+#if (W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES % W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES) != 0
+#error "W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES must be a multiple of W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES."
+#endif
+#if W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES < (W25Q128FV_PAGE_SIZE_IN_BYTES + 4)
+#error "W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES must hold a whole Page plus a 4-byte Instruction."
+#endif
+
+/**@brief	W25Q128FV Memory Pool statistics structure.
+ */
+typedef struct {
+    uint32_t used_blocks;           //!< Number of blocks that are currently allocated.
+    uint32_t high_water_blocks;     //!< Highest value that @ref W25Q128FV_mempool_stats_t::used_blocks has ever had.
+    uint32_t allocations;           //!< Number of blocks handed out by @ref w25q128fv_mempool_alloc .
+    uint32_t failed_allocations;    //!< Number of calls to @ref w25q128fv_mempool_alloc that found the pool exhausted.
+} W25Q128FV_mempool_stats_t;
+
+/**@brief   Takes a free block from the pool.
+ *
+ * @return  The Memory Location Address of the block, which has @ref W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES bytes of
+ *          undefined contents, or \c NULL if all the blocks are allocated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void *w25q128fv_mempool_alloc(void);
+
+/**@brief   Gives a block back to the pool.
+ *
+ * @param[in] block Memory Location Address of a block that was returned by @ref w25q128fv_mempool_alloc and that has
+ *                  not been freed since, or \c NULL in which case this function does nothing.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_mempool_free(void *block);
+
+/**@brief   Gets the current statistics of the @ref w25q128fv_mempool .
+ *
+ * @param[out] stats    Pointer to the Memory Location Address where this function will store the statistics.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_mempool_get_stats(W25Q128FV_mempool_stats_t *stats);
+
+#endif /* W25Q128FV_MEMPOOL_H */
+
+/** @} */
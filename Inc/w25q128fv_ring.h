@@ -0,0 +1,136 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's lock-free single-producer/single-consumer request ring Header file.
+ *
+ * @defgroup w25q128fv_ring W25Q128FV Request Ring module
+ * @{
+ *
+ * @brief   This module lets an interrupt (e.g., of an ADC or of a communications peripheral) hand reads and writes of
+ *          the W25Q128FV Flash Memory Device off to the code that owns the @ref w25q128fv (e.g., the worker task of the
+ *          @ref w25q128fv_rtos or the main loop), without taking any lock and without ever blocking.
+ *
+ * @details Each @ref W25Q128FV_ring_t is a ring of @ref W25Q128FV_RING_SIZE request descriptors that has exactly one
+ *          producer, which calls @ref w25q128fv_ring_push , and exactly one consumer, which calls
+ *          @ref w25q128fv_ring_drain . The producer only writes the head index and the consumer only writes the tail
+ *          index, and each of them publishes its index with release semantics only after it has written or read the
+ *          descriptors that it covers, whereas the other side reads that index with acquire semantics before touching
+ *          those descriptors. Therefore, no read-modify-write atomic operation is needed, which also makes this module
+ *          usable on the Cortex-M0, and the C11 atomics emit the required memory barriers on any core.
+ * @details The data of each request is not copied, so the producer typically points it to a buffer taken from a pool
+ *          and gives that buffer back from the @ref W25Q128FV_ring_done_callback_t of the request.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_RING_H
+#define W25Q128FV_RING_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+#include <stdatomic.h> // This library contains the C11 atomic types and operations.
+
+#ifndef W25Q128FV_RING_SIZE
+#define W25Q128FV_RING_SIZE                 (16)    /**< @brief Number of request descriptors of each @ref W25Q128FV_ring_t , which must be a power of 2. */
+#endif
+#define W25Q128FV_RING_REQUEST_READ         (0)     /**< @brief Type of the requests that call @ref w25q128fv_read_flash_memory . */
+#define W25Q128FV_RING_REQUEST_FAST_READ    (1)     /**< @brief Type of the requests that call @ref w25q128fv_fast_read_flash_memory . */
+#define W25Q128FV_RING_REQUEST_WRITE        (2)     /**< @brief Type of the requests that call @ref w25q128fv_write_flash_memory . */
+#define W25Q128FV_RING_REQUEST_ERASE_SECTOR (3)     /**< @brief Type of the requests that call @ref w25q128fv_erase_sector . */
+#define W25Q128FV_RING_REQUEST_ERASE_BLOCK_64KB (4) /**< @brief Type of the requests that call @ref w25q128fv_erase_block_64kb . */
+
+#if (W25Q128FV_RING_SIZE & (W25Q128FV_RING_SIZE-1)) != 0
+#error "W25Q128FV_RING_SIZE must be a power of 2."
+#endif
+
+typedef struct W25Q128FV_ring_request W25Q128FV_ring_request_t;
+
+/**@brief   Function that the consumer calls once it has executed a request.
+ *
+ * @note    This function runs in the context of the consumer, while the descriptor of the request is still owned by it.
+ *
+ * @param[in] request   Pointer to the Memory Location Address of the descriptor of the request, which is only valid until
+ *                      this function returns.
+ * @param status        Value returned by the function of the @ref w25q128fv that executed the request.
+ */
+typedef void (*W25Q128FV_ring_done_callback_t)(const W25Q128FV_ring_request_t *request, W25Q128FV_Status status);
+
+/**@brief	W25Q128FV Request Ring descriptor structure.
+ */
+struct W25Q128FV_ring_request {
+    uint8_t type;                           //!< Type of the request (e.g., @ref W25Q128FV_RING_REQUEST_WRITE ).
+    uint8_t page_bytes_offset;              //!< Offset in bytes inside the start Flash Memory Page for reads and writes.
+    uint32_t number;                        //!< Start Flash Memory Page for reads and writes, or Sector or 64KB Block for erases.
+    uint32_t size;                          //!< Size in bytes for reads and writes.
+    uint8_t *data;                          //!< Memory Location Address of the data for reads and writes.
+    W25Q128FV_ring_done_callback_t done;    //!< Function to be called once the request is executed, or \c NULL if none.
+};
+
+/**@brief	W25Q128FV Request Ring structure.
+ */
+typedef struct {
+    W25Q128FV_ring_request_t requests[W25Q128FV_RING_SIZE]; //!< Request descriptors.
+    atomic_uint_least32_t head;                             //!< Number of requests ever pushed, which only the producer writes.
+    atomic_uint_least32_t tail;                             //!< Number of requests ever drained, which only the consumer writes.
+} W25Q128FV_ring_t;
+
+/**@brief   Empties a @ref W25Q128FV_ring_t , which must be done before both its producer and its consumer use it.
+ *
+ * @param[out] ring Pointer to the Memory Location Address of the ring.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_ring_init(W25Q128FV_ring_t *ring);
+
+/**@brief   Executes a request of a given type via the @ref w25q128fv , which is the single place where the types of
+ *          request of this module and of the @ref w25q128fv_rtos are dispatched.
+ *
+ * @note    The caller must have exclusive use of the @ref w25q128fv (e.g., via @ref w25q128fv_rtos_lock ).
+ *
+ * @param type              Type of the request (e.g., @ref W25Q128FV_RING_REQUEST_WRITE ).
+ * @param number            Start Flash Memory Page for reads and writes, or Sector or 64KB Block for erases.
+ * @param page_bytes_offset Offset in bytes inside the start Flash Memory Page for reads and writes.
+ * @param size              Size in bytes for reads and writes.
+ * @param[in,out] data      Pointer to the Memory Location Address of the data for reads and writes.
+ *
+ * @retval	W25Q128FV_EC_ERR    if the type of the request is unknown.
+ * @retval  other               value returned by the function of the @ref w25q128fv that executed the request.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_ring_execute(uint8_t type, uint32_t number, uint8_t page_bytes_offset, uint32_t size, uint8_t *data);
+
+/**@brief   Pushes a request into a ring, which only its producer may do.
+ *
+ * @note    This function never blocks, so it may be called from an interrupt.
+ *
+ * @param[in,out] ring  Pointer to the Memory Location Address of the ring.
+ * @param[in] request   Pointer to the Memory Location Address of the request, which is copied into the ring.
+ *
+ * @retval	W25Q128FV_EC_OK     if the request was pushed.
+ * @retval  W25Q128FV_EC_NA     if the ring is full, in which case nothing was pushed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_ring_push(W25Q128FV_ring_t *ring, const W25Q128FV_ring_request_t *request);
+
+/**@brief   Executes, in the order in which they were pushed, the requests of a ring and frees their descriptors in a
+ *          single batch, which only its consumer may do.
+ *
+ * @note    The caller must have exclusive use of the @ref w25q128fv (e.g., via @ref w25q128fv_rtos_lock ).
+ *
+ * @param[in,out] ring      Pointer to the Memory Location Address of the ring.
+ * @param max_requests      Maximum number of requests to be executed.
+ *
+ * @return  The number of requests that were executed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint32_t w25q128fv_ring_drain(W25Q128FV_ring_t *ring, uint32_t max_requests);
+
+#endif /* W25Q128FV_RING_H */
+
+/** @} */
@@ -0,0 +1,256 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's RTOS port layer Header file.
+ *
+ * @defgroup w25q128fv_rtos W25Q128FV RTOS Port Layer module
+ * @{
+ *
+ * @brief   This module makes the @ref w25q128fv safe to be used from several tasks of an RTOS that provides the
+ *          CMSIS-RTOS v2 API (e.g., FreeRTOS as generated by STM32CubeIDE), since otherwise two tasks that use the
+ *          W25Q128FV Device at the same time would interleave their Instructions within each other's CS framing.
+ *
+ * @details The @ref w25q128fv controls a single W25Q128FV Device, whose state lives in static variables, and so this
+ *          module guards it with a single recursive mutex, as follows:
+ *          <ul>
+ *              <li>
+ *                  Every request made via @ref w25q128fv_rtos_submit , or via the functions of this module that wrap
+ *                  the functions of the @ref w25q128fv (e.g., @ref w25q128fv_rtos_write_flash_memory ), is executed
+ *                  while holding the mutex. Sequences of calls that must not be interleaved with other tasks (e.g., the
+ *                  ones of the modules built on top of the @ref w25q128fv , such as a @ref w25q128fv_writer ) must be
+ *                  wrapped between @ref w25q128fv_rtos_lock and @ref w25q128fv_rtos_unlock instead.
+ *              </li>
+ *              <li>
+ *                  Optionally, the requests are executed by a dedicated worker task that receives them through a message
+ *                  queue, such that the tasks that make them do not need the stack that the @ref w25q128fv uses, and
+ *                  such that a request with a @ref W25Q128FV_rtos_callback_t is made without waiting for it. The worker task also drains the
+ *                  @ref W25Q128FV_ring_t given to @ref w25q128fv_rtos_attach_ring , through which interrupts make their
+ *                  requests via @ref w25q128fv_rtos_ring_push_from_isr without taking any lock.
+ *              </li>
+ *              <li>
+ *                  The @ref w25q128fv is given @ref W25Q128FV_os_hooks_t , so that the task that uses it sleeps instead
+ *                  of busy-waiting, both while the W25Q128FV Device is busy (i.e., via @ref osDelay , which the RTOS tick
+ *                  interrupt ends) and while a DMA transfer is in progress (i.e., via a semaphore that the implementer
+ *                  gives from the SPI DMA interrupt via @ref w25q128fv_rtos_spi_dma_complete_from_isr ).
+ *              </li>
+ *          </ul>
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_RTOS_H
+#define W25Q128FV_RTOS_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include "w25q128fv_ring.h" // This custom Mortrack's library contains the lock-free request ring of the W25Q128FV Flash Memory Device.
+#include "cmsis_os2.h" // This is the CMSIS-RTOS v2 API, which STM32CubeIDE provides on top of FreeRTOS.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_RTOS_QUEUE_LENGTH
+#define W25Q128FV_RTOS_QUEUE_LENGTH                 (8)                     /**< @brief Maximum number of requests that can wait in the message queue of the worker task. */
+#endif
+#ifndef W25Q128FV_RTOS_WORKER_STACK_SIZE_IN_BYTES
+#define W25Q128FV_RTOS_WORKER_STACK_SIZE_IN_BYTES   (1024)                  /**< @brief Size in bytes of the stack of the worker task. */
+#endif
+#ifndef W25Q128FV_RTOS_WORKER_PRIORITY
+#define W25Q128FV_RTOS_WORKER_PRIORITY              (osPriorityAboveNormal) /**< @brief Priority of the worker task. */
+#endif
+#ifndef W25Q128FV_RTOS_DONE_FLAG
+#define W25Q128FV_RTOS_DONE_FLAG                    (0x00800000)            /**< @brief Thread Flag that the worker task sets in the task that is waiting for its request to be executed. */
+#endif
+#ifndef W25Q128FV_RTOS_WAKE_FLAG
+#define W25Q128FV_RTOS_WAKE_FLAG                    (0x00400000)            /**< @brief Thread Flag that is set in the worker task whenever a request is sent to it. */
+#endif
+#ifndef W25Q128FV_RTOS_MAX_RINGS
+#define W25Q128FV_RTOS_MAX_RINGS                    (4)                     /**< @brief Maximum number of @ref W25Q128FV_ring_t that can be attached to the worker task. */
+#endif
+#ifndef W25Q128FV_RTOS_RING_BATCH_SIZE
+#define W25Q128FV_RTOS_RING_BATCH_SIZE              (4)                     /**< @brief Maximum number of requests of a @ref W25Q128FV_ring_t that the worker task executes each time it takes the mutex. */
+#endif
+#define W25Q128FV_RTOS_REQUEST_READ                 (W25Q128FV_RING_REQUEST_READ) /**< @brief Type of the requests that call @ref w25q128fv_read_flash_memory . */
+#define W25Q128FV_RTOS_REQUEST_FAST_READ            (W25Q128FV_RING_REQUEST_FAST_READ) /**< @brief Type of the requests that call @ref w25q128fv_fast_read_flash_memory . */
+#define W25Q128FV_RTOS_REQUEST_WRITE                (W25Q128FV_RING_REQUEST_WRITE) /**< @brief Type of the requests that call @ref w25q128fv_write_flash_memory . */
+#define W25Q128FV_RTOS_REQUEST_ERASE_SECTOR         (W25Q128FV_RING_REQUEST_ERASE_SECTOR) /**< @brief Type of the requests that call @ref w25q128fv_erase_sector . */
+#define W25Q128FV_RTOS_REQUEST_ERASE_BLOCK_64KB     (W25Q128FV_RING_REQUEST_ERASE_BLOCK_64KB) /**< @brief Type of the requests that call @ref w25q128fv_erase_block_64kb . */
+
+typedef struct W25Q128FV_rtos_request W25Q128FV_rtos_request_t;
+
+/**@brief   Function that the worker task calls after executing a request that was made without waiting for it.
+ *
+ * @note    This function runs in the worker task, so it must not make requests that wait for the worker task.
+ *
+ * @param[in,out] request   Pointer to the Memory Location Address of the request, whose status has been set.
+ */
+typedef void (*W25Q128FV_rtos_callback_t)(W25Q128FV_rtos_request_t *request);
+
+/**@brief	W25Q128FV RTOS request structure.
+ */
+struct W25Q128FV_rtos_request {
+    uint8_t type;                       //!< Type of the request (e.g., @ref W25Q128FV_RTOS_REQUEST_WRITE ).
+    uint32_t number;                    //!< Start Flash Memory Page for reads and writes, Sector for Sector Erases or 64KB Block for 64KB Block Erases.
+    uint8_t page_bytes_offset;          //!< Offset in bytes inside the start Flash Memory Page for reads and writes.
+    uint32_t size;                      //!< Size in bytes for reads and writes.
+    uint8_t *data;                      //!< Memory Location Address of the data for reads and writes.
+    W25Q128FV_rtos_callback_t callback; //!< Function to be called once the request is executed, or \c NULL to wait for it.
+    W25Q128FV_Status status;            //!< Value returned by the function of the @ref w25q128fv that executed the request.
+    osThreadId_t caller;                //!< Task that waits for the request, which is set by @ref w25q128fv_rtos_submit .
+};
+
+/**@brief   Initializes the @ref w25q128fv_rtos in order to be able to use its provided functions.
+ *
+ * @note    This function must be called after @ref init_w25q128fv_module and after @ref osKernelInitialize .
+ *
+ * @param is_worker_enabled 1 if the requests are to be executed by a dedicated worker task or 0 if they are to be
+ *                          executed by the tasks that make them.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_rtos was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the mutex, the semaphore, the message queue or the worker task could not be created.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_rtos_module(uint8_t is_worker_enabled);
+
+/**@brief   Takes exclusive use of the @ref w25q128fv for the calling task, waiting for other tasks to release it.
+ *
+ * @note    This may be called again by the task that already holds it, as long as each call is followed by its own
+ *          call to @ref w25q128fv_rtos_unlock .
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv was taken.
+ * @retval  W25Q128FV_EC_ERR    if it could not be taken (e.g., if called from an interrupt).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_lock(void);
+
+/**@brief   Releases the exclusive use of the @ref w25q128fv that was taken via @ref w25q128fv_rtos_lock .
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv was released.
+ * @retval  W25Q128FV_EC_ERR    if the calling task did not hold it.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_unlock(void);
+
+/**@brief   Executes a request with exclusive use of the @ref w25q128fv .
+ *
+ * @details If the worker task is enabled, then the request is sent to it and, unless it has a callback, this function
+ *          waits for the worker task to execute it. Otherwise, the request is executed by the calling task.
+ *
+ * @param[in,out] request   Pointer to the Memory Location Address of the request, which must remain valid until it is
+ *                          executed.
+ *
+ * @retval	W25Q128FV_EC_OK     if the request was successfully executed or, if it has a callback, sent to the worker
+ *                              task.
+ * @retval  W25Q128FV_EC_ERR    if the request has a callback but the worker task is not enabled, if it could not be
+ *                              sent to the worker task or if its type is unknown.
+ * @retval  other               value returned by the function of the @ref w25q128fv that executed the request.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_submit(W25Q128FV_rtos_request_t *request);
+
+/**@brief   Attaches a ring to the worker task, which from then on is its consumer, so that its producer may make
+ *          requests via @ref w25q128fv_rtos_ring_push_from_isr .
+ *
+ * @note    Each interrupt that makes requests must have its own ring, since a ring has a single producer.
+ * @note    This function takes the mutex of this module, so it may be called from any task while the worker task runs,
+ *          but not from an interrupt.
+ *
+ * @param[in,out] ring  Pointer to the Memory Location Address of the ring, which must have been initialized via
+ *                      @ref w25q128fv_ring_init and which must remain valid from now on.
+ *
+ * @retval	W25Q128FV_EC_OK     if the ring was attached.
+ * @retval  W25Q128FV_EC_NA     if @ref W25Q128FV_RTOS_MAX_RINGS rings are already attached.
+ * @retval  W25Q128FV_EC_ERR    if the worker task is not enabled or if the mutex could not be taken.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_attach_ring(W25Q128FV_ring_t *ring);
+
+/**@brief   Pushes a request into a ring that was attached via @ref w25q128fv_rtos_attach_ring and wakes up the worker
+ *          task, without taking any lock and without blocking.
+ *
+ * @note    This function may be called from an interrupt, as long as it is the only producer of the ring.
+ *
+ * @param[in,out] ring  Pointer to the Memory Location Address of the ring.
+ * @param[in] request   Pointer to the Memory Location Address of the request, which is copied into the ring.
+ *
+ * @return  The value returned by @ref w25q128fv_ring_push .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_ring_push_from_isr(W25Q128FV_ring_t *ring, const W25Q128FV_ring_request_t *request);
+
+/**@brief   Calls @ref w25q128fv_read_flash_memory with exclusive use of the @ref w25q128fv .
+ *
+ * @param start_page        Flash Memory Page of the W25Q128FV Device from which it is desired to start reading data.
+ * @param page_bytes_offset Offset in bytes inside that Flash Memory Page.
+ * @param size              Size in bytes to read from the W25Q128FV Device.
+ * @param[out] dst          Pointer to the Memory Location Address where the data will be stored.
+ *
+ * @return  The value returned by @ref w25q128fv_rtos_submit .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst);
+
+/**@brief   Calls @ref w25q128fv_fast_read_flash_memory with exclusive use of the @ref w25q128fv .
+ *
+ * @param start_page        Flash Memory Page of the W25Q128FV Device from which it is desired to start reading data.
+ * @param page_bytes_offset Offset in bytes inside that Flash Memory Page.
+ * @param size              Size in bytes to read from the W25Q128FV Device.
+ * @param[out] dst          Pointer to the Memory Location Address where the data will be stored.
+ *
+ * @return  The value returned by @ref w25q128fv_rtos_submit .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_fast_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst);
+
+/**@brief   Calls @ref w25q128fv_write_flash_memory with exclusive use of the @ref w25q128fv .
+ *
+ * @param start_page        Flash Memory Page of the W25Q128FV Device from which it is desired to start writing data.
+ * @param page_bytes_offset Offset in bytes inside that Flash Memory Page.
+ * @param size              Size in bytes to write into the W25Q128FV Device.
+ * @param[in] src           Pointer to the Memory Location Address where the data is located at.
+ *
+ * @return  The value returned by @ref w25q128fv_rtos_submit .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_write_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src);
+
+/**@brief   Calls @ref w25q128fv_erase_sector with exclusive use of the @ref w25q128fv .
+ *
+ * @param sector_number Flash Memory Sector of the W25Q128FV Device to be erased.
+ *
+ * @return  The value returned by @ref w25q128fv_rtos_submit .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_rtos_erase_sector(uint32_t sector_number);
+
+/**@brief   Signals the end of the DMA transfer of the SPI given to @ref init_w25q128fv_module to the task that waits for
+ *          it.
+ *
+ * @note    The implementer must call this function from @ref HAL_SPI_RxCpltCallback , @ref HAL_SPI_TxCpltCallback and
+ *          @ref HAL_SPI_ErrorCallback whenever they are called for that SPI, as well as from
+ *          @ref HAL_SPI_TxRxCpltCallback if @ref W25Q128FV_INTERRUPT_SHORT_COMMANDS is 1.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_rtos_spi_dma_complete_from_isr(void);
+
+#endif /* W25Q128FV_RTOS_H */
+
+/** @} */
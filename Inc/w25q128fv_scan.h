@@ -0,0 +1,90 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's Sector header scanner Header file.
+ *
+ * @defgroup w25q128fv_scan W25Q128FV Sector Header Scanner module
+ * @{
+ *
+ * @brief   This module provides the scan that the modules built on top of the @ref w25q128fv use whenever they have to
+ *          find their Sector headers at mount time, while only reading a few bytes of each Sector instead of whole
+ *          Sectors.
+ *
+ * @details The way that @ref w25q128fv_scan_headers works is that it issues one Fast Read of the first 4 bytes (i.e.,
+ *          the magic word) of each Sector of a region, which costs 9 bytes of bus traffic per Sector including the
+ *          instruction, address and dummy bytes (i.e., about 36KB for all the Sectors of the W25Q128FV Device).
+ *          Only the Sectors whose first word is the magic of the caller get the rest of their header read and given to
+ *          a callback, while the Sectors whose first word is erased (i.e., 0xFFFFFFFF) are recorded into a summary
+ *          bitmap of blank Sectors. Since every header check is made on whole 32-bit words, the scan is bounded by the
+ *          SPI bus rather than by the CPU.
+ * @details Since the W25Q128FV Device only programs whole bytes after an erase, a Sector whose first word is erased
+ *          may still hold data further in. The bitmap is therefore a summary for the caller, who knows whether its
+ *          Sectors are always written from their first bytes (e.g., headers written first or data written right after
+ *          an erase), in which case the marked Sectors can be taken as free without erasing them again.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_SCAN_H
+#define W25Q128FV_SCAN_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_SCAN_MAX_HEADER_SIZE_IN_BYTES
+#define W25Q128FV_SCAN_MAX_HEADER_SIZE_IN_BYTES (64)    /**< @brief Maximum size in bytes of the Sector headers that @ref w25q128fv_scan_headers can read, including their magic word. */
+#endif
+#define W25Q128FV_SCAN_BLANK_WORD               (0xFFFFFFFF)    /**< @brief Value of an erased 32-bit word of the W25Q128FV Device. */
+
+/**@brief	W25Q128FV Sector Header Scanner callback.
+ *
+ * @details This function is called by @ref w25q128fv_scan_headers for each Sector whose first word is the magic that it
+ *          was given, in ascending order of Sector.
+ *
+ * @param sector_number Flash Memory Sector of the W25Q128FV Device whose header was read.
+ * @param[in] header    Pointer to the Memory Location Address of the header that was read, which starts with the magic
+ *                      word and which is 32-bit aligned.
+ *
+ * @retval	W25Q128FV_EC_OK     to continue the scan.
+ * @retval  Any other value     to stop the scan, which @ref w25q128fv_scan_headers will then return.
+ */
+typedef W25Q128FV_Status (*W25Q128FV_scan_header_callback_t)(uint32_t sector_number, uint8_t *header);
+
+/**@brief   Scans the headers of the Sectors of a region.
+ *
+ * @param first_sector              First Flash Memory Sector of the W25Q128FV Device to be scanned.
+ * @param total_sectors             Number of consecutive Sectors to be scanned.
+ * @param magic                     Value of the first 32-bit word (as read in little endian) that identifies the headers
+ *                                  of the caller.
+ * @param header_size_in_bytes      Size in bytes of the headers of the caller, including their magic word, which may be
+ *                                  any from 4 up to @ref W25Q128FV_SCAN_MAX_HEADER_SIZE_IN_BYTES .
+ * @param[out] blank_sectors_bitmap Pointer to the Memory Location Address of a bitmap of \p total_sectors bits where this
+ *                                  function will set the bit of each Sector whose first word is erased and clear the bit
+ *                                  of every other Sector, where the Sector \p first_sector is the least significant bit
+ *                                  of the first byte. It may be NULL if the bitmap is not needed.
+ * @param on_header                 Function that will be called for each Sector whose first word is \p magic .
+ *
+ * @retval	W25Q128FV_EC_OK     if the whole region was successfully scanned.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the given region or header size is invalid or if anything else went wrong.
+ * @retval  Otherwise           the value returned by \p on_header that stopped the scan.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_scan_headers(uint32_t first_sector, uint32_t total_sectors, uint32_t magic, uint16_t header_size_in_bytes, uint8_t *blank_sectors_bitmap, W25Q128FV_scan_header_callback_t on_header);
+
+/**@brief   Tells whether a buffer is fully erased, checking it one 32-bit word at a time.
+ *
+ * @param[in] data      Pointer to the Memory Location Address of the buffer, which must be 32-bit aligned.
+ * @param size_in_bytes Size in bytes of the buffer.
+ *
+ * @return  1 if every byte of the buffer is 0xFF or 0 if otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+uint8_t w25q128fv_scan_is_blank(const uint8_t *data, uint32_t size_in_bytes);
+
+#endif /* W25Q128FV_SCAN_H */
+
+/** @} */
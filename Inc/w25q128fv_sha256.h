@@ -0,0 +1,73 @@
+/**@file
+ * @brief	SHA-256 calculation Header file for the modules that verify images stored into the W25Q128FV Flash Memory.
+ *
+ * @defgroup w25q128fv_sha256 W25Q128FV SHA-256 module
+ * @{
+ *
+ * @brief   This module provides the SHA-256 (i.e., as specified in FIPS 180-4) that the modules built on top of the
+ *          @ref w25q128fv use to verify whole images, such as firmware updates, that they store into the W25Q128FV
+ *          Flash Memory Device.
+ *
+ * @details The digest is calculated incrementally, such that the data can be fed in chunks of any size as soon as they
+ *          are available (e.g., while they are being written into or read from the W25Q128FV Device) via
+ *          @ref w25q128fv_sha256_update , between a call to @ref w25q128fv_sha256_init and one to
+ *          @ref w25q128fv_sha256_final .
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_SHA256_H
+#define W25Q128FV_SHA256_H
+
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#define W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES   (32)    /**< @brief Size in bytes of a SHA-256 digest. */
+#define W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES    (64)    /**< @brief Size in bytes of each of the blocks in which SHA-256 processes its data. */
+
+/**@brief	SHA-256 calculation context structure.
+ *
+ * @details The contents of this structure are managed by the functions of the @ref w25q128fv_sha256 and must not be
+ *          modified by the implementer.
+ */
+typedef struct {
+    uint32_t state[8];                                      //!< Intermediate hash value.
+    uint32_t total_size_in_bytes;                           //!< Number of bytes fed so far.
+    uint8_t block[W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES];    //!< Bytes fed so far that do not complete a block yet.
+} W25Q128FV_sha256_t;
+
+/**@brief   Starts the calculation of a SHA-256 digest.
+ *
+ * @param[out] sha256   Pointer to the Memory Location Address of the SHA-256 calculation context to be started.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_sha256_init(W25Q128FV_sha256_t *sha256);
+
+/**@brief   Feeds some more data into a SHA-256 calculation.
+ *
+ * @param sha256    Pointer to the Memory Location Address of a started SHA-256 calculation context.
+ * @param[in] data  Pointer to the Memory Location Address where the data is located at.
+ * @param size      Size in bytes of the data.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_sha256_update(W25Q128FV_sha256_t *sha256, const uint8_t *data, uint32_t size);
+
+/**@brief   Finishes a SHA-256 calculation.
+ *
+ * @param sha256        Pointer to the Memory Location Address of a started SHA-256 calculation context, which will have
+ *                      to be started again in order to be reused.
+ * @param[out] digest   Pointer to the Memory Location Address where this function will store the
+ *                      @ref W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES bytes of the digest.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+void w25q128fv_sha256_final(W25Q128FV_sha256_t *sha256, uint8_t *digest);
+
+#endif /* W25Q128FV_SHA256_H */
+
+/** @} */
@@ -0,0 +1,183 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's A/B image slot manager with delta updates Header file.
+ *
+ * @defgroup w25q128fv_slots W25Q128FV A/B Slot Manager module
+ * @{
+ *
+ * @brief   This module keeps two slots of consecutive Sectors of the W25Q128FV Flash Memory Device, of which one holds
+ *          the active image (e.g., the firmware that the bootloader installs) and the other one receives the next
+ *          image, which is rebuilt from the active one and a binary delta patch instead of being fully transferred.
+ *
+ * @details The patch is applied in a single pass with a bounded amount of RAM: the implementer feeds it, in chunks of any
+ *          size, to @ref w25q128fv_slots_patch_write , which reads the needed bytes of the active slot and writes the
+ *          new image sequentially into the inactive slot through a @ref w25q128fv_writer . The format of the patch,
+ *          where every field is little endian, follows the control/diff/extra scheme of bsdiff without compression:
+ *          <ol>
+ *              <li>
+ *                  A header of @ref W25Q128FV_SLOTS_PATCH_HEADER_SIZE_IN_BYTES bytes made of the magic number
+ *                  @ref W25Q128FV_SLOTS_PATCH_MAGIC , the size in bytes of the old image, the size in bytes of the new
+ *                  image and the SHA-256 digest of the new image, in that order.
+ *              </li>
+ *              <li>
+ *                  Any number of records, each made of a uint32_t diff length, a uint32_t extra length and an int32_t
+ *                  seek, followed by diff length bytes that are added, modulo 256, to the same number of bytes of the
+ *                  old image from its current position, which then advances by that number, and by extra length bytes
+ *                  that are copied as they are. After that, the current position within the old image is moved by seek
+ *                  bytes. The records must produce exactly the size of the new image.
+ *              </li>
+ *          </ol>
+ * @details Each time that the new image reaches a multiple of @ref W25Q128FV_SLOTS_CHECKPOINT_INTERVAL_IN_SECTORS
+ *          Sectors, the progress of the patch is appended as a record into a journal of two Sectors, where the magic
+ *          of each record is written last. After a power loss, @ref w25q128fv_slots_mount recovers the latest record and
+ *          @ref w25q128fv_slots_patch_resume tells the implementer the offset of the patch from which it has to be fed
+ *          again, such that at most the given interval of the new image is rebuilt twice. Once the whole patch has been
+ *          fed, @ref w25q128fv_slots_patch_end checks the SHA-256 digest of the new slot and only then appends a record
+ *          that makes it the active one. Since the active slot is never written while a patch is being applied, a
+ *          failed or interrupted update always leaves the active image intact.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_SLOTS_H
+#define W25Q128FV_SLOTS_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+#ifndef W25Q128FV_SLOTS_CHECKPOINT_INTERVAL_IN_SECTORS
+#define W25Q128FV_SLOTS_CHECKPOINT_INTERVAL_IN_SECTORS  (4)         /**< @brief Number of Sectors of the new image after which the progress of the patch is appended into the journal. */
+#endif
+#ifndef W25Q128FV_SLOTS_OLD_BUFFER_SIZE_IN_BYTES
+#define W25Q128FV_SLOTS_OLD_BUFFER_SIZE_IN_BYTES        (256)       /**< @brief Size in bytes of the RAM buffer into which the bytes of the old image that the diff data is added to are read. */
+#endif
+#define W25Q128FV_SLOTS_JOURNAL_SECTORS                 (2)         /**< @brief Number of Sectors of the journal, which are used alternately. */
+#define W25Q128FV_SLOTS_PATCH_MAGIC                     (0x544C4457) /**< @brief Value that identifies a patch (i.e., "WDLT" in little endian). */
+#define W25Q128FV_SLOTS_PATCH_HEADER_SIZE_IN_BYTES      (44)        /**< @brief Size in bytes of the header of a patch. */
+
+/**@brief	W25Q128FV A/B Slot Manager Definition parameters structure.
+ */
+typedef struct {
+    uint32_t slot_first_sector[2];  //!< First Flash Memory Sector of the W25Q128FV Device of each slot (i.e., A and B).
+    uint32_t slot_total_sectors;    //!< Number of consecutive Flash Memory Sectors of each slot.
+    uint32_t journal_first_sector;  //!< First of the @ref W25Q128FV_SLOTS_JOURNAL_SECTORS consecutive Flash Memory Sectors of the W25Q128FV Device that hold the journal.
+} W25Q128FV_slots_def_t;
+
+/**@brief   Initializes the @ref w25q128fv_slots in order to be able to use its provided functions.
+ *
+ * @details After calling this function, the implementer must either call @ref w25q128fv_slots_mount to recover the
+ *          state that was stored before or @ref w25q128fv_slots_format to start from a known active image.
+ *
+ * @param[in] slots_def Pointer to the W25Q128FV A/B Slot Manager Definition parameters structure, whose contents will be
+ *                      copied by this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the @ref w25q128fv_slots was successfully initialized.
+ * @retval  W25Q128FV_EC_ERR    if the slots have no Sectors, if the slots or the journal exceed the existing Sectors
+ *                              of the W25Q128FV Device or if any two of slot A, slot B and the journal share a Sector.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status init_w25q128fv_slots_module(W25Q128FV_slots_def_t *slots_def);
+
+/**@brief   Erases the journal and records which slot holds the active image.
+ *
+ * @param slot          Slot that holds the active image (i.e., 0 for A and 1 for B).
+ * @param image_size    Size in bytes of the active image.
+ *
+ * @retval	W25Q128FV_EC_OK     if the journal was successfully formatted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if \p slot is not 0 or 1, if \p image_size exceeds the size of a slot or if
+ *                              anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_format(uint8_t slot, uint32_t image_size);
+
+/**@brief   Recovers the latest record of the journal.
+ *
+ * @retval	W25Q128FV_EC_OK     if the journal was successfully recovered.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the journal holds no valid record (e.g., if it was never formatted), in which case
+ *                              @ref w25q128fv_slots_format should be called.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_mount(void);
+
+/**@brief   Gets the slot that holds the active image.
+ *
+ * @param[out] slot         Pointer to the Memory Location Address where this function will store the slot that holds
+ *                          the active image (i.e., 0 for A and 1 for B).
+ * @param[out] image_size   Pointer to the Memory Location Address where this function will store the size in bytes of
+ *                          the active image.
+ *
+ * @retval	W25Q128FV_EC_OK     if the active slot was successfully obtained.
+ * @retval  W25Q128FV_EC_ERR    if the journal is not mounted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_get_active(uint8_t *slot, uint32_t *image_size);
+
+/**@brief   Starts applying a new patch to the active image, which discards any patch that was in progress.
+ *
+ * @retval	W25Q128FV_EC_OK     if the patch was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the journal is not mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_patch_begin(void);
+
+/**@brief   Resumes the patch that was in progress when the journal was mounted.
+ *
+ * @param[out] patch_offset Pointer to the Memory Location Address where this function will store the offset in bytes
+ *                          within the patch from which it has to be fed again via @ref w25q128fv_slots_patch_write .
+ *
+ * @retval	W25Q128FV_EC_OK     if the patch was successfully resumed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if no patch was in progress.
+ * @retval  W25Q128FV_EC_ERR    if the journal is not mounted or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_patch_resume(uint32_t *patch_offset);
+
+/**@brief   Applies the next chunk of the patch that is in progress.
+ *
+ * @param[in] data  Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK     if the chunk was successfully applied.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if no patch is in progress, if the patch is malformed or does not apply to the active
+ *                              image, in which case the patch is discarded, or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_patch_write(uint8_t *data, uint32_t size);
+
+/**@brief   Finishes the patch that is in progress and, if the new image has the expected SHA-256 digest, makes its slot
+ *          the active one.
+ *
+ * @retval	W25Q128FV_EC_OK     if the new image became the active one.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if no patch is in progress, if the patch was not completely fed, if the digest of the
+ *                              new image does not match, in which case the patch is discarded and the active image
+ *                              remains the same, or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_slots_patch_end(void);
+
+#endif /* W25Q128FV_SLOTS_H */
+
+/** @} */
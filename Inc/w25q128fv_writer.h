@@ -0,0 +1,109 @@
+/**@file
+ * @brief	W25Q128FV Flash Memory's streaming append writer Header file.
+ *
+ * @defgroup w25q128fv_writer W25Q128FV Stream Writer module
+ * @{
+ *
+ * @brief   This module provides a writer object that appends chunks of any size into a region of consecutive Sectors of
+ *          the W25Q128FV Flash Memory Device, so that the application firmware does not have to do any Page arithmetic
+ *          nor to gather its data into contiguous buffers before writing it.
+ *
+ * @details The way that the @ref w25q128fv_writer works is that each @ref W25Q128FV_writer_t keeps a RAM staging buffer
+ *          of exactly one Page that is always aligned to a Page of the W25Q128FV Device. The chunks given to
+ *          @ref w25q128fv_writer_write are accumulated into it and it is only written once it is full, so that every
+ *          write that this module requests to the @ref w25q128fv covers exactly one whole Page, except for the last one
+ *          that @ref w25q128fv_writer_close requests. Whenever the staging buffer is empty and the given chunk has at least one
+ *          whole Page left, that Page is programmed directly from the chunk instead of being copied first.
+ * @details The Sectors of the region are erased by this module, ahead of the write cursor: when the first Page of a
+ *          Sector is about to be programmed, the Sector that follows it is started being erased via
+ *          @ref w25q128fv_start_erase_sector . Therefore, that Sector Erase runs in the background while the current
+ *          Sector is being written and, unless the application firmware writes faster than a Sector can be erased, the
+ *          write cursor never has to wait for it.
+ *
+ * @author 	Cesar Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+
+#ifndef W25Q128FV_WRITER_H
+#define W25Q128FV_WRITER_H
+
+#include "w25q128fv_driver.h" // This custom Mortrack's library contains the functions, definitions and variables that together operate as the driver for the W25Q128FV Flash Memory Device.
+#include <stdint.h> // This library contains the aliases: uint8_t, uint16_t, uint32_t, etc.
+
+/**@brief	W25Q128FV Stream Writer structure.
+ *
+ * @details The contents of this structure are managed by @ref w25q128fv_writer_open , @ref w25q128fv_writer_write and
+ *          @ref w25q128fv_writer_close and must not be modified by the implementer, although
+ *          @ref W25Q128FV_writer_t::size_in_bytes may be read at any moment.
+ */
+typedef struct {
+    uint32_t first_sector;                          //!< First Flash Memory Sector of the W25Q128FV Device into which the writer appends its data.
+    uint32_t total_sectors;                         //!< Number of consecutive Flash Memory Sectors into which the writer appends its data.
+    uint32_t size_in_bytes;                         //!< Number of bytes that have been given to the writer, including the ones that are still staged.
+    uint32_t ready_sectors;                         //!< Number of Sectors, from @ref W25Q128FV_writer_t::first_sector , that are known to be erased or that have already been written.
+    uint8_t is_erase_in_progress;                   //!< Flag indicating whether the Sector that follows the ready ones is being erased in the background (i.e., 1) or not (i.e., 0).
+    uint8_t is_open;                                //!< Flag indicating whether the writer is open (i.e., 1) or not (i.e., 0).
+    uint16_t staged_bytes;                          //!< Number of bytes held in @ref W25Q128FV_writer_t::staging .
+    uint8_t staging[W25Q128FV_PAGE_SIZE_IN_BYTES];  //!< RAM staging buffer of the Page that follows the last programmed one.
+} W25Q128FV_writer_t;
+
+/**@brief   Opens a writer that appends its data into a region of consecutive Sectors, starting from the beginning of
+ *          that region.
+ *
+ * @details The first Sector of the region is erased by this function, whereas the erase of the second one, if any, is
+ *          started in the background.
+ *
+ * @param[out] writer       Pointer to the Memory Location Address of the writer to be opened.
+ * @param first_sector      First Flash Memory Sector of the W25Q128FV Device into which the writer will append its
+ *                          data.
+ * @param total_sectors     Number of consecutive Flash Memory Sectors into which the writer will append its data.
+ *
+ * @retval	W25Q128FV_EC_OK     if the writer was successfully opened.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the given region has no Sectors, if it exceeds the existing Sectors of the W25Q128FV
+ *                              Device or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_writer_open(W25Q128FV_writer_t *writer, uint32_t first_sector, uint32_t total_sectors);
+
+/**@brief   Appends a chunk of data to a writer.
+ *
+ * @note    The data that does not complete a Page is only staged in RAM, so it will not be written into the W25Q128FV
+ *          Device until more data completes that Page or until @ref w25q128fv_writer_close is called.
+ *
+ * @param writer    Pointer to the Memory Location Address of an open writer.
+ * @param[in] src   Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK     if the chunk was successfully appended.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the writer is not open, if the chunk does not fit into the rest of its region, in
+ *                              which case nothing is appended, or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_writer_write(W25Q128FV_writer_t *writer, uint8_t *src, uint32_t size);
+
+/**@brief   Writes the data that is still staged in a writer, if any, and closes it.
+ *
+ * @note    A Sector Erase that the writer started ahead of its write cursor may still be in progress in the background
+ *          after calling this function, which the @ref w25q128fv will take care of.
+ * @note    If writing the staged data fails, then the writer is left open so that closing it can be retried.
+ *
+ * @param writer    Pointer to the Memory Location Address of an open writer.
+ *
+ * @retval	W25Q128FV_EC_OK     if the writer was successfully closed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the writer is not open or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+W25Q128FV_Status w25q128fv_writer_close(W25Q128FV_writer_t *writer);
+
+#endif /* W25Q128FV_WRITER_H */
+
+/** @} */
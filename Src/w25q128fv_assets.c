@@ -0,0 +1,519 @@
+#include "w25q128fv_assets.h"
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include <string.h>	// Library from which "strlen()", "memcmp()" and "memcpy()" are located at.
+#include <stddef.h> // Library from which "offsetof()" is located at.
+
+#define W25Q128FV_ASSETS_FNV_OFFSET_BASIS   (0x811C9DC5)    /**< @brief Offset basis of the 32-bit FNV-1a hash on which the hash of the names is based. */
+#define W25Q128FV_ASSETS_FNV_PRIME          (0x01000193)    /**< @brief Prime of the 32-bit FNV-1a hash on which the hash of the names is based. */
+#define W25Q128FV_ASSETS_SEED_MULTIPLIER    (0x9E3779B9)    /**< @brief Value by which the seeds are multiplied before being mixed into the offset basis of the hash. */
+#define W25Q128FV_ASSETS_LZ4_MIN_MATCH      (4)             /**< @brief Length in bytes that is added to the match length of each LZ4 token. */
+#define W25Q128FV_ASSETS_LZ4_TOKEN          (0)             /**< @brief State of the LZ4 decoder in which it expects the token of a sequence. */
+#define W25Q128FV_ASSETS_LZ4_LITERAL_LENGTH (1)             /**< @brief State of the LZ4 decoder in which it expects more bytes of the literal length. */
+#define W25Q128FV_ASSETS_LZ4_LITERALS       (2)             /**< @brief State of the LZ4 decoder in which it expects literals. */
+#define W25Q128FV_ASSETS_LZ4_OFFSET_LOW     (3)             /**< @brief State of the LZ4 decoder in which it expects the low byte of the match offset, which is also where a block may end. */
+#define W25Q128FV_ASSETS_LZ4_OFFSET_HIGH    (4)             /**< @brief State of the LZ4 decoder in which it expects the high byte of the match offset. */
+#define W25Q128FV_ASSETS_LZ4_MATCH_LENGTH   (5)             /**< @brief State of the LZ4 decoder in which it expects more bytes of the match length. */
+
+/**@brief	Header of an asset pack.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;                 //!< Must be @ref W25Q128FV_ASSETS_MAGIC .
+    uint32_t crc32;                 //!< CRC-32 of the rest of the header and of the seeds.
+    uint32_t total_assets;          //!< Number of assets, which is also the number of entries of the directory.
+    uint32_t total_buckets;         //!< Number of buckets, each of which has a seed.
+    uint32_t directory_offset;      //!< Offset of the directory.
+    uint32_t payload_alignment;     //!< Alignment in bytes of the payloads.
+    uint32_t size_in_bytes;         //!< Size in bytes of the whole asset pack.
+    uint32_t reserved;              //!< Reserved for future use.
+} W25Q128FV_assets_header_t;
+
+/**@brief	Entry of the directory of an asset pack.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    char name[W25Q128FV_ASSETS_MAX_NAME_SIZE_IN_BYTES]; //!< Name of the asset, padded with zeros.
+    uint32_t offset;                                    //!< Offset of the payload of the asset.
+    uint32_t size_in_bytes;                             //!< Size in bytes of the uncompressed data of the asset.
+    uint32_t crc32;                                     //!< CRC-32 of the uncompressed data of the asset.
+    uint32_t flags;                                     //!< Flags of the asset (e.g., @ref W25Q128FV_ASSETS_FLAG_COMPRESSED ).
+} W25Q128FV_assets_entry_t;
+
+/**@brief	Decompression of the blocks of a range of a compressed asset that is being read.
+ */
+typedef struct {
+    uint8_t *dst;               //!< Memory Location Address where the data of the range is stored.
+    uint32_t offset;            //!< Offset within the uncompressed data of the asset at which the range starts.
+    uint32_t end;               //!< Offset within the uncompressed data of the asset at which the range ends.
+    uint32_t asset_size;        //!< Size in bytes of the uncompressed data of the asset.
+    uint32_t first_block;       //!< Index of the first block of the current batch, whose offsets are in @ref block_table .
+    uint32_t total_blocks;      //!< Number of blocks of the current batch.
+    uint32_t block;             //!< Index, within the current batch, of the block being decompressed.
+    uint32_t block_remaining;   //!< Number of compressed bytes of the current block that have not been received yet.
+    uint8_t *out;               //!< Memory Location Address where the current block is decompressed into.
+    uint32_t out_size;          //!< Uncompressed size in bytes of the current block.
+    uint32_t out_position;      //!< Number of bytes of the current block that have been decompressed.
+    uint8_t is_raw;             //!< Flag indicating whether the current block is stored as it is (i.e., 1) or not (i.e., 0).
+    uint8_t state;              //!< State of the LZ4 decoder (e.g., @ref W25Q128FV_ASSETS_LZ4_TOKEN ).
+    uint8_t match_nibble;       //!< Match length field of the token of the current sequence.
+    uint32_t length;            //!< Literal or match length of the current sequence.
+    uint32_t match_offset;      //!< Match offset of the current sequence.
+} W25Q128FV_assets_decoder_t;
+
+static uint8_t is_mounted = 0;                          /**< @brief Flag indicating whether an asset pack is mounted (i.e., 1) or not (i.e., 0). */
+static uint32_t pack_address;                           /**< @brief W25Q128FV Device 24-bit Flash Memory Address at which the mounted asset pack starts. */
+static W25Q128FV_assets_header_t pack_header;           /**< @brief Header of the mounted asset pack. */
+static uint16_t pack_seeds[W25Q128FV_ASSETS_MAX_BUCKETS];  /**< @brief Seeds of the buckets of the mounted asset pack. */
+static uint32_t block_table[W25Q128FV_ASSETS_BLOCK_TABLE_BATCH_SIZE + 1];  /**< @brief Offsets of the blocks of the current batch of the compressed asset being read, plus the offset at which the batch ends. */
+static uint8_t block_buffer[W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES];      /**< @brief Buffer into which the blocks that are only partially covered by the range being read are decompressed. */
+static W25Q128FV_assets_decoder_t decoder;              /**< @brief Decompression of the range of the compressed asset being read. */
+
+/**@brief   Hashes a name with a given seed.
+ *
+ * @details The hash is the 32-bit FNV-1a hash of the name, whose offset basis is mixed with the seed, followed by the
+ *          finalizer of MurmurHash3 so that all of its bits depend on every character. The
+ *          @c Tools/w25q128fv_asset_pack.py tool must calculate the very same hash.
+ *
+ * @param[in] name  Pointer to the Memory Location Address of the name.
+ * @param size      Size in bytes of the name, without its null terminator.
+ * @param seed      Seed of the hash, where 0 is used to choose the bucket of the name.
+ *
+ * @return  The hash.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t hash_name(const char *name, uint32_t size, uint32_t seed);
+
+/**@brief   Prepares @ref decoder for the next block of the current batch.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void start_block(void);
+
+/**@brief   Feeds compressed bytes of the current block into the LZ4 decoder.
+ *
+ * @param[in] src   Pointer to the Memory Location Address where the compressed bytes are located at.
+ * @param size      Number of compressed bytes, which must not exceed the remaining ones of the current block.
+ *
+ * @retval	W25Q128FV_EC_OK     if the bytes were successfully decoded.
+ * @retval  W25Q128FV_EC_ERR    if the compressed data is corrupted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status decode_lz4(const uint8_t *src, uint32_t size);
+
+/**@brief   Decompresses a chunk of the compressed blocks that @ref w25q128fv_assets_read receives, while the next chunk
+ *          is being received via DMA.
+ *
+ * @param[in] chunk Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK     if the chunk was successfully decompressed.
+ * @retval  W25Q128FV_EC_ERR    if the compressed data is corrupted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status decompress_chunk(uint8_t *chunk, uint16_t size);
+
+W25Q128FV_Status w25q128fv_assets_mount(uint32_t address)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable seeds_address:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address of the seeds. */
+    uint32_t seeds_address = address + W25Q128FV_ASSETS_HEADER_SIZE_IN_BYTES;
+    /** <b>Local variable crc32:</b> @ref uint32_t Type variable used to hold the CRC-32 of the header and of the seeds as read. */
+    uint32_t crc32;
+
+    is_mounted = 0;
+    if (address > (W25Q128FV_TOTAL_SECTORS*W25Q128FV_SECTOR_SIZE_IN_BYTES - W25Q128FV_ASSETS_HEADER_SIZE_IN_BYTES))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    ret = w25q128fv_fast_read_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, address%W25Q128FV_PAGE_SIZE_IN_BYTES, sizeof(pack_header), (uint8_t *) &pack_header);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (pack_header.magic != W25Q128FV_ASSETS_MAGIC)
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    /* Validate the layout of the asset pack before reading its seeds. */
+    if ((pack_header.total_buckets > W25Q128FV_ASSETS_MAX_BUCKETS) || ((pack_header.total_assets>0) && (pack_header.total_buckets==0))
+        || (pack_header.size_in_bytes > (W25Q128FV_TOTAL_SECTORS*W25Q128FV_SECTOR_SIZE_IN_BYTES - address))
+        || (pack_header.directory_offset < (W25Q128FV_ASSETS_HEADER_SIZE_IN_BYTES + pack_header.total_buckets*sizeof(uint16_t)))
+        || (pack_header.directory_offset > pack_header.size_in_bytes)
+        || (pack_header.total_assets > ((pack_header.size_in_bytes-pack_header.directory_offset) / W25Q128FV_ASSETS_ENTRY_SIZE_IN_BYTES)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (pack_header.total_buckets > 0)
+    {
+        ret = w25q128fv_fast_read_flash_memory(seeds_address/W25Q128FV_PAGE_SIZE_IN_BYTES, seeds_address%W25Q128FV_PAGE_SIZE_IN_BYTES, pack_header.total_buckets*sizeof(uint16_t), (uint8_t *) pack_seeds);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    crc32 = w25q128fv_crc32_update(0, (uint8_t *) &pack_header.total_assets, sizeof(pack_header)-offsetof(W25Q128FV_assets_header_t, total_assets));
+    crc32 = w25q128fv_crc32_update(crc32, (uint8_t *) pack_seeds, pack_header.total_buckets*sizeof(uint16_t));
+    if (crc32 != pack_header.crc32)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    pack_address = address;
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_assets_find(const char *name, W25Q128FV_asset_t *asset)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable entry:</b> @ref W25Q128FV_assets_entry_t Type variable used to hold the directory entry that the name hashes to. */
+    W25Q128FV_assets_entry_t entry;
+    /** <b>Local variable name_size:</b> @ref uint32_t Type variable used to hold the size in bytes of the name, without its null terminator. */
+    uint32_t name_size;
+    /** <b>Local variable entry_address:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address of the directory entry that the name hashes to. */
+    uint32_t entry_address;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    name_size = strlen(name);
+    if ((pack_header.total_assets==0) || (name_size>=W25Q128FV_ASSETS_MAX_NAME_SIZE_IN_BYTES))
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    /* Read the only directory entry that may hold the name. */
+    entry_address = pack_address + pack_header.directory_offset
+                    + (hash_name(name, name_size, pack_seeds[hash_name(name, name_size, 0) % pack_header.total_buckets]) % pack_header.total_assets) * W25Q128FV_ASSETS_ENTRY_SIZE_IN_BYTES;
+    ret = w25q128fv_fast_read_flash_memory(entry_address/W25Q128FV_PAGE_SIZE_IN_BYTES, entry_address%W25Q128FV_PAGE_SIZE_IN_BYTES, sizeof(entry), (uint8_t *) &entry);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    // NOTE: Since the perfect hash maps any name to some entry, the stored name tells whether it is the asset or not.
+    if ((memcmp(entry.name, name, name_size) != 0) || (entry.name[name_size] != '\0'))
+    {
+        return W25Q128FV_EC_NA;
+    }
+    // NOTE: The stored size of a compressed asset is only known from its block table, which is checked when it is read.
+    if ((entry.offset > pack_header.size_in_bytes)
+        || (((entry.flags&W25Q128FV_ASSETS_FLAG_COMPRESSED) == 0) && (entry.size_in_bytes > (pack_header.size_in_bytes-entry.offset))))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    asset->address = pack_address + entry.offset;
+    asset->size_in_bytes = entry.size_in_bytes;
+    asset->crc32 = entry.crc32;
+    asset->is_compressed = ((entry.flags&W25Q128FV_ASSETS_FLAG_COMPRESSED) != 0);
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_assets_read(const W25Q128FV_asset_t *asset, uint32_t offset, uint8_t *dst, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable address:</b> @ref uint32_t Type variable used to hold a W25Q128FV Device 24-bit Flash Memory Address to be read. */
+    uint32_t address;
+    /** <b>Local variable total_blocks:</b> @ref uint32_t Type variable used to hold the number of blocks of the compressed asset. */
+    uint32_t total_blocks;
+    /** <b>Local variable last_block:</b> @ref uint32_t Type variable used to hold the index of the last block that covers the range. */
+    uint32_t last_block;
+    /** <b>Local variable block_size:</b> @ref uint32_t Type variable used to hold the uncompressed size in bytes of a block. */
+    uint32_t block_size;
+
+    if ((is_mounted==0) || (offset>asset->size_in_bytes) || (size>(asset->size_in_bytes-offset)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (size == 0)
+    {
+        return W25Q128FV_EC_OK;
+    }
+    if (asset->is_compressed == 0)
+    {
+        address = asset->address + offset;
+        return w25q128fv_fast_read_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, address%W25Q128FV_PAGE_SIZE_IN_BYTES, size, dst);
+    }
+
+    decoder.dst = dst;
+    decoder.offset = offset;
+    decoder.end = offset + size;
+    decoder.asset_size = asset->size_in_bytes;
+    total_blocks = (asset->size_in_bytes + W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES - 1) / W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+    last_block = (decoder.end - 1) / W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+
+    /* Read the blocks that cover the range in batches, each of which costs one read of its offsets plus one stream of its blocks. */
+    for (decoder.first_block=offset/W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES; decoder.first_block<=last_block; decoder.first_block+=decoder.total_blocks)
+    {
+        decoder.total_blocks = last_block - decoder.first_block + 1;
+        decoder.total_blocks = (decoder.total_blocks < W25Q128FV_ASSETS_BLOCK_TABLE_BATCH_SIZE) ? decoder.total_blocks : W25Q128FV_ASSETS_BLOCK_TABLE_BATCH_SIZE;
+        address = asset->address + decoder.first_block*sizeof(uint32_t);
+        ret = w25q128fv_fast_read_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, address%W25Q128FV_PAGE_SIZE_IN_BYTES, (decoder.total_blocks+1)*sizeof(uint32_t), (uint8_t *) block_table);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+
+        /* Validate the offsets of the batch, such that each block has at least one byte and no more than its uncompressed size. */
+        if ((block_table[0] < ((total_blocks+1)*sizeof(uint32_t))) || (block_table[decoder.total_blocks] > (pack_address+pack_header.size_in_bytes-asset->address)))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        for (uint32_t i=0; i<decoder.total_blocks; i++)
+        {
+            block_size = asset->size_in_bytes - (decoder.first_block+i)*W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+            block_size = (block_size < W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES) ? block_size : W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+            if ((block_table[i+1] <= block_table[i]) || ((block_table[i+1]-block_table[i]) > block_size))
+            {
+                return W25Q128FV_EC_ERR;
+            }
+        }
+
+        decoder.block = 0;
+        start_block();
+        ret = w25q128fv_stream_read(asset->address+block_table[0], block_table[decoder.total_blocks]-block_table[0], decompress_chunk);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_assets_load(const char *name, uint8_t *dst, uint32_t dst_size, uint32_t *size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable asset:</b> @ref W25Q128FV_asset_t Type variable used to hold the information of the asset. */
+    W25Q128FV_asset_t asset;
+
+    ret = w25q128fv_assets_find(name, &asset);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (asset.size_in_bytes > dst_size)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    ret = w25q128fv_assets_read(&asset, 0, dst, asset.size_in_bytes);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (w25q128fv_crc32_update(0, dst, asset.size_in_bytes) != asset.crc32)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    *size = asset.size_in_bytes;
+
+    return W25Q128FV_EC_OK;
+}
+
+static void start_block(void)
+{
+    /** <b>Local variable block_start:</b> @ref uint32_t Type variable used to hold the offset within the uncompressed data of the asset at which the block starts. */
+    uint32_t block_start = (decoder.first_block+decoder.block) * W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+
+    decoder.out_size = decoder.asset_size - block_start;
+    decoder.out_size = (decoder.out_size < W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES) ? decoder.out_size : W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+    decoder.block_remaining = block_table[decoder.block+1] - block_table[decoder.block];
+    decoder.is_raw = (decoder.block_remaining == decoder.out_size);
+    decoder.out_position = 0;
+    decoder.state = W25Q128FV_ASSETS_LZ4_TOKEN;
+
+    /* Decompress the block straight into the destination if the range covers all of it. */
+    if ((block_start >= decoder.offset) && ((block_start+decoder.out_size) <= decoder.end))
+    {
+        decoder.out = decoder.dst + (block_start-decoder.offset);
+    }
+    else
+    {
+        decoder.out = block_buffer;
+    }
+}
+
+static W25Q128FV_Status decode_lz4(const uint8_t *src, uint32_t size)
+{
+    /** <b>Local variable n:</b> @ref uint32_t Type variable used to hold the number of literals to be copied in the current step. */
+    uint32_t n;
+
+    while (size > 0)
+    {
+        switch (decoder.state)
+        {
+            case W25Q128FV_ASSETS_LZ4_TOKEN:
+                decoder.length = *src >> 4;
+                decoder.match_nibble = *src & 0x0F;
+                src++;
+                size--;
+                if (decoder.length == 15)
+                {
+                    decoder.state = W25Q128FV_ASSETS_LZ4_LITERAL_LENGTH;
+                }
+                else
+                {
+                    decoder.state = (decoder.length > 0) ? W25Q128FV_ASSETS_LZ4_LITERALS : W25Q128FV_ASSETS_LZ4_OFFSET_LOW;
+                }
+                break;
+
+            case W25Q128FV_ASSETS_LZ4_LITERAL_LENGTH:
+                decoder.length += *src;
+                if (*src != 255)
+                {
+                    decoder.state = (decoder.length > 0) ? W25Q128FV_ASSETS_LZ4_LITERALS : W25Q128FV_ASSETS_LZ4_OFFSET_LOW;
+                }
+                src++;
+                size--;
+                break;
+
+            case W25Q128FV_ASSETS_LZ4_LITERALS:
+                n = (size < decoder.length) ? size : decoder.length;
+                if (n > (decoder.out_size-decoder.out_position))
+                {
+                    return W25Q128FV_EC_ERR;
+                }
+                memcpy(&decoder.out[decoder.out_position], src, n);
+                decoder.out_position += n;
+                decoder.length -= n;
+                src += n;
+                size -= n;
+                if (decoder.length == 0)
+                {
+                    decoder.state = W25Q128FV_ASSETS_LZ4_OFFSET_LOW;
+                }
+                break;
+
+            case W25Q128FV_ASSETS_LZ4_OFFSET_LOW:
+                decoder.match_offset = *src;
+                src++;
+                size--;
+                decoder.state = W25Q128FV_ASSETS_LZ4_OFFSET_HIGH;
+                break;
+
+            case W25Q128FV_ASSETS_LZ4_OFFSET_HIGH:
+                decoder.match_offset |= ((uint32_t) *src) << 8;
+                src++;
+                size--;
+                decoder.length = decoder.match_nibble + W25Q128FV_ASSETS_LZ4_MIN_MATCH;
+                decoder.state = (decoder.match_nibble == 15) ? W25Q128FV_ASSETS_LZ4_MATCH_LENGTH : W25Q128FV_ASSETS_LZ4_TOKEN;
+                break;
+
+            default:
+                decoder.length += *src;
+                if (*src == 255)
+                {
+                    src++;
+                    size--;
+                    break;
+                }
+                src++;
+                size--;
+                decoder.state = W25Q128FV_ASSETS_LZ4_TOKEN;
+                break;
+        }
+
+        /* Copy the match as soon as its length is complete, byte by byte since it may overlap with itself. */
+        if ((decoder.state == W25Q128FV_ASSETS_LZ4_TOKEN) && (decoder.length > 0))
+        {
+            if ((decoder.match_offset == 0) || (decoder.match_offset > decoder.out_position) || (decoder.length > (decoder.out_size-decoder.out_position)))
+            {
+                return W25Q128FV_EC_ERR;
+            }
+            for (uint32_t i=0; i<decoder.length; i++)
+            {
+                decoder.out[decoder.out_position] = decoder.out[decoder.out_position - decoder.match_offset];
+                decoder.out_position++;
+            }
+            decoder.length = 0;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status decompress_chunk(uint8_t *chunk, uint16_t size)
+{
+    /** <b>Local variable n:</b> @ref uint32_t Type variable used to hold the number of bytes of the chunk that belong to the current block. */
+    uint32_t n;
+    /** <b>Local variable block_start:</b> @ref uint32_t Type variable used to hold the offset within the uncompressed data of the asset at which the current block starts. */
+    uint32_t block_start;
+    /** <b>Local variable from:</b> @ref uint32_t Type variable used to hold the offset within the uncompressed data of the asset at which the part of the current block that the range covers starts. */
+    uint32_t from;
+    /** <b>Local variable to:</b> @ref uint32_t Type variable used to hold the offset within the uncompressed data of the asset at which the part of the current block that the range covers ends. */
+    uint32_t to;
+
+    while (size > 0)
+    {
+        n = (size < decoder.block_remaining) ? size : decoder.block_remaining;
+        if (decoder.is_raw)
+        {
+            memcpy(&decoder.out[decoder.out_position], chunk, n);
+            decoder.out_position += n;
+        }
+        else if (decode_lz4(chunk, n) != W25Q128FV_EC_OK)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        chunk += n;
+        size -= n;
+        decoder.block_remaining -= n;
+        if (decoder.block_remaining > 0)
+        {
+            continue;
+        }
+
+        /* The block must end right after the literals of its last sequence, once all of its bytes were produced. */
+        if ((decoder.out_position != decoder.out_size) || ((decoder.is_raw==0) && (decoder.state!=W25Q128FV_ASSETS_LZ4_OFFSET_LOW)))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        if (decoder.out == block_buffer)
+        {
+            block_start = (decoder.first_block+decoder.block) * W25Q128FV_ASSETS_BLOCK_SIZE_IN_BYTES;
+            from = (decoder.offset > block_start) ? decoder.offset : block_start;
+            to = (decoder.end < (block_start+decoder.out_size)) ? decoder.end : (block_start+decoder.out_size);
+            memcpy(&decoder.dst[from-decoder.offset], &block_buffer[from-block_start], to-from);
+        }
+        decoder.block++;
+        if (decoder.block < decoder.total_blocks)
+        {
+            start_block();
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint32_t hash_name(const char *name, uint32_t size, uint32_t seed)
+{
+    /** <b>Local variable hash:</b> @ref uint32_t Type variable used to hold the hash being calculated. */
+    uint32_t hash = W25Q128FV_ASSETS_FNV_OFFSET_BASIS ^ (seed * W25Q128FV_ASSETS_SEED_MULTIPLIER);
+
+    for (uint32_t i=0; i<size; i++)
+    {
+        hash ^= (uint8_t) name[i];
+        hash *= W25Q128FV_ASSETS_FNV_PRIME;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/** @} */
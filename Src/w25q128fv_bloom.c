@@ -0,0 +1,157 @@
+#include "w25q128fv_bloom.h"
+
+#define W25Q128FV_BLOOM_BITS_PER_BLOCK      (W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES * 8)   /**< @brief Number of bits of each block of a Bloom filter. */
+#define W25Q128FV_BLOOM_MAX_HASHES          (16)    /**< @brief Maximum number of hashes of a Bloom filter. */
+
+static const uint8_t blocked_bits_per_key[] =  /**< @brief Bits per key that a blocked Bloom filter needs to match the false positive rate of a classic one with 1, 2, 3, etc. bits per key and the same number of hashes, which were obtained from the Poisson distribution of the number of keys per block. */
+{
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14, 15, 17, 18, 20, 21, 23, 25, 27, 29, 31
+};
+
+/**@brief   Gets the bits per key that a classic Bloom filter needs to meet a false positive rate target.
+ *
+ * @details The false positive rate of a classic Bloom filter with its optimal number of hashes is about 0.6185 raised
+ *          to its bits per key, which is evaluated here with integer arithmetic only.
+ *
+ * @param false_positive_ppm    False positive rate target in parts per million.
+ *
+ * @return  The bits per key.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t get_classic_bits_per_key(uint32_t false_positive_ppm);
+
+/**@brief   Mixes the bits of a key so that every bit of the result depends on every bit of the key.
+ *
+ * @param key   Key to be hashed.
+ *
+ * @return  The hash of the key.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t hash_key(uint32_t key);
+
+uint32_t w25q128fv_bloom_get_size(uint32_t total_keys, uint32_t false_positive_ppm)
+{
+    /** <b>Local variable classic_bits_per_key:</b> @ref uint32_t Type variable used to hold the bits per key that a classic Bloom filter would need. */
+    uint32_t classic_bits_per_key = get_classic_bits_per_key(false_positive_ppm);
+    /** <b>Local variable bits_per_key:</b> @ref uint32_t Type variable used to hold the bits per key of the blocked Bloom filter. */
+    uint32_t bits_per_key = W25Q128FV_BLOOM_MAX_BITS_PER_KEY;
+    /** <b>Local variable total_blocks:</b> @ref uint32_t Type variable used to hold the number of blocks of the Bloom filter. */
+    uint32_t total_blocks;
+
+    if (classic_bits_per_key == 0)
+    {
+        bits_per_key = 1;
+    }
+    else if (classic_bits_per_key <= sizeof(blocked_bits_per_key))
+    {
+        bits_per_key = blocked_bits_per_key[classic_bits_per_key-1];
+    }
+    total_blocks = (total_keys*bits_per_key + W25Q128FV_BLOOM_BITS_PER_BLOCK-1) / W25Q128FV_BLOOM_BITS_PER_BLOCK;
+
+    return total_blocks * W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES;
+}
+
+uint8_t w25q128fv_bloom_get_total_hashes(uint32_t false_positive_ppm)
+{
+    /** <b>Local variable total_hashes:</b> @ref uint32_t Type variable used to hold the optimal number of hashes (i.e., ln(2) times the bits per key of a classic Bloom filter). */
+    uint32_t total_hashes = (get_classic_bits_per_key(false_positive_ppm)*69 + 50) / 100;
+
+    if (total_hashes == 0)
+    {
+        return 1;
+    }
+
+    return (total_hashes > W25Q128FV_BLOOM_MAX_HASHES) ? W25Q128FV_BLOOM_MAX_HASHES : total_hashes;
+}
+
+void w25q128fv_bloom_add(uint8_t *bloom, uint32_t size_in_bytes, uint8_t total_hashes, uint32_t key)
+{
+    w25q128fv_bloom_add_to_window(bloom, 0, size_in_bytes, size_in_bytes, total_hashes, key);
+}
+
+void w25q128fv_bloom_add_to_window(uint8_t *window, uint32_t window_offset, uint32_t window_size, uint32_t size_in_bytes, uint8_t total_hashes, uint32_t key)
+{
+    /** <b>Local variable hash:</b> @ref uint32_t Type variable used to hold the hash of the key. */
+    uint32_t hash = hash_key(key);
+    /** <b>Local variable block:</b> @ref uint8_t Pointer type variable used to point to the block of the key. */
+    uint8_t *block;
+    /** <b>Local variable bit:</b> @ref uint32_t Type variable used to hold the bit of the block that is being set. */
+    uint32_t bit;
+    /** <b>Local variable offset:</b> @ref uint32_t Type variable used to hold the offset in bytes of the block of the key inside of the Bloom filter. */
+    uint32_t offset = (uint32_t) (((uint64_t) hash * (size_in_bytes/W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES)) >> 32) * W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES;
+
+    if ((offset<window_offset) || (offset>=(window_offset+window_size)))
+    {
+        return;
+    }
+    block = &window[offset - window_offset];
+    for (uint8_t i=0; i<total_hashes; i++)
+    {
+        /* Each byte of a new hash of the key gives the position of one of its bits inside of the 256 bits of the block. */
+        if ((i%4) == 0)
+        {
+            hash = hash_key(hash + i);
+        }
+        bit = (hash >> (8*(i%4))) & 0xFF;
+        block[bit/8] |= 1 << (bit%8);
+    }
+}
+
+uint8_t w25q128fv_bloom_may_contain(const uint8_t *bloom, uint32_t size_in_bytes, uint8_t total_hashes, uint32_t key)
+{
+    /** <b>Local variable hash:</b> @ref uint32_t Type variable used to hold the hash of the key. */
+    uint32_t hash = hash_key(key);
+    /** <b>Local variable block:</b> @ref uint8_t Pointer type variable used to point to the block of the key. */
+    const uint8_t *block = &bloom[(uint32_t) (((uint64_t) hash * (size_in_bytes/W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES)) >> 32) * W25Q128FV_BLOOM_BLOCK_SIZE_IN_BYTES];
+    /** <b>Local variable bit:</b> @ref uint32_t Type variable used to hold the bit of the block that is being checked. */
+    uint32_t bit;
+
+    for (uint8_t i=0; i<total_hashes; i++)
+    {
+        /* Each byte of a new hash of the key gives the position of one of its bits inside of the 256 bits of the block. */
+        if ((i%4) == 0)
+        {
+            hash = hash_key(hash + i);
+        }
+        bit = (hash >> (8*(i%4))) & 0xFF;
+        if ((block[bit/8] & (1 << (bit%8))) == 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static uint32_t get_classic_bits_per_key(uint32_t false_positive_ppm)
+{
+    /** <b>Local variable rate:</b> @ref uint32_t Type variable used to hold the false positive rate of the bits per key being evaluated, in parts per billion. */
+    uint32_t rate = 1000000000;
+    /** <b>Local variable bits_per_key:</b> @ref uint32_t Type variable used to hold the bits per key being evaluated. */
+    uint32_t bits_per_key = 0;
+
+    while ((bits_per_key<W25Q128FV_BLOOM_MAX_BITS_PER_KEY) && (rate>(false_positive_ppm*1000ULL)))
+    {
+        rate = ((uint64_t) rate * 6185) / 10000;
+        bits_per_key++;
+    }
+
+    return bits_per_key;
+}
+
+static uint32_t hash_key(uint32_t key)
+{
+    key ^= key >> 16;
+    key *= 0x85EBCA6B;
+    key ^= key >> 13;
+    key *= 0xC2B2AE35;
+    key ^= key >> 16;
+
+    return key;
+}
+
+/** @} */
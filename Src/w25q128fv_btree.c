@@ -0,0 +1,928 @@
+#include "w25q128fv_btree.h"
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include "w25q128fv_scan.h" // This custom Mortrack's library contains the word-wise check of erased data.
+#include <string.h>	// Library from which "memset()", "memcpy()" and "memmove()" are located at.
+
+#define W25Q128FV_BTREE_NODE_MAGIC          (0x5442)    /**< @brief Value that identifies a node of the @ref w25q128fv_btree (i.e., "BT" in little endian). */
+#define W25Q128FV_BTREE_NODE_TYPE_LEAF      (0x01)      /**< @brief Type of a node that holds key/value pairs. */
+#define W25Q128FV_BTREE_NODE_TYPE_INTERNAL  (0x02)      /**< @brief Type of a node that holds keys and children. */
+#define W25Q128FV_BTREE_NODE_FLAG_ROOT      (0x80)      /**< @brief Bit of the type of a node that is set if the node was written as the root of a complete version of the tree. */
+#define W25Q128FV_BTREE_NODE_HEADER_SIZE    (12)        /**< @brief Size in bytes of the header of a node. */
+#define W25Q128FV_BTREE_NODE_CRC_SIZE       (4)         /**< @brief Size in bytes of the CRC-32 at the beginning of a node, which covers the rest of the node. */
+
+/**@brief	Node of the @ref w25q128fv_btree , which takes exactly one Page of the W25Q128FV Device.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t crc32;         //!< CRC-32 of the rest of the node.
+    uint32_t generation;    //!< Generation of the half of the managed region into which the node was written.
+    uint16_t magic;         //!< Must be @ref W25Q128FV_BTREE_NODE_MAGIC .
+    uint8_t type;           //!< Either @ref W25Q128FV_BTREE_NODE_TYPE_LEAF or @ref W25Q128FV_BTREE_NODE_TYPE_INTERNAL , possibly with the @ref W25Q128FV_BTREE_NODE_FLAG_ROOT .
+    uint8_t count;          //!< Number of key/value pairs of a leaf or number of keys of an internal node.
+    union {
+        struct __attribute__ ((__packed__)) {
+            uint32_t keys[W25Q128FV_BTREE_LEAF_MAX_ENTRIES];        //!< Keys of the leaf in ascending order.
+            uint32_t values[W25Q128FV_BTREE_LEAF_MAX_ENTRIES];      //!< Value of each key of the leaf.
+        } leaf;
+        struct __attribute__ ((__packed__)) {
+            uint32_t keys[W25Q128FV_BTREE_INTERNAL_MAX_KEYS];       //!< Separator keys in ascending order, where the child at index i holds the keys that are greater than or equal to the key at index i-1 and smaller than the key at index i.
+            uint16_t children[W25Q128FV_BTREE_INTERNAL_MAX_KEYS+1]; //!< Page index, relative to the managed region, of each child.
+        } internal;
+        uint8_t raw[W25Q128FV_PAGE_SIZE_IN_BYTES - W25Q128FV_BTREE_NODE_HEADER_SIZE];   //!< Whole body of the node.
+    } body;
+} W25Q128FV_btree_node_t;
+
+static W25Q128FV_btree_def_t btree;                                         /**< @brief Copy of the W25Q128FV Copy-on-Write B+tree Definition parameters structure given at @ref init_w25q128fv_btree_module . */
+static uint8_t is_mounted;                                                  /**< @brief Flag that indicates whether the tree is mounted (i.e., 1) or not (i.e., 0). */
+static uint32_t half_pages;                                                 /**< @brief Number of Pages of each half of the managed region. */
+static uint8_t active_half;                                                 /**< @brief Half of the managed region (i.e., 0 or 1) into which nodes are currently appended. */
+static uint32_t active_generation;                                          /**< @brief Generation of the @ref active_half . */
+static uint32_t next_page;                                                  /**< @brief Index, relative to the @ref active_half , of the next free Page. */
+static uint16_t root_page;                                                  /**< @brief Page index, relative to the managed region, of the root of the latest version of the tree. */
+static uint8_t tree_height;                                                 /**< @brief Number of levels of the latest version of the tree, including the leaves. */
+static W25Q128FV_btree_node_t path_nodes[W25Q128FV_BTREE_MAX_HEIGHT];       /**< @brief Nodes on the path from the root that is being inserted into or copied. */
+static uint8_t path_positions[W25Q128FV_BTREE_MAX_HEIGHT];                  /**< @brief Position of the followed child at each level of @ref path_nodes . */
+static W25Q128FV_btree_node_t split_node;                                   /**< @brief Right half of the node that is being split. */
+static W25Q128FV_btree_node_t scratch_node;                                 /**< @brief Node used by the lookups and by the cursors. */
+static uint32_t split_keys[W25Q128FV_BTREE_INTERNAL_MAX_KEYS+1];            /**< @brief Keys of the node that is being split, including the inserted one. */
+static uint32_t split_values[W25Q128FV_BTREE_LEAF_MAX_ENTRIES+1];           /**< @brief Values of the leaf that is being split, including the inserted one. */
+static uint16_t split_children[W25Q128FV_BTREE_INTERNAL_MAX_KEYS+2];        /**< @brief Children of the internal node that is being split, including the inserted one. */
+static W25Q128FV_btree_node_t cache_nodes[W25Q128FV_BTREE_CACHE_NODES];     /**< @brief Nodes held by the RAM node cache. */
+static uint16_t cache_pages[W25Q128FV_BTREE_CACHE_NODES];                   /**< @brief Page index, relative to the managed region, of each node held by the RAM node cache. */
+static uint32_t cache_ages[W25Q128FV_BTREE_CACHE_NODES];                    /**< @brief Value of @ref cache_clock when each node of the RAM node cache was last used, where 0 means that the entry is empty. */
+static uint32_t cache_clock;                                                /**< @brief Counter that is incremented with each access to the RAM node cache. */
+
+/**@brief   Reads a node either from the RAM node cache or from the W25Q128FV Device, in which case it is also added into
+ *          the RAM node cache.
+ *
+ * @param page          Page index, relative to the managed region, of the node.
+ * @param[out] node     Pointer to the Memory Location Address where the node will be stored.
+ *
+ * @retval	W25Q128FV_EC_OK     if the node was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the node is not valid or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status read_node(uint16_t page, W25Q128FV_btree_node_t *node);
+
+/**@brief   Writes a node into the next free Page of the @ref active_half and adds it into the RAM node cache.
+ *
+ * @param node          Pointer to the Memory Location Address of the node, whose generation, magic, root flag and
+ *                      CRC-32 are filled by this function.
+ * @param is_root       1 if the node is the root of a complete version of the tree or 0 if otherwise.
+ * @param[out] page     Pointer to the Memory Location Address where the Page index, relative to the managed region, of
+ *                      the written node will be stored.
+ *
+ * @retval	W25Q128FV_EC_OK     if the node was successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the @ref active_half is full or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_node(W25Q128FV_btree_node_t *node, uint8_t is_root, uint16_t *page);
+
+/**@brief   Adds a node into the RAM node cache, replacing the least recently used one if it is full.
+ *
+ * @param page      Page index, relative to the managed region, of the node.
+ * @param[in] node  Pointer to the Memory Location Address of the node.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void cache_node(uint16_t page, W25Q128FV_btree_node_t *node);
+
+/**@brief   Tells whether a node has a valid magic and CRC-32.
+ *
+ * @param[in] node  Pointer to the Memory Location Address of the node.
+ *
+ * @return  1 if the node is valid or 0 if otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t is_node_valid(W25Q128FV_btree_node_t *node);
+
+/**@brief   Gets the position of the child of an internal node that covers a key.
+ *
+ * @param[in] node  Pointer to the Memory Location Address of the internal node.
+ * @param key       Key to be searched for.
+ *
+ * @return  The number of keys of the \p node that are smaller than or equal to \p key .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t find_child_position(W25Q128FV_btree_node_t *node, uint32_t key);
+
+/**@brief   Gets the position of a key inside of a leaf.
+ *
+ * @param[in] node  Pointer to the Memory Location Address of the leaf.
+ * @param key       Key to be searched for.
+ *
+ * @return  The number of keys of the \p node that are smaller than \p key .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t find_leaf_position(W25Q128FV_btree_node_t *node, uint32_t key);
+
+/**@brief   Inserts a key/value pair into a leaf, splitting its upper half into @ref split_node if it overflows.
+ *
+ * @param node              Pointer to the Memory Location Address of the leaf.
+ * @param position          Position at which the key is inserted.
+ * @param key               Key to be inserted.
+ * @param value             Value of the \p key .
+ * @param[out] separator    Pointer to the Memory Location Address where the first key of @ref split_node will be stored
+ *                          if the leaf was split.
+ *
+ * @return  1 if the leaf was split or 0 if otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t insert_into_leaf(W25Q128FV_btree_node_t *node, uint8_t position, uint32_t key, uint32_t value, uint32_t *separator);
+
+/**@brief   Inserts a separator key and its right child into an internal node, splitting its upper half into
+ *          @ref split_node if it overflows.
+ *
+ * @param node              Pointer to the Memory Location Address of the internal node.
+ * @param position          Position of the child that was split.
+ * @param[in,out] separator Pointer to the Memory Location Address of the separator key to be inserted, which is replaced
+ *                          by the key that is promoted to the parent if the internal node was split.
+ * @param right_child       Page index, relative to the managed region, of the right half of the child that was split.
+ *
+ * @return  1 if the internal node was split or 0 if otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t insert_into_internal(W25Q128FV_btree_node_t *node, uint8_t position, uint32_t *separator, uint16_t right_child);
+
+/**@brief   Copies the live nodes of the tree, in post-order, into the other half of the managed region, which then
+ *          becomes the @ref active_half .
+ *
+ * @retval	W25Q128FV_EC_OK     if the tree was successfully copied.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the live nodes do not fit into a half of the managed region or if anything else went
+ *                              wrong, in which case the tree has to be mounted again.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status compact_tree(void);
+
+/**@brief   Searches a half of the managed region for its latest complete root.
+ *
+ * @param half          Half of the managed region (i.e., 0 or 1).
+ * @param generation    Generation of the \p half .
+ * @param[out] is_found Pointer to the Memory Location Address where a 1 will be written if a root was found or a 0 if
+ *                      otherwise.
+ *
+ * @retval	W25Q128FV_EC_OK     if the \p half was successfully searched, in which case the state of the mounted tree is
+ *                              updated if a root was found.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status find_latest_root(uint8_t half, uint32_t generation, uint8_t *is_found);
+
+W25Q128FV_Status init_w25q128fv_btree_module(W25Q128FV_btree_def_t *btree_def)
+{
+    /* Validate the given W25Q128FV Copy-on-Write B+tree Definition parameters. */
+    if ((btree_def->total_sectors<2) || ((btree_def->total_sectors%2) != 0) || (btree_def->total_sectors>W25Q128FV_BTREE_MAX_REGION_SECTORS)
+        || ((btree_def->first_sector+btree_def->total_sectors) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Copy-on-Write B+tree Definition parameters. */
+    btree = *btree_def;
+    half_pages = (btree.total_sectors/2) * W25Q128FV_SECTOR_SIZE_IN_PAGES;
+    is_mounted = 0;
+    memset(cache_ages, 0, sizeof(cache_ages));
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_btree_format(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    is_mounted = 0;
+    memset(cache_ages, 0, sizeof(cache_ages));
+    for (uint32_t sector=0; sector<btree.total_sectors; sector++)
+    {
+        ret = w25q128fv_erase_sector(btree.first_sector + sector);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    /* Write an empty leaf as the root of the first version of the tree. */
+    active_half = 0;
+    active_generation = 1;
+    next_page = 0;
+    memset(&path_nodes[0], 0xFF, sizeof(W25Q128FV_btree_node_t));
+    path_nodes[0].type = W25Q128FV_BTREE_NODE_TYPE_LEAF;
+    path_nodes[0].count = 0;
+    ret = write_node(&path_nodes[0], 1, &root_page);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    tree_height = 1;
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_btree_mount(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable generations:</b> @ref uint32_t Type array variable used to hold the generation of each half of the managed region. */
+    uint32_t generations[2];
+    /** <b>Local variable is_half_valid:</b> @ref uint8_t Type array variable used to hold whether the first Page of each half of the managed region holds a valid node (i.e., 1) or not (i.e., 0). */
+    uint8_t is_half_valid[2];
+    /** <b>Local variable preferred_half:</b> @ref uint8_t Type variable used to hold the half of the managed region with the greatest generation. */
+    uint8_t preferred_half;
+    /** <b>Local variable is_found:</b> @ref uint8_t Type variable used to hold whether a root was found (i.e., 1) or not (i.e., 0). */
+    uint8_t is_found = 0;
+
+    is_mounted = 0;
+    memset(cache_ages, 0, sizeof(cache_ages));
+
+    /* Read the first node of each half, which was written with the generation of its half. */
+    for (uint8_t half=0; half<2; half++)
+    {
+        ret = w25q128fv_fast_read_flash_memory(btree.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + half*half_pages, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, (uint8_t *) &scratch_node);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        is_half_valid[half] = is_node_valid(&scratch_node);
+        generations[half] = scratch_node.generation;
+    }
+    if ((is_half_valid[0]==0) && (is_half_valid[1]==0))
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    /* Prefer the half with the greatest generation, taking into account its wrap-around, but fall back to the other one if a copy of the tree into it was interrupted. */
+    if ((is_half_valid[1] == 0) || ((is_half_valid[0] == 1) && ((int32_t) (generations[0] - generations[1]) > 0)))
+    {
+        preferred_half = 0;
+    }
+    else
+    {
+        preferred_half = 1;
+    }
+    ret = find_latest_root(preferred_half, generations[preferred_half], &is_found);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if ((is_found==0) && (is_half_valid[preferred_half^1]==1))
+    {
+        ret = find_latest_root(preferred_half^1, generations[preferred_half^1], &is_found);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    if (is_found == 0)
+    {
+        return W25Q128FV_EC_NA;
+    }
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_btree_insert(uint32_t key, uint32_t value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable page:</b> @ref uint16_t Type variable used to hold the Page index, relative to the managed region, of the node being visited or of the last written left node. */
+    uint16_t page;
+    /** <b>Local variable right_page:</b> @ref uint16_t Type variable used to hold the Page index, relative to the managed region, of the last written right node of a split. */
+    uint16_t right_page;
+    /** <b>Local variable level:</b> @ref uint8_t Type variable used to hold the level of the node being visited, where 0 is the root. */
+    uint8_t level;
+    /** <b>Local variable position:</b> @ref uint8_t Type variable used to hold the position of the key inside of its leaf. */
+    uint8_t position;
+    /** <b>Local variable is_split:</b> @ref uint8_t Type variable used to hold whether the last modified node was split (i.e., 1) or not (i.e., 0). */
+    uint8_t is_split = 0;
+    /** <b>Local variable separator:</b> @ref uint32_t Type variable used to hold the separator key to be inserted into the parent of a split node. */
+    uint32_t separator = 0;
+    /** <b>Local variable full_levels:</b> @ref uint8_t Type variable used to hold the number of full internal nodes from the root down the path. */
+    uint8_t full_levels;
+    /** <b>Local variable leaf:</b> @ref W25Q128FV_btree_node_t Pointer type variable used to point to the leaf of the key. */
+    W25Q128FV_btree_node_t *leaf;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Make sure that the active half has room for a copy of the whole path, with a split at every level plus a new root. */
+    if ((next_page + 2*tree_height + 1) > half_pages)
+    {
+        ret = compact_tree();
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if ((next_page + 2*tree_height + 1) > half_pages)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+
+    /* Descend from the root down to the leaf of the key. */
+    page = root_page;
+    for (level=0; level<tree_height; level++)
+    {
+        ret = read_node(page, &path_nodes[level]);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (path_nodes[level].type & W25Q128FV_BTREE_NODE_TYPE_LEAF)
+        {
+            break;
+        }
+        path_positions[level] = find_child_position(&path_nodes[level], key);
+        page = path_nodes[level].body.internal.children[path_positions[level]];
+    }
+    if (level != (tree_height-1))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Replace the value of the key or insert it into its leaf. */
+    leaf = &path_nodes[level];
+    position = find_leaf_position(leaf, key);
+    if ((position<leaf->count) && (leaf->body.leaf.keys[position]==key))
+    {
+        if (leaf->body.leaf.values[position] == value)
+        {
+            return W25Q128FV_EC_OK;
+        }
+        leaf->body.leaf.values[position] = value;
+    }
+    else
+    {
+        is_split = insert_into_leaf(leaf, position, key, value, &separator);
+    }
+
+    /* Refuse to grow the tree beyond its maximum height, which would happen if every internal node on the path is full. */
+    if ((is_split==1) && (tree_height==W25Q128FV_BTREE_MAX_HEIGHT))
+    {
+        for (full_levels=0; (full_levels<level) && (path_nodes[full_levels].count==W25Q128FV_BTREE_INTERNAL_MAX_KEYS); full_levels++);
+        if (full_levels == level)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+
+    /* Write the copies of the modified nodes from the leaf up to the root, where only the final root is flagged as such. */
+    while (1)
+    {
+        ret = write_node(&path_nodes[level], (level==0) && (is_split==0), &page);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (is_split == 1)
+        {
+            ret = write_node(&split_node, 0, &right_page);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+        }
+        if (level == 0)
+        {
+            break;
+        }
+        level--;
+        path_nodes[level].body.internal.children[path_positions[level]] = page;
+        if (is_split == 1)
+        {
+            is_split = insert_into_internal(&path_nodes[level], path_positions[level], &separator, right_page);
+        }
+    }
+
+    /* Grow the tree by one level if its root was split. */
+    if (is_split == 1)
+    {
+        memset(&path_nodes[0], 0xFF, sizeof(W25Q128FV_btree_node_t));
+        path_nodes[0].type = W25Q128FV_BTREE_NODE_TYPE_INTERNAL;
+        path_nodes[0].count = 1;
+        path_nodes[0].body.internal.keys[0] = separator;
+        path_nodes[0].body.internal.children[0] = page;
+        path_nodes[0].body.internal.children[1] = right_page;
+        ret = write_node(&path_nodes[0], 1, &page);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        tree_height++;
+    }
+    root_page = page;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_btree_find(uint32_t key, uint32_t *value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable page:</b> @ref uint16_t Type variable used to hold the Page index, relative to the managed region, of the node being visited. */
+    uint16_t page = root_page;
+    /** <b>Local variable position:</b> @ref uint8_t Type variable used to hold the position of the key inside of its leaf. */
+    uint8_t position;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    for (uint8_t level=0; level<tree_height; level++)
+    {
+        ret = read_node(page, &scratch_node);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (scratch_node.type & W25Q128FV_BTREE_NODE_TYPE_LEAF)
+        {
+            position = find_leaf_position(&scratch_node, key);
+            if ((position>=scratch_node.count) || (scratch_node.body.leaf.keys[position]!=key))
+            {
+                return W25Q128FV_EC_NA;
+            }
+            *value = scratch_node.body.leaf.values[position];
+            return W25Q128FV_EC_OK;
+        }
+        page = scratch_node.body.internal.children[find_child_position(&scratch_node, key)];
+    }
+
+    return W25Q128FV_EC_ERR;
+}
+
+W25Q128FV_Status w25q128fv_btree_seek(W25Q128FV_btree_cursor_t *cursor, uint32_t key)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable page:</b> @ref uint16_t Type variable used to hold the Page index, relative to the managed region, of the node being visited. */
+    uint16_t page = root_page;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    cursor->height = tree_height;
+    cursor->generation = active_generation;
+    for (uint8_t level=0; level<tree_height; level++)
+    {
+        ret = read_node(page, &scratch_node);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        cursor->pages[level] = page;
+        if (scratch_node.type & W25Q128FV_BTREE_NODE_TYPE_LEAF)
+        {
+            cursor->positions[level] = find_leaf_position(&scratch_node, key);
+            return W25Q128FV_EC_OK;
+        }
+        cursor->positions[level] = find_child_position(&scratch_node, key);
+        page = scratch_node.body.internal.children[cursor->positions[level]];
+    }
+
+    return W25Q128FV_EC_ERR;
+}
+
+W25Q128FV_Status w25q128fv_btree_next(W25Q128FV_btree_cursor_t *cursor, uint32_t *key, uint32_t *value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable leaf_level:</b> @ref uint8_t Type variable used to hold the level of the leaves of the version of the tree of the cursor. */
+    uint8_t leaf_level = cursor->height - 1;
+    /** <b>Local variable level:</b> @ref uint8_t Type variable used to hold the level of the node being visited. */
+    uint8_t level;
+
+    if ((is_mounted==0) || (cursor->generation!=active_generation) || (leaf_level>=W25Q128FV_BTREE_MAX_HEIGHT))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    while (1)
+    {
+        ret = read_node(cursor->pages[leaf_level], &scratch_node);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (cursor->positions[leaf_level] < scratch_node.count)
+        {
+            *key = scratch_node.body.leaf.keys[cursor->positions[leaf_level]];
+            *value = scratch_node.body.leaf.values[cursor->positions[leaf_level]];
+            cursor->positions[leaf_level]++;
+            return W25Q128FV_EC_OK;
+        }
+
+        /* Climb up to the nearest ancestor that still has a child to the right of the followed one. */
+        level = leaf_level;
+        do
+        {
+            if (level == 0)
+            {
+                return W25Q128FV_EC_NA;
+            }
+            level--;
+            ret = read_node(cursor->pages[level], &scratch_node);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+        } while (cursor->positions[level] >= scratch_node.count);
+
+        /* Descend through the leftmost children of that next child down to its first leaf. */
+        cursor->positions[level]++;
+        while (level < leaf_level)
+        {
+            cursor->pages[level+1] = scratch_node.body.internal.children[cursor->positions[level]];
+            level++;
+            cursor->positions[level] = 0;
+            if (level < leaf_level)
+            {
+                ret = read_node(cursor->pages[level], &scratch_node);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    return ret;
+                }
+            }
+        }
+    }
+}
+
+static W25Q128FV_Status read_node(uint16_t page, W25Q128FV_btree_node_t *node)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    for (uint8_t i=0; i<W25Q128FV_BTREE_CACHE_NODES; i++)
+    {
+        if ((cache_ages[i]!=0) && (cache_pages[i]==page))
+        {
+            cache_ages[i] = ++cache_clock;
+            memcpy(node, &cache_nodes[i], sizeof(W25Q128FV_btree_node_t));
+            return W25Q128FV_EC_OK;
+        }
+    }
+    ret = w25q128fv_fast_read_flash_memory(btree.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + page, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, (uint8_t *) node);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (is_node_valid(node) == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    cache_node(page, node);
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status write_node(W25Q128FV_btree_node_t *node, uint8_t is_root, uint16_t *page)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if (next_page >= half_pages)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    node->generation = active_generation;
+    node->magic = W25Q128FV_BTREE_NODE_MAGIC;
+    node->type = (node->type & ~W25Q128FV_BTREE_NODE_FLAG_ROOT) | ((is_root==1) ? W25Q128FV_BTREE_NODE_FLAG_ROOT : 0);
+    node->crc32 = w25q128fv_crc32_update(0, ((uint8_t *) node) + W25Q128FV_BTREE_NODE_CRC_SIZE, sizeof(W25Q128FV_btree_node_t) - W25Q128FV_BTREE_NODE_CRC_SIZE);
+    *page = active_half*half_pages + next_page;
+    ret = w25q128fv_write_flash_memory(btree.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + *page, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, (uint8_t *) node);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    next_page++;
+    cache_node(*page, node);
+
+    return W25Q128FV_EC_OK;
+}
+
+static void cache_node(uint16_t page, W25Q128FV_btree_node_t *node)
+{
+    /** <b>Local variable victim:</b> @ref uint8_t Type variable used to hold the entry of the RAM node cache to be replaced. */
+    uint8_t victim = 0;
+
+    for (uint8_t i=1; i<W25Q128FV_BTREE_CACHE_NODES; i++)
+    {
+        if (cache_ages[i] < cache_ages[victim])
+        {
+            victim = i;
+        }
+    }
+    cache_pages[victim] = page;
+    cache_ages[victim] = ++cache_clock;
+    memcpy(&cache_nodes[victim], node, sizeof(W25Q128FV_btree_node_t));
+}
+
+static uint8_t is_node_valid(W25Q128FV_btree_node_t *node)
+{
+    if (node->magic != W25Q128FV_BTREE_NODE_MAGIC)
+    {
+        return 0;
+    }
+    if ((node->type & W25Q128FV_BTREE_NODE_TYPE_LEAF) ? (node->count > W25Q128FV_BTREE_LEAF_MAX_ENTRIES) : (node->count > W25Q128FV_BTREE_INTERNAL_MAX_KEYS))
+    {
+        return 0;
+    }
+
+    return node->crc32 == w25q128fv_crc32_update(0, ((uint8_t *) node) + W25Q128FV_BTREE_NODE_CRC_SIZE, sizeof(W25Q128FV_btree_node_t) - W25Q128FV_BTREE_NODE_CRC_SIZE);
+}
+
+static uint8_t find_child_position(W25Q128FV_btree_node_t *node, uint32_t key)
+{
+    /** <b>Local variable low:</b> @ref uint8_t Type variable used to hold the lower bound of the binary search. */
+    uint8_t low = 0;
+    /** <b>Local variable high:</b> @ref uint8_t Type variable used to hold the upper bound of the binary search. */
+    uint8_t high = node->count;
+    /** <b>Local variable middle:</b> @ref uint8_t Type variable used to hold the middle point of the binary search. */
+    uint8_t middle;
+
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (node->body.internal.keys[middle] <= key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static uint8_t find_leaf_position(W25Q128FV_btree_node_t *node, uint32_t key)
+{
+    /** <b>Local variable low:</b> @ref uint8_t Type variable used to hold the lower bound of the binary search. */
+    uint8_t low = 0;
+    /** <b>Local variable high:</b> @ref uint8_t Type variable used to hold the upper bound of the binary search. */
+    uint8_t high = node->count;
+    /** <b>Local variable middle:</b> @ref uint8_t Type variable used to hold the middle point of the binary search. */
+    uint8_t middle;
+
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (node->body.leaf.keys[middle] < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static uint8_t insert_into_leaf(W25Q128FV_btree_node_t *node, uint8_t position, uint32_t key, uint32_t value, uint32_t *separator)
+{
+    /** <b>Local variable total:</b> @ref uint8_t Type variable used to hold the number of key/value pairs after the insertion. */
+    uint8_t total = node->count + 1;
+    /** <b>Local variable left_count:</b> @ref uint8_t Type variable used to hold the number of key/value pairs that stay in the leaf after a split. */
+    uint8_t left_count = total / 2;
+
+    /* Merge the new key/value pair into the split buffers. */
+    memcpy(split_keys, node->body.leaf.keys, position*sizeof(uint32_t));
+    memcpy(split_values, node->body.leaf.values, position*sizeof(uint32_t));
+    split_keys[position] = key;
+    split_values[position] = value;
+    memcpy(&split_keys[position+1], &node->body.leaf.keys[position], (node->count-position)*sizeof(uint32_t));
+    memcpy(&split_values[position+1], &node->body.leaf.values[position], (node->count-position)*sizeof(uint32_t));
+    if (total <= W25Q128FV_BTREE_LEAF_MAX_ENTRIES)
+    {
+        memcpy(node->body.leaf.keys, split_keys, total*sizeof(uint32_t));
+        memcpy(node->body.leaf.values, split_values, total*sizeof(uint32_t));
+        node->count = total;
+        return 0;
+    }
+
+    /* Move the upper half into a new leaf. */
+    memset(&split_node, 0xFF, sizeof(W25Q128FV_btree_node_t));
+    split_node.type = W25Q128FV_BTREE_NODE_TYPE_LEAF;
+    split_node.count = total - left_count;
+    memcpy(split_node.body.leaf.keys, &split_keys[left_count], split_node.count*sizeof(uint32_t));
+    memcpy(split_node.body.leaf.values, &split_values[left_count], split_node.count*sizeof(uint32_t));
+    memcpy(node->body.leaf.keys, split_keys, left_count*sizeof(uint32_t));
+    memcpy(node->body.leaf.values, split_values, left_count*sizeof(uint32_t));
+    node->count = left_count;
+    *separator = split_node.body.leaf.keys[0];
+
+    return 1;
+}
+
+static uint8_t insert_into_internal(W25Q128FV_btree_node_t *node, uint8_t position, uint32_t *separator, uint16_t right_child)
+{
+    /** <b>Local variable total:</b> @ref uint8_t Type variable used to hold the number of keys after the insertion. */
+    uint8_t total = node->count + 1;
+    /** <b>Local variable left_count:</b> @ref uint8_t Type variable used to hold the number of keys that stay in the internal node after a split. */
+    uint8_t left_count = total / 2;
+
+    /* Merge the new separator key and its right child into the split buffers. */
+    memcpy(split_keys, node->body.internal.keys, position*sizeof(uint32_t));
+    split_keys[position] = *separator;
+    memcpy(&split_keys[position+1], &node->body.internal.keys[position], (node->count-position)*sizeof(uint32_t));
+    memcpy(split_children, node->body.internal.children, (position+1)*sizeof(uint16_t));
+    split_children[position+1] = right_child;
+    memcpy(&split_children[position+2], &node->body.internal.children[position+1], (node->count-position)*sizeof(uint16_t));
+    if (total <= W25Q128FV_BTREE_INTERNAL_MAX_KEYS)
+    {
+        memcpy(node->body.internal.keys, split_keys, total*sizeof(uint32_t));
+        memcpy(node->body.internal.children, split_children, (total+1)*sizeof(uint16_t));
+        node->count = total;
+        return 0;
+    }
+
+    /* Move the upper half into a new internal node and promote the key in between. */
+    memset(&split_node, 0xFF, sizeof(W25Q128FV_btree_node_t));
+    split_node.type = W25Q128FV_BTREE_NODE_TYPE_INTERNAL;
+    split_node.count = total - left_count - 1;
+    memcpy(split_node.body.internal.keys, &split_keys[left_count+1], split_node.count*sizeof(uint32_t));
+    memcpy(split_node.body.internal.children, &split_children[left_count+1], (split_node.count+1)*sizeof(uint16_t));
+    memcpy(node->body.internal.keys, split_keys, left_count*sizeof(uint32_t));
+    memcpy(node->body.internal.children, split_children, (left_count+1)*sizeof(uint16_t));
+    node->count = left_count;
+    *separator = split_keys[left_count];
+
+    return 1;
+}
+
+static W25Q128FV_Status compact_tree(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable other_half:</b> @ref uint8_t Type variable used to hold the half of the managed region into which the tree is copied. */
+    uint8_t other_half = active_half ^ 1;
+    /** <b>Local variable level:</b> @ref uint8_t Type variable used to hold the level of the node being visited, where 0 is the root. */
+    uint8_t level = 0;
+    /** <b>Local variable page:</b> @ref uint16_t Type variable used to hold the Page index, relative to the managed region, of the last copied node. */
+    uint16_t page;
+
+    /* Erase the other half, whose nodes might still be in the RAM node cache. */
+    is_mounted = 0;
+    memset(cache_ages, 0, sizeof(cache_ages));
+    for (uint32_t sector=0; sector<(btree.total_sectors/2); sector++)
+    {
+        ret = w25q128fv_erase_sector(btree.first_sector + other_half*(btree.total_sectors/2) + sector);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    /* Copy the nodes in post-order so that the new Page of each child is known before its parent is written. */
+    ret = read_node(root_page, &path_nodes[0]);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    path_positions[0] = 0;
+    active_half = other_half;
+    active_generation++;
+    next_page = 0;
+    while (1)
+    {
+        if (((path_nodes[level].type&W25Q128FV_BTREE_NODE_TYPE_INTERNAL) != 0) && (path_positions[level] <= path_nodes[level].count))
+        {
+            if ((level+1) >= W25Q128FV_BTREE_MAX_HEIGHT)
+            {
+                return W25Q128FV_EC_ERR;
+            }
+            ret = read_node(path_nodes[level].body.internal.children[path_positions[level]], &path_nodes[level+1]);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            level++;
+            path_positions[level] = 0;
+            continue;
+        }
+        ret = write_node(&path_nodes[level], level==0, &page);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (level == 0)
+        {
+            break;
+        }
+        level--;
+        path_nodes[level].body.internal.children[path_positions[level]] = page;
+        path_positions[level]++;
+    }
+    root_page = page;
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status find_latest_root(uint8_t half, uint32_t generation, uint8_t *is_found)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable half_first_page:</b> @ref uint32_t Type variable used to hold the Page of the W25Q128FV Device where the \p half starts. */
+    uint32_t half_first_page = btree.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + half*half_pages;
+    /** <b>Local variable header:</b> @ref uint32_t Type array variable used to hold the header of a Page of the \p half , which is 32-bit aligned so that it can be checked for being erased one word at a time. */
+    uint32_t header[W25Q128FV_BTREE_NODE_HEADER_SIZE/4];
+    /** <b>Local variable low:</b> @ref uint32_t Type variable used to hold the lower bound of the binary search. */
+    uint32_t low = 0;
+    /** <b>Local variable high:</b> @ref uint32_t Type variable used to hold the upper bound of the binary search. */
+    uint32_t high = half_pages;
+    /** <b>Local variable middle:</b> @ref uint32_t Type variable used to hold the middle point of the binary search. */
+    uint32_t middle;
+    /** <b>Local variable page:</b> @ref uint16_t Type variable used to hold the Page index, relative to the managed region, of the root. */
+    uint16_t page;
+
+    /* Binary search the first free Page, since nodes are always appended in order. */
+    *is_found = 0;
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        ret = w25q128fv_fast_read_flash_memory(half_first_page + middle, 0, sizeof(header), (uint8_t *) header);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (w25q128fv_scan_is_blank((uint8_t *) header, sizeof(header)) == 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    /* Search backwards for the last valid root, skipping the nodes of an insertion that was interrupted by a power loss. */
+    for (uint32_t i=low; i>0; i--)
+    {
+        ret = w25q128fv_fast_read_flash_memory(half_first_page + i - 1, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, (uint8_t *) &scratch_node);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if ((is_node_valid(&scratch_node)==0) || (scratch_node.generation!=generation) || ((scratch_node.type&W25Q128FV_BTREE_NODE_FLAG_ROOT)==0))
+        {
+            continue;
+        }
+
+        /* Measure the height of the tree by descending through its leftmost children. */
+        page = half*half_pages + i - 1;
+        active_half = half;
+        active_generation = generation;
+        next_page = low;
+        root_page = page;
+        tree_height = 1;
+        while ((scratch_node.type&W25Q128FV_BTREE_NODE_TYPE_LEAF) == 0)
+        {
+            if (tree_height == W25Q128FV_BTREE_MAX_HEIGHT)
+            {
+                return W25Q128FV_EC_ERR;
+            }
+            ret = read_node(scratch_node.body.internal.children[0], &scratch_node);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            tree_height++;
+        }
+        *is_found = 1;
+        return W25Q128FV_EC_OK;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+/** @} */
@@ -0,0 +1,254 @@
+#include "w25q128fv_checkpoint.h"
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include <stddef.h> // Library from which "offsetof()" is located at.
+
+#define W25Q128FV_CHECKPOINT_MAGIC              (0x504B4357)    /**< @brief Value that identifies the header of a copy of the checkpoint (i.e., "WCKP" in little endian). */
+#define W25Q128FV_CHECKPOINT_MAX_READ_SIZE      (32768)         /**< @brief Maximum size in bytes of each Fast Read issued while loading a part, since the HAL SPI functions take 16-bit sizes. */
+
+/**@brief	Header at the first Page of a copy of the checkpoint.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;         //!< Must be @ref W25Q128FV_CHECKPOINT_MAGIC .
+    uint32_t crc32;         //!< CRC-32 of all the parts followed by the rest of the header.
+    uint32_t generation;    //!< Number that is incremented with each save, such that the copy with the greatest one holds the newest checkpoint.
+    uint32_t log_position;  //!< Log position covered by the checkpoint.
+    uint32_t payload_size;  //!< Total size in bytes of all the parts.
+} W25Q128FV_checkpoint_header_t;
+
+static W25Q128FV_checkpoint_def_t checkpoint;   /**< @brief Copy of the W25Q128FV RAM Index Checkpoint Definition parameters structure given at @ref init_w25q128fv_checkpoint_module . */
+
+/**@brief   Reads the headers of both copies of the checkpoint and sorts them from the newest to the oldest.
+ *
+ * @param[out] headers  Pointer to the Memory Location Address of an array of @ref W25Q128FV_CHECKPOINT_COPIES headers,
+ *                      where this function will store the header of each copy.
+ * @param[out] order    Pointer to the Memory Location Address of an array of @ref W25Q128FV_CHECKPOINT_COPIES copies,
+ *                      where this function will store the copies from the one with the newest valid header to the
+ *                      oldest one, where copies whose header is not valid go last.
+ * @param[out] is_valid Pointer to the Memory Location Address of an array of @ref W25Q128FV_CHECKPOINT_COPIES flags,
+ *                      where this function will store whether the header of each copy is valid (i.e., 1) or not (i.e.,
+ *                      0).
+ *
+ * @retval	W25Q128FV_EC_OK     if the headers were successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status read_copy_headers(W25Q128FV_checkpoint_header_t *headers, uint8_t *order, uint8_t *is_valid);
+
+/**@brief   Gets the first Page of the W25Q128FV Device of a copy of the checkpoint.
+ *
+ * @param copy  Copy of the checkpoint (i.e., 0 for A and 1 for B).
+ *
+ * @return  The first Page of the copy, which holds its header.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t get_copy_first_page(uint8_t copy);
+
+/**@brief   Gets the total size in bytes of a list of parts.
+ *
+ * @param[in] parts     Pointer to the Memory Location Address of the list of parts.
+ * @param total_parts   Number of parts in the \p parts list.
+ *
+ * @return  The total size in bytes of the parts.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t get_payload_size(W25Q128FV_checkpoint_part_t *parts, uint8_t total_parts);
+
+W25Q128FV_Status init_w25q128fv_checkpoint_module(W25Q128FV_checkpoint_def_t *checkpoint_def)
+{
+    /* Validate the given W25Q128FV RAM Index Checkpoint Definition parameters. */
+    if ((checkpoint_def->sectors_per_copy==0) || ((checkpoint_def->first_sector+W25Q128FV_CHECKPOINT_COPIES*checkpoint_def->sectors_per_copy) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV RAM Index Checkpoint Definition parameters. */
+    checkpoint = *checkpoint_def;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_checkpoint_save(W25Q128FV_checkpoint_part_t *parts, uint8_t total_parts, uint32_t log_position)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable headers:</b> @ref W25Q128FV_checkpoint_header_t Type array variable used to hold the header of each copy. */
+    W25Q128FV_checkpoint_header_t headers[W25Q128FV_CHECKPOINT_COPIES];
+    /** <b>Local variable order:</b> @ref uint8_t Type array variable used to hold the copies from the newest to the oldest. */
+    uint8_t order[W25Q128FV_CHECKPOINT_COPIES];
+    /** <b>Local variable is_valid:</b> @ref uint8_t Type array variable used to hold whether the header of each copy is valid (i.e., 1) or not (i.e., 0). */
+    uint8_t is_valid[W25Q128FV_CHECKPOINT_COPIES];
+    /** <b>Local variable header:</b> @ref W25Q128FV_checkpoint_header_t Type variable used to hold the header of the new checkpoint. */
+    W25Q128FV_checkpoint_header_t header;
+    /** <b>Local variable copy:</b> @ref uint8_t Type variable used to hold the copy into which the new checkpoint is written. */
+    uint8_t copy;
+    /** <b>Local variable offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, from the second Page of the copy, at which the next part is written. */
+    uint32_t offset = 0;
+    /** <b>Local variable crc:</b> @ref uint32_t Type variable used to hold the CRC-32 of the parts written so far. */
+    uint32_t crc = 0;
+
+    header.payload_size = get_payload_size(parts, total_parts);
+    if (header.payload_size > (checkpoint.sectors_per_copy*W25Q128FV_SECTOR_SIZE_IN_BYTES - W25Q128FV_PAGE_SIZE_IN_BYTES))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Write into the copy that does not hold the newest checkpoint, with the next generation. */
+    ret = read_copy_headers(headers, order, is_valid);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    copy = (is_valid[order[0]] == 1) ? (1-order[0]) : 0;
+    header.generation = (is_valid[order[0]] == 1) ? (headers[order[0]].generation+1) : 1;
+    header.log_position = log_position;
+    for (uint32_t sector=0; sector<checkpoint.sectors_per_copy; sector++)
+    {
+        ret = w25q128fv_erase_sector(checkpoint.first_sector + copy*checkpoint.sectors_per_copy + sector);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    /* Write the parts one after the other, starting at the second Page of the copy. */
+    for (uint8_t part=0; part<total_parts; part++)
+    {
+        if (parts[part].size_in_bytes == 0)
+        {
+            continue;
+        }
+        ret = w25q128fv_write_flash_memory(get_copy_first_page(copy) + 1 + offset/W25Q128FV_PAGE_SIZE_IN_BYTES, offset%W25Q128FV_PAGE_SIZE_IN_BYTES, parts[part].size_in_bytes, parts[part].data);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        crc = w25q128fv_crc32_update(crc, parts[part].data, parts[part].size_in_bytes);
+        offset += parts[part].size_in_bytes;
+    }
+
+    /* Write the header, whose magic is written last so that an incomplete checkpoint is never taken as a valid one. */
+    header.magic = W25Q128FV_CHECKPOINT_MAGIC;
+    header.crc32 = w25q128fv_crc32_update(crc, (uint8_t *) &header.generation, sizeof(header)-offsetof(W25Q128FV_checkpoint_header_t, generation));
+    ret = w25q128fv_write_flash_memory(get_copy_first_page(copy), sizeof(header.magic), sizeof(header)-sizeof(header.magic), ((uint8_t *) &header) + sizeof(header.magic));
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return w25q128fv_write_flash_memory(get_copy_first_page(copy), 0, sizeof(header.magic), (uint8_t *) &header.magic);
+}
+
+W25Q128FV_Status w25q128fv_checkpoint_load(W25Q128FV_checkpoint_part_t *parts, uint8_t total_parts, uint32_t *log_position)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable headers:</b> @ref W25Q128FV_checkpoint_header_t Type array variable used to hold the header of each copy. */
+    W25Q128FV_checkpoint_header_t headers[W25Q128FV_CHECKPOINT_COPIES];
+    /** <b>Local variable order:</b> @ref uint8_t Type array variable used to hold the copies from the newest to the oldest. */
+    uint8_t order[W25Q128FV_CHECKPOINT_COPIES];
+    /** <b>Local variable is_valid:</b> @ref uint8_t Type array variable used to hold whether the header of each copy is valid (i.e., 1) or not (i.e., 0). */
+    uint8_t is_valid[W25Q128FV_CHECKPOINT_COPIES];
+    /** <b>Local variable payload_size:</b> @ref uint32_t Type variable used to hold the total size in bytes of the given parts. */
+    uint32_t payload_size = get_payload_size(parts, total_parts);
+    /** <b>Local variable copy:</b> @ref uint8_t Type variable used to hold the copy being loaded. */
+    uint8_t copy;
+    /** <b>Local variable offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, from the second Page of the copy, of the next byte to be read. */
+    uint32_t offset;
+    /** <b>Local variable size:</b> @ref uint32_t Type variable used to hold the size in bytes of the Fast Read being issued. */
+    uint32_t size;
+    /** <b>Local variable crc:</b> @ref uint32_t Type variable used to hold the CRC-32 of the parts read so far. */
+    uint32_t crc;
+
+    ret = read_copy_headers(headers, order, is_valid);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Try the newest copy first and fall back to the other one if its CRC-32 does not match. */
+    for (uint8_t i=0; i<W25Q128FV_CHECKPOINT_COPIES; i++)
+    {
+        copy = order[i];
+        if ((is_valid[copy]==0) || (headers[copy].payload_size!=payload_size))
+        {
+            continue;
+        }
+        offset = 0;
+        crc = 0;
+        for (uint8_t part=0; part<total_parts; part++)
+        {
+            for (uint32_t part_offset=0; part_offset<parts[part].size_in_bytes; part_offset+=size)
+            {
+                size = parts[part].size_in_bytes - part_offset;
+                size = (size > W25Q128FV_CHECKPOINT_MAX_READ_SIZE) ? W25Q128FV_CHECKPOINT_MAX_READ_SIZE : size;
+                ret = w25q128fv_fast_read_flash_memory(get_copy_first_page(copy) + 1 + offset/W25Q128FV_PAGE_SIZE_IN_BYTES, offset%W25Q128FV_PAGE_SIZE_IN_BYTES, size, &parts[part].data[part_offset]);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    return ret;
+                }
+                offset += size;
+            }
+            crc = w25q128fv_crc32_update(crc, parts[part].data, parts[part].size_in_bytes);
+        }
+        crc = w25q128fv_crc32_update(crc, (uint8_t *) &headers[copy].generation, sizeof(W25Q128FV_checkpoint_header_t)-offsetof(W25Q128FV_checkpoint_header_t, generation));
+        if (crc == headers[copy].crc32)
+        {
+            *log_position = headers[copy].log_position;
+            return W25Q128FV_EC_OK;
+        }
+    }
+
+    return W25Q128FV_EC_NA;
+}
+
+static W25Q128FV_Status read_copy_headers(W25Q128FV_checkpoint_header_t *headers, uint8_t *order, uint8_t *is_valid)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    for (uint8_t copy=0; copy<W25Q128FV_CHECKPOINT_COPIES; copy++)
+    {
+        ret = w25q128fv_fast_read_flash_memory(get_copy_first_page(copy), 0, sizeof(W25Q128FV_checkpoint_header_t), (uint8_t *) &headers[copy]);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        is_valid[copy] = (headers[copy].magic==W25Q128FV_CHECKPOINT_MAGIC) && (headers[copy].payload_size <= (checkpoint.sectors_per_copy*W25Q128FV_SECTOR_SIZE_IN_BYTES - W25Q128FV_PAGE_SIZE_IN_BYTES));
+    }
+    order[0] = 0;
+    order[1] = 1;
+    if ((is_valid[1]==1) && ((is_valid[0]==0) || ((int32_t) (headers[1].generation-headers[0].generation) > 0)))
+    {
+        order[0] = 1;
+        order[1] = 0;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint32_t get_copy_first_page(uint8_t copy)
+{
+    return (checkpoint.first_sector + copy*checkpoint.sectors_per_copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES;
+}
+
+static uint32_t get_payload_size(W25Q128FV_checkpoint_part_t *parts, uint8_t total_parts)
+{
+    /** <b>Local variable payload_size:</b> @ref uint32_t Type variable used to hold the total size in bytes of the parts. */
+    uint32_t payload_size = 0;
+
+    for (uint8_t part=0; part<total_parts; part++)
+    {
+        payload_size += parts[part].size_in_bytes;
+    }
+
+    return payload_size;
+}
+
+/** @} */
@@ -0,0 +1,458 @@
+#include "w25q128fv_config.h"
+#include <string.h>	// Library from which "memset()", "memcpy()", "memcmp()" and "memmove()" are located at.
+#include <stddef.h>	// Library from which "offsetof()" is located at.
+
+#define W25Q128FV_CONFIG_MAGIC                  (0x47464357)    /**< @brief Value that identifies the header of a Sector of the @ref w25q128fv_config (i.e., "WCFG" in little endian). */
+#define W25Q128FV_CONFIG_RECORD_FLAGS_OFFSET    (6)             /**< @brief Offset in bytes of the flags byte inside the record header. */
+#define W25Q128FV_CONFIG_RECORD_FLAG_WRITTEN    (0x01)          /**< @brief Bit of the flags byte of a record header that is cleared once the whole record has been written. */
+
+/**@brief	Header at the beginning of each Sector of the @ref w25q128fv_config .
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;         //!< Must be @ref W25Q128FV_CONFIG_MAGIC .
+    uint32_t generation;    //!< Number that is incremented with each compaction, such that the Sector with the greatest one is the active one.
+} W25Q128FV_config_sector_header_t;
+
+/**@brief	Header that precedes the value of each record of the @ref w25q128fv_config .
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t key_hash;      //!< FNV-1a hash of the name of the parameter or @ref W25Q128FV_CONFIG_BLANK_KEY if no record was written here.
+    uint16_t size;          //!< Size in bytes of the value.
+    uint8_t flags;          //!< Flags whose bits are only ever cleared (e.g., @ref W25Q128FV_CONFIG_RECORD_FLAG_WRITTEN ).
+    uint8_t reserved;       //!< Reserved byte, which is left erased.
+} W25Q128FV_config_record_header_t;
+
+/**@brief	Entry of the RAM table that points to the latest version of a parameter.
+ */
+typedef struct {
+    uint32_t key_hash;      //!< FNV-1a hash of the name of the parameter.
+    uint16_t offset;        //!< Offset in bytes of the value inside of the @ref sector_image .
+    uint16_t size;          //!< Size in bytes of the value.
+} W25Q128FV_config_entry_t;
+
+static W25Q128FV_config_def_t config;                                   /**< @brief Copy of the W25Q128FV Configuration Store Definition parameters structure given at @ref init_w25q128fv_config_module . */
+static uint8_t is_loaded;                                               /**< @brief Flag that indicates whether the parameters have been loaded (i.e., 1) or not (i.e., 0). */
+static uint8_t active_copy;                                             /**< @brief Sector of the store (i.e., 0 for A and 1 for B) that is currently active. */
+static uint32_t active_generation;                                      /**< @brief Generation of the active Sector. */
+static uint32_t write_offset;                                           /**< @brief Offset in bytes, inside of the active Sector, where the next record will be appended. */
+static uint8_t sector_image[W25Q128FV_SECTOR_SIZE_IN_BYTES];            /**< @brief RAM image of the active Sector, which is read with a single bulk Fast Read and then kept up to date with each appended record. */
+static W25Q128FV_config_entry_t entries[W25Q128FV_CONFIG_MAX_KEYS];     /**< @brief RAM table of the latest version of each parameter, sorted by key hash. */
+static uint16_t total_entries;                                          /**< @brief Number of valid entries in @ref entries . */
+
+/**@brief   Searches the RAM table for a key hash via a binary search.
+ *
+ * @param key_hash  FNV-1a hash of the name of the parameter.
+ *
+ * @return  The index of the entry of the \p key_hash if it exists or, otherwise, the index at which it should be inserted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t find_entry(uint32_t key_hash);
+
+/**@brief   Makes an entry of the RAM table point to the latest version of a parameter, inserting it if needed.
+ *
+ * @param key_hash  FNV-1a hash of the name of the parameter.
+ * @param offset    Offset in bytes of the value inside of the @ref sector_image .
+ * @param size      Size in bytes of the value.
+ *
+ * @retval	W25Q128FV_EC_OK     if the entry was successfully updated.
+ * @retval  W25Q128FV_EC_ERR    if the RAM table is already full.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status update_entry(uint32_t key_hash, uint16_t offset, uint16_t size);
+
+/**@brief   Writes the latest version of every parameter into the inactive Sector and then loads it as the active one.
+ *
+ * @retval	W25Q128FV_EC_OK     if the store was successfully compacted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status compact_store(void);
+
+/**@brief   Erases a Sector of the store and writes the generation of its header, leaving its magic erased.
+ *
+ * @param copy          Sector of the store (i.e., 0 for A and 1 for B).
+ * @param generation    Generation to be written into the header.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status start_config_sector(uint8_t copy, uint32_t generation);
+
+/**@brief   Writes the magic of the header of a Sector of the store, which makes it valid.
+ *
+ * @details This is written only after everything else in the Sector so that a power loss never leaves a valid looking
+ *          Sector with incomplete contents.
+ *
+ * @param copy          Sector of the store (i.e., 0 for A and 1 for B).
+ *
+ * @retval	W25Q128FV_EC_OK     if the magic was successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status validate_config_sector(uint8_t copy);
+
+/**@brief   Writes data into a Sector of the store.
+ *
+ * @param copy          Sector of the store (i.e., 0 for A and 1 for B).
+ * @param offset        Offset in bytes inside of the Sector.
+ * @param size          Size in bytes of the data.
+ * @param[in] src       Pointer to the Memory Location Address where the data is located at.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_sector_data(uint8_t copy, uint32_t offset, uint32_t size, uint8_t *src);
+
+W25Q128FV_Status init_w25q128fv_config_module(W25Q128FV_config_def_t *config_def)
+{
+    /* Validate the given W25Q128FV Configuration Store Definition parameters. */
+    if ((config_def->first_sector+W25Q128FV_CONFIG_SECTORS) > W25Q128FV_TOTAL_SECTORS)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Configuration Store Definition parameters. */
+    config = *config_def;
+    is_loaded = 0;
+    total_entries = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_config_format(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    is_loaded = 0;
+    ret = w25q128fv_erase_sector(config.first_sector + 1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = start_config_sector(0, 1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = validate_config_sector(0);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return w25q128fv_config_mount();
+}
+
+W25Q128FV_Status w25q128fv_config_mount(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable headers:</b> @ref W25Q128FV_config_sector_header_t Type array variable used to hold the header of each Sector of the store. */
+    W25Q128FV_config_sector_header_t headers[W25Q128FV_CONFIG_SECTORS];
+    /** <b>Local variable record:</b> @ref W25Q128FV_config_record_header_t Type variable used to hold the header of the record being parsed. */
+    W25Q128FV_config_record_header_t record;
+    /** <b>Local variable offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, inside of the active Sector, of the record being parsed. */
+    uint32_t offset = sizeof(W25Q128FV_config_sector_header_t);
+
+    is_loaded = 0;
+    total_entries = 0;
+
+    /* Choose the valid Sector with the greatest generation, taking into account its wrap-around. */
+    for (uint8_t copy=0; copy<W25Q128FV_CONFIG_SECTORS; copy++)
+    {
+        ret = w25q128fv_fast_read_flash_memory((config.first_sector+copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(W25Q128FV_config_sector_header_t), (uint8_t *) &headers[copy]);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    if ((headers[0].magic!=W25Q128FV_CONFIG_MAGIC) && (headers[1].magic!=W25Q128FV_CONFIG_MAGIC))
+    {
+        return W25Q128FV_EC_NA;
+    }
+    if ((headers[1].magic != W25Q128FV_CONFIG_MAGIC) || ((headers[0].magic == W25Q128FV_CONFIG_MAGIC) && ((int32_t) (headers[0].generation - headers[1].generation) > 0)))
+    {
+        active_copy = 0;
+    }
+    else
+    {
+        active_copy = 1;
+    }
+    active_generation = headers[active_copy].generation;
+
+    /* Load the whole active Sector with a single bulk Fast Read. */
+    ret = w25q128fv_fast_read_flash_memory((config.first_sector+active_copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, W25Q128FV_SECTOR_SIZE_IN_BYTES, sector_image);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Parse the log of records, where later versions of a parameter replace the earlier ones. */
+    write_offset = W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    while ((offset+sizeof(W25Q128FV_config_record_header_t)) <= W25Q128FV_SECTOR_SIZE_IN_BYTES)
+    {
+        memcpy(&record, &sector_image[offset], sizeof(record));
+        if ((record.key_hash==W25Q128FV_CONFIG_BLANK_KEY) && (record.size==0xFFFF) && (record.flags==0xFF) && (record.reserved==0xFF))
+        {
+            write_offset = offset;
+            break;
+        }
+
+        /* Stop at a record that was not completely written, whose space will only be reclaimed by the next compaction. */
+        if ((record.flags&W25Q128FV_CONFIG_RECORD_FLAG_WRITTEN) || (record.key_hash==W25Q128FV_CONFIG_BLANK_KEY) || (record.size==0)
+            || (record.size>W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES) || ((offset+sizeof(record)+record.size) > W25Q128FV_SECTOR_SIZE_IN_BYTES))
+        {
+            break;
+        }
+        ret = update_entry(record.key_hash, offset+sizeof(record), record.size);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        offset += sizeof(record) + record.size;
+    }
+    is_loaded = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_config_get(uint32_t key_hash, uint8_t *dst, uint16_t size)
+{
+    /** <b>Local variable index:</b> @ref uint16_t Type variable used to hold the index of the entry of the parameter in the RAM table. */
+    uint16_t index;
+
+    if (is_loaded == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    index = find_entry(key_hash);
+    if ((index>=total_entries) || (entries[index].key_hash!=key_hash))
+    {
+        return W25Q128FV_EC_NA;
+    }
+    if (entries[index].size != size)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    memcpy(dst, &sector_image[entries[index].offset], size);
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_config_set(uint32_t key_hash, uint8_t *src, uint16_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable index:</b> @ref uint16_t Type variable used to hold the index of the entry of the parameter in the RAM table. */
+    uint16_t index;
+    /** <b>Local variable record:</b> @ref W25Q128FV_config_record_header_t Type variable used to hold the header of the record to be appended. */
+    W25Q128FV_config_record_header_t record;
+    /** <b>Local variable record_offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, inside of the active Sector, of the record to be appended. */
+    uint32_t record_offset;
+
+    if ((is_loaded==0) || (key_hash==W25Q128FV_CONFIG_BLANK_KEY) || (size==0) || (size>W25Q128FV_CONFIG_MAX_VALUE_SIZE_IN_BYTES))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Skip writing values that did not change, and new parameters for which there is no room in the RAM table. */
+    index = find_entry(key_hash);
+    if ((index<total_entries) && (entries[index].key_hash==key_hash))
+    {
+        if ((entries[index].size==size) && (memcmp(&sector_image[entries[index].offset], src, size)==0))
+        {
+            return W25Q128FV_EC_OK;
+        }
+    }
+    else if (total_entries == W25Q128FV_CONFIG_MAX_KEYS)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Compact the store if the new version does not fit into the rest of the active Sector. */
+    if ((write_offset+sizeof(record)+size) > W25Q128FV_SECTOR_SIZE_IN_BYTES)
+    {
+        ret = compact_store();
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if ((write_offset+sizeof(record)+size) > W25Q128FV_SECTOR_SIZE_IN_BYTES)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+
+    /* Append the record header, then the value and, finally, clear the written flag of the record header. */
+    memset(&record, 0xFF, sizeof(record));
+    record.key_hash = key_hash;
+    record.size = size;
+    record_offset = write_offset;
+    write_offset = W25Q128FV_SECTOR_SIZE_IN_BYTES; // NOTE: If anything fails from here on, the active Sector is closed so that the next version is written by a compaction rather than over a partially written record.
+    ret = write_sector_data(active_copy, record_offset, sizeof(record), (uint8_t *) &record);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = write_sector_data(active_copy, record_offset+sizeof(record), size, src);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    record.flags &= ~W25Q128FV_CONFIG_RECORD_FLAG_WRITTEN;
+    ret = write_sector_data(active_copy, record_offset+W25Q128FV_CONFIG_RECORD_FLAGS_OFFSET, 1, &record.flags);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Keep the RAM image and the RAM table up to date. */
+    memcpy(&sector_image[record_offset], &record, sizeof(record));
+    memcpy(&sector_image[record_offset+sizeof(record)], src, size);
+    update_entry(key_hash, record_offset+sizeof(record), size);
+    write_offset = record_offset + sizeof(record) + size;
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint16_t find_entry(uint32_t key_hash)
+{
+    /** <b>Local variable low:</b> @ref uint16_t Type variable used to hold the lower bound of the binary search. */
+    uint16_t low = 0;
+    /** <b>Local variable high:</b> @ref uint16_t Type variable used to hold the upper bound of the binary search. */
+    uint16_t high = total_entries;
+    /** <b>Local variable middle:</b> @ref uint16_t Type variable used to hold the middle point of the binary search. */
+    uint16_t middle;
+
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (entries[middle].key_hash < key_hash)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static W25Q128FV_Status update_entry(uint32_t key_hash, uint16_t offset, uint16_t size)
+{
+    /** <b>Local variable index:</b> @ref uint16_t Type variable used to hold the index of the entry of the parameter in the RAM table. */
+    uint16_t index = find_entry(key_hash);
+
+    if ((index>=total_entries) || (entries[index].key_hash!=key_hash))
+    {
+        if (total_entries == W25Q128FV_CONFIG_MAX_KEYS)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        memmove(&entries[index+1], &entries[index], (total_entries-index) * sizeof(W25Q128FV_config_entry_t));
+        total_entries++;
+        entries[index].key_hash = key_hash;
+    }
+    entries[index].offset = offset;
+    entries[index].size = size;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status compact_store(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable record:</b> @ref W25Q128FV_config_record_header_t Type variable used to hold the header of each record to be written. */
+    W25Q128FV_config_record_header_t record;
+    /** <b>Local variable offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, inside of the compacted Sector, where the next record will be written. */
+    uint32_t offset = sizeof(W25Q128FV_config_sector_header_t);
+    /** <b>Local variable other_copy:</b> @ref uint8_t Type variable used to hold the Sector of the store (i.e., 0 for A and 1 for B) into which the store is compacted. */
+    uint8_t other_copy = active_copy ^ 1;
+
+    /* Erase the other Sector and write its generation, leaving its magic erased until all the records are written. */
+    ret = start_config_sector(other_copy, active_generation+1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Write the latest version of each parameter, whose written flag is cleared right away since the Sector is not valid yet. */
+    memset(&record, 0xFF, sizeof(record));
+    record.flags &= ~W25Q128FV_CONFIG_RECORD_FLAG_WRITTEN;
+    for (uint16_t i=0; i<total_entries; i++)
+    {
+        record.key_hash = entries[i].key_hash;
+        record.size = entries[i].size;
+        ret = write_sector_data(other_copy, offset, sizeof(record), (uint8_t *) &record);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        ret = write_sector_data(other_copy, offset+sizeof(record), record.size, &sector_image[entries[i].offset]);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        offset += sizeof(record) + record.size;
+    }
+
+    /* Validate the compacted Sector and load it as the active one. */
+    ret = validate_config_sector(other_copy);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return w25q128fv_config_mount();
+}
+
+static W25Q128FV_Status start_config_sector(uint8_t copy, uint32_t generation)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = w25q128fv_erase_sector(config.first_sector + copy);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return write_sector_data(copy, offsetof(W25Q128FV_config_sector_header_t, generation), sizeof(generation), (uint8_t *) &generation);
+}
+
+static W25Q128FV_Status validate_config_sector(uint8_t copy)
+{
+    /** <b>Local variable magic:</b> @ref uint32_t Type variable used to hold the magic to be written. */
+    uint32_t magic = W25Q128FV_CONFIG_MAGIC;
+
+    return write_sector_data(copy, offsetof(W25Q128FV_config_sector_header_t, magic), sizeof(magic), (uint8_t *) &magic);
+}
+
+static W25Q128FV_Status write_sector_data(uint8_t copy, uint32_t offset, uint32_t size, uint8_t *src)
+{
+    return w25q128fv_write_flash_memory((config.first_sector+copy)*W25Q128FV_SECTOR_SIZE_IN_PAGES + offset/W25Q128FV_PAGE_SIZE_IN_BYTES, offset%W25Q128FV_PAGE_SIZE_IN_BYTES, size, src);
+}
+
+/** @} */
@@ -0,0 +1,67 @@
+#include "w25q128fv_copier.h"
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include <string.h>	// Library from which "memcmp()" is located at.
+
+static uint8_t *copy_dst;                                   /**< @brief Memory-mapped Memory Location Address of the internal Flash Memory where the next chunk is to be programmed. */
+static W25Q128FV_copier_program_callback_t copy_program;    /**< @brief Function that programs each chunk into the internal Flash Memory. */
+static uint32_t copy_crc32;                                 /**< @brief CRC-32 of the data copied so far, as read back from the internal Flash Memory. */
+
+/**@brief   Programs a chunk read by @ref w25q128fv_copy_to_internal_flash into the internal Flash Memory and checks it.
+ *
+ * @param[in] chunk Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK     if the chunk was successfully programmed and checked.
+ * @retval  W25Q128FV_EC_ERR    if the programmed internal Flash Memory does not match the chunk.
+ * @retval  other               value returned by @ref copy_program if it failed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status program_chunk(uint8_t *chunk, uint16_t size);
+
+W25Q128FV_Status w25q128fv_copy_to_internal_flash(uint32_t address, uint32_t size, uint8_t *dst, W25Q128FV_copier_program_callback_t program, uint32_t *crc32)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    copy_dst = dst;
+    copy_program = program;
+    copy_crc32 = 0;
+
+    ret = w25q128fv_stream_read(address, size, program_chunk);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (crc32 != NULL)
+    {
+        *crc32 = copy_crc32;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status program_chunk(uint8_t *chunk, uint16_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = copy_program(copy_dst, chunk, size);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Check the programmed chunk by reading it back from the memory-mapped internal Flash Memory and add it into the CRC-32 of the copy. */
+    if (memcmp(copy_dst, chunk, size) != 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    copy_crc32 = w25q128fv_crc32_update(copy_crc32, copy_dst, size);
+    copy_dst += size;
+
+    return W25Q128FV_EC_OK;
+}
+
+/** @} */
@@ -0,0 +1,255 @@
+#include "w25q128fv_counter.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define W25Q128FV_COUNTER_MAGIC                 (0x544E4357)    /**< @brief Value that identifies the header of a Sector of a counter (i.e., "WCNT" in little endian). */
+#define W25Q128FV_COUNTER_BITMAP_SIZE_IN_BYTES  (W25Q128FV_SECTOR_SIZE_IN_BYTES - W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES)  /**< @brief Size in bytes of the bitmap of each Sector of a counter. */
+
+/**@brief	Header at the beginning of each Sector of a counter.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;         //!< Must be @ref W25Q128FV_COUNTER_MAGIC .
+    uint32_t generation;    //!< Number that is incremented with each fold, such that the Sector with the greatest one is the active one.
+    uint32_t base_value;    //!< Value of the counter when none of the bits of the bitmap of this Sector are cleared.
+    uint32_t reserved;      //!< Reserved bytes, which are left erased.
+} W25Q128FV_counter_header_t;
+
+/**@brief	RAM state of a mounted counter.
+ */
+typedef struct {
+    uint32_t first_sector;  //!< First Flash Memory Sector of the W25Q128FV Device reserved for the counter.
+    uint8_t is_mounted;     //!< Flag that indicates whether the counter is mounted (i.e., 1) or not (i.e., 0).
+    uint8_t active_copy;    //!< Sector of the counter (i.e., 0 for A and 1 for B) that is currently active.
+    uint32_t generation;    //!< Generation of the active Sector.
+    uint32_t base_value;    //!< Base value of the active Sector.
+    uint32_t cleared_bits;  //!< Number of cleared bits in the bitmap of the active Sector.
+} W25Q128FV_counter_state_t;
+
+static W25Q128FV_counter_state_t counters[W25Q128FV_COUNTER_MAX_COUNTERS];  /**< @brief RAM state of each counter. */
+
+/**@brief   Erases a Sector of a counter and writes its header.
+ *
+ * @param counter   Pointer to the RAM state of the counter.
+ * @param copy      Sector of the counter (i.e., 0 for A and 1 for B).
+ * @param generation    Generation to be written into the header.
+ * @param base_value    Base value to be written into the header.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status start_counter_sector(W25Q128FV_counter_state_t *counter, uint8_t copy, uint32_t generation, uint32_t base_value);
+
+W25Q128FV_Status w25q128fv_counter_format(uint8_t counter_id, uint32_t first_sector, uint32_t initial_value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable counter:</b> @ref W25Q128FV_counter_state_t Pointer type variable used to point to the RAM state of the counter. */
+    W25Q128FV_counter_state_t *counter;
+
+    /* Validate the given counter and its Sectors. */
+    if ((counter_id>=W25Q128FV_COUNTER_MAX_COUNTERS) || ((first_sector+W25Q128FV_COUNTER_SECTORS_PER_COUNTER) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    counter = &counters[counter_id];
+    counter->is_mounted = 0;
+    counter->first_sector = first_sector;
+
+    /* Invalidate the B Sector and start the A one with the initial value. */
+    ret = w25q128fv_erase_sector(first_sector + 1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = start_counter_sector(counter, 0, 1, initial_value);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    counter->active_copy = 0;
+    counter->generation = 1;
+    counter->base_value = initial_value;
+    counter->cleared_bits = 0;
+    counter->is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_counter_mount(uint8_t counter_id, uint32_t first_sector)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable counter:</b> @ref W25Q128FV_counter_state_t Pointer type variable used to point to the RAM state of the counter. */
+    W25Q128FV_counter_state_t *counter;
+    /** <b>Local variable headers:</b> @ref W25Q128FV_counter_header_t Type array variable used to hold the header of each Sector of the counter. */
+    W25Q128FV_counter_header_t headers[W25Q128FV_COUNTER_SECTORS_PER_COUNTER];
+    /** <b>Local variable bitmap_page:</b> @ref uint32_t Type variable used to hold the Page of the W25Q128FV Device where the active Sector starts. */
+    uint32_t bitmap_page;
+    /** <b>Local variable low:</b> @ref uint32_t Type variable used to hold the lower bound of the binary search. */
+    uint32_t low = 0;
+    /** <b>Local variable high:</b> @ref uint32_t Type variable used to hold the upper bound of the binary search. */
+    uint32_t high = W25Q128FV_COUNTER_BITMAP_SIZE_IN_BYTES;
+    /** <b>Local variable middle:</b> @ref uint32_t Type variable used to hold the middle point of the binary search. */
+    uint32_t middle;
+    /** <b>Local variable bitmap_byte:</b> @ref uint8_t Type variable used to hold a byte of the bitmap of the active Sector. */
+    uint8_t bitmap_byte;
+
+    /* Validate the given counter and its Sectors. */
+    if ((counter_id>=W25Q128FV_COUNTER_MAX_COUNTERS) || ((first_sector+W25Q128FV_COUNTER_SECTORS_PER_COUNTER) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    counter = &counters[counter_id];
+    counter->is_mounted = 0;
+    counter->first_sector = first_sector;
+
+    /* Choose the valid Sector with the greatest generation, taking into account its wrap-around. */
+    for (uint8_t copy=0; copy<W25Q128FV_COUNTER_SECTORS_PER_COUNTER; copy++)
+    {
+        ret = w25q128fv_fast_read_flash_memory((first_sector+copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(W25Q128FV_counter_header_t), (uint8_t *) &headers[copy]);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    if ((headers[0].magic!=W25Q128FV_COUNTER_MAGIC) && (headers[1].magic!=W25Q128FV_COUNTER_MAGIC))
+    {
+        return W25Q128FV_EC_NA;
+    }
+    if ((headers[1].magic != W25Q128FV_COUNTER_MAGIC) || ((headers[0].magic == W25Q128FV_COUNTER_MAGIC) && ((int32_t) (headers[0].generation - headers[1].generation) > 0)))
+    {
+        counter->active_copy = 0;
+    }
+    else
+    {
+        counter->active_copy = 1;
+    }
+    counter->generation = headers[counter->active_copy].generation;
+    counter->base_value = headers[counter->active_copy].base_value;
+
+    /* Binary search the first byte of the bitmap that still has bits to be cleared, since the bits are cleared in order. */
+    bitmap_page = (first_sector+counter->active_copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES;
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        ret = w25q128fv_fast_read_flash_memory(bitmap_page + (W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES+middle)/W25Q128FV_PAGE_SIZE_IN_BYTES, (W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES+middle)%W25Q128FV_PAGE_SIZE_IN_BYTES, 1, &bitmap_byte);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (bitmap_byte == 0x00)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    counter->cleared_bits = low * 8;
+
+    /* Count the cleared bits of that byte, starting from its least significant bit. */
+    if (low < W25Q128FV_COUNTER_BITMAP_SIZE_IN_BYTES)
+    {
+        ret = w25q128fv_fast_read_flash_memory(bitmap_page + (W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES+low)/W25Q128FV_PAGE_SIZE_IN_BYTES, (W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES+low)%W25Q128FV_PAGE_SIZE_IN_BYTES, 1, &bitmap_byte);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        while ((bitmap_byte&0x01) == 0)
+        {
+            counter->cleared_bits++;
+            bitmap_byte >>= 1;
+        }
+    }
+    counter->is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_counter_increment(uint8_t counter_id)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable counter:</b> @ref W25Q128FV_counter_state_t Pointer type variable used to point to the RAM state of the counter. */
+    W25Q128FV_counter_state_t *counter;
+    /** <b>Local variable byte_offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, inside of the active Sector, of the byte that holds the bit to be cleared. */
+    uint32_t byte_offset;
+    /** <b>Local variable bitmap_byte:</b> @ref uint8_t Type variable used to hold the value to be programmed into that byte. */
+    uint8_t bitmap_byte;
+
+    if ((counter_id>=W25Q128FV_COUNTER_MAX_COUNTERS) || (counters[counter_id].is_mounted==0))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    counter = &counters[counter_id];
+
+    /* Fold the counter into its other Sector once all the bits of the active one have been cleared. */
+    if (counter->cleared_bits == W25Q128FV_COUNTER_INCREMENTS_PER_ERASE)
+    {
+        ret = start_counter_sector(counter, counter->active_copy^1, counter->generation+1, counter->base_value+counter->cleared_bits);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        counter->active_copy ^= 1;
+        counter->generation++;
+        counter->base_value += counter->cleared_bits;
+        counter->cleared_bits = 0;
+    }
+
+    /* Clear the next bit of the bitmap. */
+    byte_offset = W25Q128FV_COUNTER_HEADER_SIZE_IN_BYTES + counter->cleared_bits/8;
+    bitmap_byte = 0xFF << (counter->cleared_bits%8 + 1);
+    ret = w25q128fv_write_flash_memory((counter->first_sector+counter->active_copy)*W25Q128FV_SECTOR_SIZE_IN_PAGES + byte_offset/W25Q128FV_PAGE_SIZE_IN_BYTES, byte_offset%W25Q128FV_PAGE_SIZE_IN_BYTES, 1, &bitmap_byte);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    counter->cleared_bits++;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_counter_get(uint8_t counter_id, uint32_t *value)
+{
+    if ((counter_id>=W25Q128FV_COUNTER_MAX_COUNTERS) || (counters[counter_id].is_mounted==0))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    *value = counters[counter_id].base_value + counters[counter_id].cleared_bits;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status start_counter_sector(W25Q128FV_counter_state_t *counter, uint8_t copy, uint32_t generation, uint32_t base_value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_counter_header_t Type variable used to hold the header to be written. */
+    W25Q128FV_counter_header_t header;
+
+    ret = w25q128fv_erase_sector(counter->first_sector + copy);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    memset(&header, 0xFF, sizeof(header));
+    header.magic = W25Q128FV_COUNTER_MAGIC;
+    header.generation = generation;
+    header.base_value = base_value;
+
+    /* Write the magic only after the rest of the header so that a power loss never leaves a valid looking header with an incomplete base value. */
+    ret = w25q128fv_write_flash_memory((counter->first_sector+copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES, sizeof(header.magic), sizeof(header)-sizeof(header.magic), ((uint8_t *) &header) + sizeof(header.magic));
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return w25q128fv_write_flash_memory((counter->first_sector+copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(header.magic), (uint8_t *) &header.magic);
+}
+
+/** @} */
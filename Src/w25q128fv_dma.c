@@ -0,0 +1,63 @@
+#include "w25q128fv_dma.h"
+
+void w25q128fv_dma_clean(const void *buffer, uint32_t size)
+{
+#if W25Q128FV_DMA_POLICY == W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE
+    /** <b>Local variable start:</b> @ref uintptr_t Type variable used to hold the address of the first cache line that holds the buffer. */
+    uintptr_t start = ((uintptr_t) buffer) & ~((uintptr_t) W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES-1);
+
+    if (size > 0)
+    {
+        W25Q128FV_DMA_CLEAN_DCACHE(start, W25Q128FV_DMA_ROUND_UP_TO_LINE(((uintptr_t) buffer) + size - start));
+    }
+#else
+    (void) buffer;
+    (void) size;
+#endif
+}
+
+void w25q128fv_dma_invalidate(void *buffer, uint32_t size)
+{
+#if W25Q128FV_DMA_POLICY == W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE
+    if (size > 0)
+    {
+        W25Q128FV_DMA_INVALIDATE_DCACHE(buffer, size);
+    }
+#else
+    (void) buffer;
+    (void) size;
+#endif
+}
+
+uint32_t w25q128fv_dma_get_head_size(const void *buffer, uint32_t size)
+{
+#if W25Q128FV_DMA_POLICY == W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE
+    /** <b>Local variable head_size:</b> @ref uint32_t Type variable used to hold the number of bytes from the start of the buffer up to the next cache line. */
+    uint32_t head_size = (uint32_t) (-((uintptr_t) buffer)) & (W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES-1);
+
+    // NOTE: A buffer that does not cover a whole cache line is entirely received via the bounce buffer.
+    if ((head_size > size) || ((size-head_size) < W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES))
+    {
+        return size;
+    }
+    return head_size;
+#else
+    (void) buffer;
+    (void) size;
+    return 0;
+#endif
+}
+
+uint32_t w25q128fv_dma_get_body_size(const void *buffer, uint32_t size)
+{
+    /** <b>Local variable head_size:</b> @ref uint32_t Type variable used to hold the size in bytes of the head of the buffer. */
+    uint32_t head_size = w25q128fv_dma_get_head_size(buffer, size);
+
+#if W25Q128FV_DMA_POLICY == W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE
+    return (size-head_size) & ~((uint32_t) W25Q128FV_DMA_CACHE_LINE_SIZE_IN_BYTES-1);
+#else
+    return size - head_size;
+#endif
+}
+
+/** @} */
@@ -1,13 +1,8 @@
 #include "w25q128fv_driver.h"
+#include "w25q128fv_mempool.h" // This custom Mortrack's library contains the fixed-block memory pool from which the transient buffers are taken.
+#include "w25q128fv_dma.h" // This custom Mortrack's library contains the cache policy of the buffers into which data is received via DMA.
 #include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
 
-#define W25Q128FV_SECTOR_SIZE_IN_PAGES                          (16)        /**< @brief Size in pages of a single Sector of a W25Q128FV Flash Memory Device. */
-#define W25Q128FV_PAGE_SIZE_IN_BYTES                            (256)       /**< @brief Size in bytes of a single page of a W25Q128FV Flash Memory Device. */
-#define W25Q128FV_TOTAL_PAGES                                   (65356)     /**< @brief Total number of pages in a W25Q128FV Flash Memory Device. */
-#define W25Q128FV_TOTAL_SECTORS                                 (4085)      /**< @brief Total number of sectors in a W25Q128FV Flash Memory Device. */
-#define W25Q128FV_TOTAL_SECTORS_MINUS_ONE                       (4084)      /**< @brief Total number of sectors in a W25Q128FV Flash Memory Device minus one. */
-#define W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES              (16731136)  /**< @brief Total size in bytes that can be read/written in the W25Q128FV Flash Memory Device. */
-#define W25Q128FV_SECTOR_SIZE_IN_BYTES                          (4096)      /**< @brief Total size in bytes of a Sector in the W25Q128FV Flash Memory Device. @details The value of this definition should equal that of @ref W25Q128FV_SECTOR_SIZE_IN_PAGES times @ref W25Q128FV_PAGE_SIZE_IN_BYTES . */
 #define W25Q128FV_MAX_CONSECUTIVE_PROGRAMMABLE_BYTES            (255)       /**< @brief Total number of maximum consecutive programmable bytes that can be written at a single time (i.e., per request) in a W25Q128FV Flash Memory Device. */
 #define W25Q128FV_TWO_MAX_CONSECUTIVE_PROGRAMMABLE_BYTES        (510)       /**< @brief Twice the total number of maximum consecutive programmable bytes that can be written at a single time (i.e., per request) in a W25Q128FV Flash Memory Device. */
 #define W25Q128FV_ENABLE_RESET_INSTRUCTION                      (0x66)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Enable Reset Instruction. */
@@ -16,14 +11,165 @@
 #define W25Q128FV_READ_DATA_INSTRUCTION                         (0x03)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Read Data Instruction. */
 #define W25Q128FV_FAST_READ_INSTRUCTION                         (0x0B)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Fast Read Instruction. */
 #define W25Q128FV_SECTOR_ERASE_INSTRUCTION                      (0x20)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Sector Erase Instruction. */
+#define W25Q128FV_BLOCK_ERASE_64KB_INSTRUCTION                  (0xD8)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the 64KB Block Erase Instruction. */
 #define W25Q128FV_CHIP_ERASE_INSTRUCTION                        (0xC7)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Chip Erase Instruction. */
 #define W25Q128FV_PAGE_PROGRAM_INSTRUCTION                      (0x02)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Page Program Instruction. */
 #define W25Q128FV_PAGE_PROGRAM_INSTRUCTION_MAX_SIZE_IN_BYTES    (259)       /**< @brief Maximum number of bytes that can be contained in a single Page Program Instruction in a W25Q128FV Flash Memory Device. */
 #define W25Q128FV_WRITE_ENABLE_INSTRUCTION                      (0x06)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Write Enable Instruction. */
 #define W25Q128FV_WRITE_DISABLE_INSTRUCTION                     (0x04)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Write Disable Instruction. */
+#define W25Q128FV_READ_STATUS_REGISTER_1_INSTRUCTION            (0x05)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Read Status Register-1 Instruction. */
+#define W25Q128FV_ERASE_PROGRAM_SUSPEND_INSTRUCTION             (0x75)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Erase/Program Suspend Instruction. */
+#define W25Q128FV_ERASE_PROGRAM_RESUME_INSTRUCTION              (0x7A)      /**< @brief Byte value that the W25Q128FV Flash Memory Device interprets as the Erase/Program Resume Instruction. */
+#define W25Q128FV_STATUS_REGISTER_1_BUSY_BIT                    (0x01)      /**< @brief Mask of the BUSY bit (i.e., S0) inside the Status Register-1 of the W25Q128FV Flash Memory Device. */
+#define W25Q128FV_MAX_SPI_TRANSFER_SIZE_IN_BYTES                (32768)     /**< @brief Maximum number of bytes that this @ref w25q128fv requests in a single HAL SPI transfer, since the HAL SPI functions take 16-bit sizes. */
+#define W25Q128FV_READV_DISCARD_BUFFER_SIZE_IN_BYTES            (32)        /**< @brief Size in bytes of the @ref readv_discard_buffer . */
 
 static SPI_HandleTypeDef *p_hspi;                               /**< @brief Pointer to the SPI Handle Structure of the SPI that will be used in this @ref w25q128fv to write/read data to/from the W25Q128FV Flash Memory Module. @details This pointer's value is defined in the @ref init_w25q128fv_module function. */
 static W25Q128FV_peripherals_def_t *p_w25q128fv_peripherals;    /**< @brief Pointer to the W25Q128FV Device's Peripherals Definition Structure that will be used in this @ref w25q128fv to control the Peripherals towards which the terminals of the W25Q128FV device are connected to. @details This pointer's value is defined in the @ref init_w25q128fv_module function. */
+static uint8_t is_background_erase_pending = 0;                 /**< @brief Flag Variable used to indicate whether a Sector Erase started via @ref w25q128fv_start_erase_sector has not yet been confirmed as finished (i.e., 1) or not (i.e., 0). */
+static uint8_t is_background_erase_suspended = 0;               /**< @brief Flag Variable used to indicate whether the Sector Erase started via @ref w25q128fv_start_erase_sector is currently suspended (i.e., 1) or not (i.e., 0) by this @ref w25q128fv so that another Instruction could be sent to the W25Q128FV Device. */
+static uint32_t background_erase_resume_tick = 0;               /**< @brief Value of the @ref HAL_GetTick function at the moment in which the pending Sector Erase was started or last resumed. @details This is used to guarantee that the W25Q128FV Device is given at least 1ms to progress on that Sector Erase before suspending it again, since otherwise a busy foreground could keep it suspended forever. */
+static uint8_t readv_discard_buffer[W25Q128FV_READV_DISCARD_BUFFER_SIZE_IN_BYTES]; /**< @brief Buffer into which the @ref w25q128fv_readv function receives the bytes of the gaps between the requested ranges, which are discarded. */
+static uint8_t stream_read_buffers[2][W25Q128FV_DMA_ROUND_UP_TO_LINE(W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES)] W25Q128FV_DMA_BUFFER_ATTRIBUTES; /**< @brief Ping-pong buffers into which the @ref w25q128fv_stream_read function receives, via DMA, the chunks of data that it hands to its callback. */
+static const W25Q128FV_os_hooks_t *p_os_hooks = NULL;         /**< @brief Pointer to the W25Q128FV Driver Operating System hooks structure that was set via @ref w25q128fv_set_os_hooks , or \c NULL if this @ref w25q128fv busy-waits. */
+static uint8_t fallback_buffer[W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES] W25Q128FV_DMA_BUFFER_ATTRIBUTES;    /**< @brief Buffer that @ref take_transient_buffer hands out whenever the @ref w25q128fv_mempool is exhausted, which suffices since the functions of this @ref w25q128fv never run concurrently and never hold two transient buffers at once. */
+static uint8_t is_fallback_buffer_in_use = 0;                   /**< @brief Flag Variable used to indicate whether the @ref fallback_buffer is currently handed out (i.e., 1) or not (i.e., 0). */
+
+/**@brief   Suspends the Sector Erase that was started via @ref w25q128fv_start_erase_sector , if any is still in
+ *          progress, so that the W25Q128FV Flash Memory Device accepts Read and Page Program Instructions again.
+ *
+ * @note    If there is no such Sector Erase pending or if it was already suspended, then this function will do nothing.
+ * @note    If the pending Sector Erase turns out to have already finished, then this function will simply clear the
+ *          @ref is_background_erase_pending Flag Variable instead of suspending it.
+ *
+ * @retval	W25Q128FV_EC_OK     if there is no Sector Erase in progress after calling this function.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status suspend_background_erase(void);
+
+/**@brief   Sets the CS pin of the W25Q128FV Flash Memory Device low and sends it the Fast Read Instruction for a given
+ *          Flash Memory Address.
+ *
+ * @details If this function succeeds, then the CS pin is left low so that the caller can receive as many bytes as
+ *          desired via @ref receive_w25q128fv_data and then set it high via @ref set_cs_pin_high . Otherwise, the CS
+ *          pin is set back high by this function.
+ * @note    Any Sector Erase that is in progress in the background must have been suspended before calling this
+ *          function.
+ *
+ * @param w25q128fv_flash_memory_addr   W25Q128FV Device 24-bit Flash Memory Address from which it is desired to start
+ *                                      reading data.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Fast Read Instruction was successfully sent to the W25Q128FV Device.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status start_w25q128fv_fast_read(uint32_t w25q128fv_flash_memory_addr);
+
+/**@brief   Receives data from the W25Q128FV Flash Memory Device, while its CS pin is low, in as many HAL SPI transfers
+ *          of up to @ref W25Q128FV_MAX_SPI_TRANSFER_SIZE_IN_BYTES bytes as required.
+ *
+ * @param[out] dst  Pointer to the Memory Location Address where this function will store the received data.
+ * @param size      Size in bytes of the data to be received.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully received.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status receive_w25q128fv_data(uint8_t *dst, uint32_t size);
+
+#if W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES > 0
+/**@brief   Receives data from the W25Q128FV Flash Memory Device via DMA, keeping \p dst coherent with the data cache as
+ *          stated by the @ref W25Q128FV_DMA_POLICY .
+ *
+ * @details The whole cache lines of \p dst are received directly into it, whereas its unaligned head and tail bytes are
+ *          received into a bounce buffer taken via @ref take_transient_buffer and then copied into it.
+ *
+ * @param[out] dst  Pointer to the Memory Location Address where the received data will be stored.
+ * @param size      Size in bytes of the data to be received.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully received.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status receive_w25q128fv_data_via_dma(uint8_t *dst, uint32_t size);
+
+/**@brief   Receives data from the W25Q128FV Flash Memory Device via DMA into a buffer that starts at a cache line, in
+ *          as many DMA transfers as required, and invalidates its cache lines before and after each of them.
+ *
+ * @param[out] dst  Pointer to the Memory Location Address where the received data will be stored, whose cache lines
+ *                  must not be shared with any other data.
+ * @param size      Size in bytes of the data to be received.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully received.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status receive_w25q128fv_line_aligned_data_via_dma(uint8_t *dst, uint32_t size);
+#endif
+
+/**@brief   Waits for the DMA transfer that was started in the SPI given to @ref init_w25q128fv_module to finish.
+ *
+ * @note    This also waits for the interrupt-driven transfers that are started in that SPI when
+ *          @ref W25Q128FV_INTERRUPT_SHORT_COMMANDS is 1.
+ * @note    If the DMA transfer does not finish within @ref W25Q128FV_SPI_TIMEOUT milliseconds, then it will be aborted.
+ *
+ * @retval	W25Q128FV_EC_OK     if the DMA transfer was successfully finished.
+ * @retval  W25Q128FV_EC_NR     if the DMA transfer took longer than @ref W25Q128FV_SPI_TIMEOUT milliseconds.
+ * @retval  W25Q128FV_EC_ERR    if the SPI reported an error during the DMA transfer.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status wait_for_spi_dma_transfer(void);
+
+/**@brief   Sends a one byte Instruction, that has no address and no response, to the W25Q128FV Flash Memory Device.
+ *
+ * @param instruction   Byte value of the Instruction to send to the W25Q128FV Device.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Instruction was successfully sent to the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status send_w25q128fv_single_byte_instruction(uint8_t instruction);
+
+/**@brief   Sends a short Instruction to the W25Q128FV Flash Memory Device within a single CS frame and, optionally,
+ *          receives the bytes that the W25Q128FV Device answers meanwhile.
+ *
+ * @details If @ref W25Q128FV_INTERRUPT_SHORT_COMMANDS is 1, then the Instruction is sent via interrupts and waited for
+ *          via @ref wait_for_spi_dma_transfer . Otherwise, it is sent via polling.
+ *
+ * @param[in] instruction   Pointer to the Memory Location Address of the bytes of the Instruction.
+ * @param[out] response     Pointer to the Memory Location Address where the \p size bytes that the W25Q128FV Device
+ *                          answers while the Instruction is sent are to be stored, or \c NULL if they are not needed.
+ * @param size              Size in bytes of the Instruction.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Instruction was successfully sent to the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status transfer_w25q128fv_short_instruction(uint8_t *instruction, uint8_t *response, uint16_t size);
 
 /**@brief   Sends the Write Enable Instruction to the W25Q128FV Flash Memory Device.
  *
@@ -83,6 +229,59 @@ static void set_cs_pin_high(void);
  */
 static W25Q128FV_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status);
 
+/**@brief   Writes data into the W25Q128FV Flash Memory Device by formulating each Page Program Instruction in a given
+ *          buffer.
+ *
+ * @param start_page                    Flash Memory Page of the W25Q128FV Device from which it is desired to start
+ *                                      writing data.
+ * @param page_bytes_offset             Offset in bytes inside that Flash Memory Page.
+ * @param size                          Size in bytes to write into the W25Q128FV Device, which must fit into it.
+ * @param[in] src                       Pointer to the Memory Location Address where the data is located at.
+ * @param[out] page_program_instruction Pointer to the Memory Location Address of a buffer of at least
+ *                                      @ref W25Q128FV_PAGE_PROGRAM_INSTRUCTION_MAX_SIZE_IN_BYTES bytes.
+ *
+ * @return  The value that @ref w25q128fv_write_flash_memory is to return.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_flash_memory_via_buffer(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src, uint8_t *page_program_instruction);
+
+/**@brief   Takes a transient buffer of @ref W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES bytes, aligned to a cache line, from the
+ *          @ref w25q128fv_mempool or, if it is exhausted, the @ref fallback_buffer , so that no transfer fails because
+ *          other tasks or interrupts hold every block of the pool.
+ *
+ * @return  The Memory Location Address of the buffer, or \c NULL if both the pool and the @ref fallback_buffer are in use.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t *take_transient_buffer(void);
+
+/**@brief   Gives back a buffer that was taken via @ref take_transient_buffer .
+ *
+ * @param[in] buffer    Memory Location Address of the buffer, or \c NULL in which case this function does nothing.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void give_back_transient_buffer(uint8_t *buffer);
+
+void w25q128fv_set_os_hooks(const W25Q128FV_os_hooks_t *os_hooks)
+{
+    p_os_hooks = os_hooks;
+}
+
+void w25q128fv_delay(uint32_t delay_in_ms)
+{
+    if ((p_os_hooks!=NULL) && (p_os_hooks->delay!=NULL))
+    {
+        p_os_hooks->delay(delay_in_ms);
+        return;
+    }
+    HAL_Delay(delay_in_ms);
+}
+
 void init_w25q128fv_module(SPI_HandleTypeDef *hspi, W25Q128FV_peripherals_def_t *peripherals)
 {
     /* Persist the pointer to the specific SPI that is desired for the W25Q128FV Flash Memory module to use. */
@@ -90,6 +289,11 @@ void init_w25q128fv_module(SPI_HandleTypeDef *hspi, W25Q128FV_peripherals_def_t
 
     /* Persist the pointer to the W25Q128FV Device's Peripherals Definition Structure. */
     p_w25q128fv_peripherals = peripherals;
+
+#if W25Q128FV_HARDWARE_NSS == 1
+    /* Release the NSS output of the SPI so that the CS Pin of the W25Q128FV Device starts at High State. */
+    __HAL_SPI_DISABLE(p_hspi);
+#endif
 }
 
 W25Q128FV_Status w25q128fv_software_reset(void)
@@ -99,6 +303,13 @@ W25Q128FV_Status w25q128fv_software_reset(void)
     /** <b>Local variable reset_instruction:</b> @ref uint8_t array variable of two bytes in size that is used to hold the data containing both the Enable Reset and Reset Device instructions that are to be sent to the W25Q128FV Device in order to request to it a Software Reset. */
     uint8_t reset_instruction[2] = {W25Q128FV_ENABLE_RESET_INSTRUCTION, W25Q128FV_RESET_DEVICE_INSTRUCTION};
 
+    /* Wait for any Sector Erase started in the background to finish, since a Software Reset would abort it. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
     /* Send both the Enable Reset and the Reset Device Instructions to the W25Q128FV Flash Memory Device in order to request to it a Software Reset. */
     set_cs_pin_low();
     ret = HAL_SPI_Transmit(p_hspi, reset_instruction, 2, W25Q128FV_SPI_TIMEOUT);
@@ -109,7 +320,7 @@ W25Q128FV_Status w25q128fv_software_reset(void)
         return ret;
     }
 
-    HAL_Delay(1); // NOTE: The datasheet states that the W25Q128FV Flash Memory Device will take approximately 30us to reset and that no commands will be accepted during that time.
+    w25q128fv_delay(1); // NOTE: The datasheet states that the W25Q128FV Flash Memory Device will take approximately 30us to reset and that no commands will be accepted during that time.
     return W25Q128FV_EC_OK;
 }
 
@@ -122,6 +333,13 @@ W25Q128FV_Status w25q128fv_read_id(uint32_t *w25q128fv_id)
     /** <b>Local variable w25q128fv_resp:</b> @ref uint8_t array variable of three bytes in size that will be used to hold the response of the W25Q128FV Device after sending to it a request to read its JEDEC ID. */
     uint8_t w25q128fv_resp[3];
 
+    /* Suspend any Sector Erase that is in progress in the background so that the W25Q128FV Device accepts this Instruction. */
+    ret = suspend_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
     /* Request to read the JEDEC ID to the W25Q128FV Device. */
     set_cs_pin_low();
     ret = HAL_SPI_Transmit(p_hspi, &read_jedec_id_instruction, 1, W25Q128FV_SPI_TIMEOUT);
@@ -166,6 +384,13 @@ W25Q128FV_Status w25q128fv_read_flash_memory(uint32_t start_page, uint8_t page_b
         return W25Q128FV_EC_ERR;
     }
 
+    /* Suspend any Sector Erase that is in progress in the background so that the W25Q128FV Device accepts this Instruction. */
+    ret = suspend_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
     /** <b>Local variable read_data_instruction:</b> @ref uint8_t array type variable that is used to hold the data containing the Read Data instruction that is to be sent to the W25Q128FV Device in order to request reading data from it. */
     uint8_t read_data_instruction[4];
     read_data_instruction[0] = W25Q128FV_READ_DATA_INSTRUCTION;
@@ -183,10 +408,9 @@ W25Q128FV_Status w25q128fv_read_flash_memory(uint32_t start_page, uint8_t page_b
         return ret;
     }
 
-    /* Receive the W25Q128FV Device Read Data Instruction response. */
-    ret = HAL_SPI_Receive(p_hspi, dst, size, W25Q128FV_SPI_TIMEOUT);
+    /* Receive the W25Q128FV Device Read Data Instruction response, in as many HAL SPI transfers as its size requires. */
+    ret = receive_w25q128fv_data(dst, size);
     set_cs_pin_high();
-    ret = HAL_ret_handler(ret);
     if (ret != W25Q128FV_EC_OK)
     {
         return ret;
@@ -208,6 +432,13 @@ W25Q128FV_Status w25q128fv_fast_read_flash_memory(uint32_t start_page, uint8_t p
         return W25Q128FV_EC_ERR;
     }
 
+    /* Suspend any Sector Erase that is in progress in the background so that the W25Q128FV Device accepts this Instruction. */
+    ret = suspend_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
     /** <b>Local variable fast_read_instruction:</b> @ref uint8_t array type variable that is used to hold the data containing the Fast Read instruction that is to be sent to the W25Q128FV Device in order to request reading data from it. */
     uint8_t fast_read_instruction[5];
     fast_read_instruction[0] = W25Q128FV_FAST_READ_INSTRUCTION;
@@ -226,10 +457,9 @@ W25Q128FV_Status w25q128fv_fast_read_flash_memory(uint32_t start_page, uint8_t p
         return ret;
     }
 
-    /* Receive the W25Q128FV Device Read Data Instruction response. */
-    ret = HAL_SPI_Receive(p_hspi, dst, size, W25Q128FV_SPI_TIMEOUT);
+    /* Receive the W25Q128FV Device Fast Read Instruction response, in as many HAL SPI transfers as its size requires. */
+    ret = receive_w25q128fv_data(dst, size);
     set_cs_pin_high();
-    ret = HAL_ret_handler(ret);
     if (ret != W25Q128FV_EC_OK)
     {
         return ret;
@@ -238,6 +468,217 @@ W25Q128FV_Status w25q128fv_fast_read_flash_memory(uint32_t start_page, uint8_t p
     return W25Q128FV_EC_OK;
 }
 
+W25Q128FV_Status w25q128fv_readv(W25Q128FV_read_entry_t *entries, uint8_t total_entries)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable order:</b> @ref uint8_t array Type variable used to hold the indexes of the non-empty entries sorted by their addresses. */
+    uint8_t order[W25Q128FV_READV_MAX_ENTRIES];
+    /** <b>Local variable total_sorted:</b> @ref uint8_t Type variable used to hold the number of indexes in \c order . */
+    uint8_t total_sorted = 0;
+    /** <b>Local variable entry:</b> @ref W25Q128FV_read_entry_t Type pointer used to point to the entry being processed. */
+    W25Q128FV_read_entry_t *entry;
+    /** <b>Local variable covering_entry:</b> @ref W25Q128FV_read_entry_t Type pointer used to point to the entry whose destination holds the last bytes received by the current Fast Read Instruction. */
+    W25Q128FV_read_entry_t *covering_entry = NULL;
+    /** <b>Local variable next_addr:</b> @ref uint32_t Type variable used to hold the Flash Memory Address of the next byte that the current Fast Read Instruction will receive. */
+    uint32_t next_addr = 0;
+    /** <b>Local variable end_addr:</b> @ref uint32_t Type variable used to hold the Flash Memory Address that follows the last byte of the range of \c entry . */
+    uint32_t end_addr;
+    /** <b>Local variable size:</b> @ref uint32_t Type variable used to hold the number of bytes to be either copied, discarded or received. */
+    uint32_t size;
+
+    /* Validate the entries and sort the indexes of the non-empty ones by their addresses. */
+    if (total_entries > W25Q128FV_READV_MAX_ENTRIES)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    for (uint8_t i=0; i<total_entries; i++)
+    {
+        if ((entries[i].address > W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES) || (entries[i].size > (W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES-entries[i].address)))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        if (entries[i].size == 0)
+        {
+            continue;
+        }
+        /** <b>Local variable j:</b> @ref uint8_t Type variable used to hold the position at which the index of the current entry is to be inserted into \c order . */
+        uint8_t j = total_sorted;
+        while ((j > 0) && (entries[order[j-1]].address > entries[i].address))
+        {
+            order[j] = order[j-1];
+            j--;
+        }
+        order[j] = i;
+        total_sorted++;
+    }
+    if (total_sorted == 0)
+    {
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Suspend any Sector Erase that is in progress in the background so that the W25Q128FV Device accepts the Fast Read Instructions. */
+    ret = suspend_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    for (uint8_t i=0; i<total_sorted; i++)
+    {
+        entry = &entries[order[i]];
+        end_addr = entry->address + entry->size;
+
+        /* Finish the current Fast Read Instruction if over-reading up to this range would cost more than starting a new one. */
+        if ((covering_entry != NULL) && (entry->address > next_addr) && ((entry->address-next_addr) > W25Q128FV_READV_GAP_THRESHOLD_IN_BYTES))
+        {
+            set_cs_pin_high();
+            covering_entry = NULL;
+        }
+        if (covering_entry == NULL)
+        {
+            ret = start_w25q128fv_fast_read(entry->address);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            covering_entry = entry;
+            next_addr = entry->address;
+        }
+
+        /* Discard the bytes of the gap between the previous ranges and this one. */
+        while (next_addr < entry->address)
+        {
+            size = entry->address - next_addr;
+            size = (size > W25Q128FV_READV_DISCARD_BUFFER_SIZE_IN_BYTES) ? W25Q128FV_READV_DISCARD_BUFFER_SIZE_IN_BYTES : size;
+            ret = receive_w25q128fv_data(readv_discard_buffer, size);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                set_cs_pin_high();
+                return ret;
+            }
+            next_addr += size;
+        }
+
+        /* Copy the bytes of this range that were already received into the destination of a previous one. */
+        // NOTE: Since the ranges are visited in ascending order of their addresses, those bytes are all within the range of the entry that reached the furthest so far.
+        if (entry->address < next_addr)
+        {
+            size = ((end_addr < next_addr) ? end_addr : next_addr) - entry->address;
+            memcpy(entry->dst, covering_entry->dst + (entry->address-covering_entry->address), size);
+        }
+
+        /* Receive the rest of this range directly into its destination. */
+        if (end_addr > next_addr)
+        {
+            ret = receive_w25q128fv_data(entry->dst + (next_addr-entry->address), end_addr-next_addr);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                set_cs_pin_high();
+                return ret;
+            }
+            next_addr = end_addr;
+            covering_entry = entry;
+        }
+    }
+    set_cs_pin_high();
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_stream_read(uint32_t address, uint32_t size, W25Q128FV_stream_read_callback_t callback)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable current_buffer:</b> @ref uint8_t Type variable used to hold the index of the buffer of @ref stream_read_buffers that holds the chunk to be handed to the callback next. */
+    uint8_t current_buffer = 0;
+    /** <b>Local variable chunk_size:</b> @ref uint16_t Type variable used to hold the size in bytes of the chunk to be handed to the callback next. */
+    uint16_t chunk_size;
+    /** <b>Local variable next_chunk_size:</b> @ref uint16_t Type variable used to hold the size in bytes of the chunk that follows it, which is 0 if there is none. */
+    uint16_t next_chunk_size;
+
+    /* Validate that the Flash Memory Data to be read from the W25Q128FV Device actually exists in it. */
+    if ((address > W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES) || (size > (W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES-address)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (size == 0)
+    {
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Suspend any Sector Erase that is in progress in the background so that the W25Q128FV Device accepts this Instruction. */
+    ret = suspend_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Request fast reading the whole range and start receiving its first chunk. */
+    ret = start_w25q128fv_fast_read(address);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    chunk_size = (size > W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES) ? W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES : size;
+    w25q128fv_dma_invalidate(stream_read_buffers[0], W25Q128FV_DMA_ROUND_UP_TO_LINE(chunk_size));
+    ret = HAL_SPI_Receive_DMA(p_hspi, stream_read_buffers[0], chunk_size);
+    ret = HAL_ret_handler(ret);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        set_cs_pin_high();
+        return ret;
+    }
+    size -= chunk_size;
+
+    while (1)
+    {
+        ret = wait_for_spi_dma_transfer();
+        if (ret != W25Q128FV_EC_OK)
+        {
+            set_cs_pin_high();
+            return ret;
+        }
+        w25q128fv_dma_invalidate(stream_read_buffers[current_buffer], W25Q128FV_DMA_ROUND_UP_TO_LINE(chunk_size));
+
+        /* Start receiving the next chunk, if any, before handing the current one to the callback. */
+        next_chunk_size = (size > W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES) ? W25Q128FV_STREAM_READ_CHUNK_SIZE_IN_BYTES : size;
+        if (next_chunk_size > 0)
+        {
+            w25q128fv_dma_invalidate(stream_read_buffers[current_buffer^1], W25Q128FV_DMA_ROUND_UP_TO_LINE(next_chunk_size));
+            ret = HAL_SPI_Receive_DMA(p_hspi, stream_read_buffers[current_buffer^1], next_chunk_size);
+            ret = HAL_ret_handler(ret);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                set_cs_pin_high();
+                return ret;
+            }
+            size -= next_chunk_size;
+        }
+        else
+        {
+            set_cs_pin_high();
+        }
+
+        ret = callback(stream_read_buffers[current_buffer], chunk_size);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            if (next_chunk_size > 0)
+            {
+                HAL_SPI_Abort(p_hspi);
+                set_cs_pin_high();
+            }
+            return ret;
+        }
+        if (next_chunk_size == 0)
+        {
+            return W25Q128FV_EC_OK;
+        }
+        current_buffer ^= 1;
+        chunk_size = next_chunk_size;
+    }
+}
+
 W25Q128FV_Status w25q128fv_erase_sector(uint32_t sector_number)
 {
     /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
@@ -249,6 +690,13 @@ W25Q128FV_Status w25q128fv_erase_sector(uint32_t sector_number)
         return W25Q128FV_EC_ERR;
     }
 
+    /* Wait for any Sector Erase started in the background to finish, since Erase Instructions cannot be sent while another one is in progress or suspended. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
     /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
     ret = send_w25q128fv_write_enable_instruction();
     if (ret != W25Q128FV_EC_OK)
@@ -275,7 +723,7 @@ W25Q128FV_Status w25q128fv_erase_sector(uint32_t sector_number)
     {
         return ret;
     }
-    HAL_Delay(400); // The W25Q128FV datasheet states that a maximum of 400ms of time is required for a W25Q128FV Device in order for it to finish erasing a Sector.
+    w25q128fv_delay(400); // The W25Q128FV datasheet states that a maximum of 400ms of time is required for a W25Q128FV Device in order for it to finish erasing a Sector.
 
     /* Send the Write Disable Instruction to the W25Q128FV Flash Memory Device. */
     ret = send_w25q128fv_write_disable_instruction();
@@ -287,12 +735,23 @@ W25Q128FV_Status w25q128fv_erase_sector(uint32_t sector_number)
     return W25Q128FV_EC_OK;
 }
 
-W25Q128FV_Status w25q128fv_chip_erase(void)
+W25Q128FV_Status w25q128fv_erase_block_64kb(uint32_t block_number)
 {
     /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
     uint8_t ret;
-    /** <b>Local variable chip_erase_instruction:</b> @ref uint8_t variable that is used to hold the data containing the Chip Erase Instruction that is to be sent to the W25Q128FV Device in order to request to it to erase the entire data contained in the W25Q128FV Flash Memory Device. */
-    uint8_t chip_erase_instruction = W25Q128FV_CHIP_ERASE_INSTRUCTION;
+
+    /* Validate that the 64KB Block Number given via the \p block_number param actually exists in the W25Q128FV Flash Memory Device. */
+    if (block_number >= W25Q128FV_TOTAL_BLOCKS_64KB)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Wait for any Sector Erase started in the background to finish, since Erase Instructions cannot be sent while another one is in progress or suspended. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
 
     /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
     ret = send_w25q128fv_write_enable_instruction();
@@ -301,16 +760,26 @@ W25Q128FV_Status w25q128fv_chip_erase(void)
         return W25Q128FV_EC_ERR;
     }
 
-    /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
+    /* Formulate the 64KB Block Erase Instruction. */
+    /** <b>Local variable w25q128fv_flash_memory_addr:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address of the 64KB Block whose data is to be erased. */
+    uint32_t w25q128fv_flash_memory_addr = block_number * W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS * W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    /** <b>Local variable block_erase_instruction:</b> @ref uint8_t array type variable that is used to hold the data containing the 64KB Block Erase instruction that is to be sent to the W25Q128FV Device in order to erase the desired Block's data. */
+    uint8_t block_erase_instruction[4];
+    block_erase_instruction[0] = W25Q128FV_BLOCK_ERASE_64KB_INSTRUCTION;
+    block_erase_instruction[1] = (w25q128fv_flash_memory_addr>>16);
+    block_erase_instruction[2] = (w25q128fv_flash_memory_addr>>8);
+    block_erase_instruction[3] = (w25q128fv_flash_memory_addr);
+
+    /* Request erasing the desired 64KB Block of the W25Q128FV Device. */
     set_cs_pin_low();
-    ret = HAL_SPI_Transmit(p_hspi, &chip_erase_instruction, 1, W25Q128FV_SPI_TIMEOUT);
+    ret = HAL_SPI_Transmit(p_hspi, block_erase_instruction, 4, W25Q128FV_SPI_TIMEOUT);
     set_cs_pin_high();
     ret = HAL_ret_handler(ret);
     if (ret != W25Q128FV_EC_OK)
     {
         return ret;
     }
-    HAL_Delay(200000); // The W25Q128FV datasheet states that a maximum of 200s of time is required for a W25Q128FV Device in order for it to finish erasing a Sector.
+    w25q128fv_delay(W25Q128FV_BLOCK_64KB_ERASE_MAX_TIME_IN_MS); // The W25Q128FV datasheet states that a maximum of 2000ms of time is required for a W25Q128FV Device in order for it to finish erasing a 64KB Block.
 
     /* Send the Write Disable Instruction to the W25Q128FV Flash Memory Device. */
     ret = send_w25q128fv_write_disable_instruction();
@@ -322,29 +791,591 @@ W25Q128FV_Status w25q128fv_chip_erase(void)
     return W25Q128FV_EC_OK;
 }
 
-W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src)
+W25Q128FV_Status w25q128fv_chip_erase(void)
 {
     /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
     uint8_t ret;
-    /** <b>Local variable w25q128fv_flash_memory_addr_start:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address where it is desired to start writing data. */
-    uint32_t w25q128fv_flash_memory_addr_start = start_page * W25Q128FV_PAGE_SIZE_IN_BYTES + page_bytes_offset;
-    /** <b>Local variable w25q128fv_flash_memory_addr_end_plus_one:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address that is right after where it is expected for this function to write the last byte of the request data. */
-    uint32_t w25q128fv_flash_memory_addr_end_plus_one = w25q128fv_flash_memory_addr_start + size;
+    /** <b>Local variable chip_erase_instruction:</b> @ref uint8_t variable that is used to hold the data containing the Chip Erase Instruction that is to be sent to the W25Q128FV Device in order to request to it to erase the entire data contained in the W25Q128FV Flash Memory Device. */
+    uint8_t chip_erase_instruction = W25Q128FV_CHIP_ERASE_INSTRUCTION;
 
-    /* Validate that the Flash Memory Addresses where the Data to be written into the W25Q128FV Device actually exists in it. */
-    if (w25q128fv_flash_memory_addr_end_plus_one > W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES)
+    /* Wait for any Sector Erase started in the background to finish, since Erase Instructions cannot be sent while another one is in progress or suspended. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
+    ret = send_w25q128fv_write_enable_instruction();
+    if (ret != W25Q128FV_EC_OK)
     {
         return W25Q128FV_EC_ERR;
     }
 
-    /** <b>Local variable w25q128fv_flash_memory_page_start:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device Flash Memory Page where it is expected for that Device to start writing the desired data. */
-    uint32_t w25q128fv_flash_memory_page_start = start_page + page_bytes_offset/W25Q128FV_PAGE_SIZE_IN_BYTES;
-    /** <b>Local variable page_program_instruction:</b> @ref uint8_t array type variable that is used to hold the data containing the Page Program instruction that is to be sent to the W25Q128FV Device in order to request writing data into it. */
-    uint8_t page_program_instruction[W25Q128FV_PAGE_PROGRAM_INSTRUCTION_MAX_SIZE_IN_BYTES];
-    page_program_instruction[0] = W25Q128FV_PAGE_PROGRAM_INSTRUCTION;
-    /** <b>Local Pointer page_program_instruction_data:</b> @ref uint8_t Pointer type variable that is used to point to the byte at which the @ref page_program_instruction Local Variable holds the actual data to be sent to the W25Q128FV Device in the next Page Program Instruction. */
-    uint8_t *page_program_instruction_data = (uint8_t *) &page_program_instruction[4];
-    /** <b>Local variable currently_written_bytes:</b> @ref uint32_t Type variable that will hold the value standing for the currently written bytes into the W25Q128FV Flash Memory Device. */
+    /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
+    set_cs_pin_low();
+    ret = HAL_SPI_Transmit(p_hspi, &chip_erase_instruction, 1, W25Q128FV_SPI_TIMEOUT);
+    set_cs_pin_high();
+    ret = HAL_ret_handler(ret);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    w25q128fv_delay(200000); // The W25Q128FV datasheet states that a maximum of 200s of time is required for a W25Q128FV Device in order for it to finish erasing a Sector.
+
+    /* Send the Write Disable Instruction to the W25Q128FV Flash Memory Device. */
+    ret = send_w25q128fv_write_disable_instruction();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable page_program_instruction:</b> @ref uint8_t Type pointer used to point to the transient buffer in which the Page Program Instructions are formulated. */
+    uint8_t *page_program_instruction;
+
+    /* Validate that the Flash Memory Addresses where the Data to be written into the W25Q128FV Device actually exists in it. */
+    if ((start_page*W25Q128FV_PAGE_SIZE_IN_BYTES + page_bytes_offset + size) > W25Q128FV_FLASH_MEMORY_TOTAL_SIZE_IN_BYTES)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    page_program_instruction = take_transient_buffer();
+    if (page_program_instruction == NULL)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    ret = write_flash_memory_via_buffer(start_page, page_bytes_offset, size, src, page_program_instruction);
+    give_back_transient_buffer(page_program_instruction);
+
+    return ret;
+}
+
+W25Q128FV_Status w25q128fv_read_status_register_1(uint8_t *status_register_1)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable read_status_register_1_instruction:</b> @ref uint8_t array variable of two bytes in size that is used to hold the data containing the Read Status Register-1 instruction that is to be sent to the W25Q128FV Device, followed by a dummy byte during which that Device answers the Status Register-1 value. */
+    uint8_t read_status_register_1_instruction[2] = {W25Q128FV_READ_STATUS_REGISTER_1_INSTRUCTION, 0x00};
+    /** <b>Local variable w25q128fv_resp:</b> @ref uint8_t array variable of two bytes in size that is used to hold the bytes answered by the W25Q128FV Device while the Read Status Register-1 instruction is sent, where the second one is the Status Register-1 value. */
+    uint8_t w25q128fv_resp[2];
+
+    /* Request to read the Status Register-1 to the W25Q128FV Device and receive its value. */
+    ret = transfer_w25q128fv_short_instruction(read_status_register_1_instruction, w25q128fv_resp, 2);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    *status_register_1 = w25q128fv_resp[1];
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_start_erase_sector(uint32_t sector_number)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    /* Validate that the Sector Number given via the \p sector_number param actually exists in the W25Q128FV Flash Memory Device. */
+    if (sector_number > W25Q128FV_TOTAL_SECTORS_MINUS_ONE)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Wait for any previous Sector Erase started in the background to finish, since only one of them can be in progress at a time. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
+    ret = send_w25q128fv_write_enable_instruction();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Formulate the Sector Erase Instruction. */
+    /** <b>Local variable w25q128fv_flash_memory_addr:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address of the Sector whose data is to be erased. */
+    uint32_t w25q128fv_flash_memory_addr = sector_number * W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    /** <b>Local variable sector_erase_instruction:</b> @ref uint8_t array type variable that is used to hold the data containing the Sector Erase instruction that is to be sent to the W25Q128FV Device in order to erase the desired Sector's data. */
+    uint8_t sector_erase_instruction[4];
+    sector_erase_instruction[0] = W25Q128FV_SECTOR_ERASE_INSTRUCTION;
+    sector_erase_instruction[1] = (w25q128fv_flash_memory_addr>>16);
+    sector_erase_instruction[2] = (w25q128fv_flash_memory_addr>>8);
+    sector_erase_instruction[3] = (w25q128fv_flash_memory_addr);
+
+    /* Request erasing the desired Sector of the W25Q128FV Device without waiting for it to finish. */
+    set_cs_pin_low();
+    ret = HAL_SPI_Transmit(p_hspi, sector_erase_instruction, 4, W25Q128FV_SPI_TIMEOUT);
+    set_cs_pin_high();
+    ret = HAL_ret_handler(ret);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    // NOTE: No Write Disable Instruction is sent here because the W25Q128FV Device ignores it while busy and it clears its Write Enable Latch by itself once the Sector Erase finishes.
+    is_background_erase_pending = 1;
+    is_background_erase_suspended = 0;
+    background_erase_resume_tick = HAL_GetTick();
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_poll_background_erase(uint8_t *is_erase_in_progress)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable status_register_1:</b> @ref uint8_t Type variable used to hold the value of the Status Register-1 of the W25Q128FV Device. */
+    uint8_t status_register_1;
+
+    /* Nothing is to be polled if no Sector Erase was started in the background. */
+    if (is_background_erase_pending == 0)
+    {
+        *is_erase_in_progress = 0;
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Resume the pending Sector Erase if this @ref w25q128fv suspended it in order to send another Instruction. */
+    if (is_background_erase_suspended == 1)
+    {
+        ret = send_w25q128fv_single_byte_instruction(W25Q128FV_ERASE_PROGRAM_RESUME_INSTRUCTION);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        is_background_erase_suspended = 0;
+        background_erase_resume_tick = HAL_GetTick();
+        *is_erase_in_progress = 1;
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Check whether the W25Q128FV Device has finished erasing the Sector. */
+    ret = w25q128fv_read_status_register_1(&status_register_1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if ((status_register_1 & W25Q128FV_STATUS_REGISTER_1_BUSY_BIT) == 0)
+    {
+        is_background_erase_pending = 0;
+        *is_erase_in_progress = 0;
+    }
+    else
+    {
+        *is_erase_in_progress = 1;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_wait_for_background_erase(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable is_erase_in_progress:</b> @ref uint8_t Type variable used to hold whether the pending Sector Erase is still in progress (i.e., 1) or not (i.e., 0). */
+    uint8_t is_erase_in_progress;
+
+    for (uint16_t elapsed_time_in_ms=0; elapsed_time_in_ms<=W25Q128FV_SECTOR_ERASE_MAX_TIME_IN_MS; elapsed_time_in_ms++)
+    {
+        ret = w25q128fv_poll_background_erase(&is_erase_in_progress);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (is_erase_in_progress == 0)
+        {
+            return W25Q128FV_EC_OK;
+        }
+        w25q128fv_delay(1);
+    }
+
+    return W25Q128FV_EC_NR;
+}
+
+W25Q128FV_Status w25q128fv_try_start_erase_sector(uint32_t sector_number, uint8_t *is_started)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable is_erase_in_progress:</b> @ref uint8_t Type variable used to hold whether the previous Sector Erase started in the background is still in progress (i.e., 1) or not (i.e., 0). */
+    uint8_t is_erase_in_progress;
+
+    /* Leave the Sector Erase for later if the previous one is still in progress, since starting it now would wait for that one. */
+    *is_started = 0;
+    ret = w25q128fv_poll_background_erase(&is_erase_in_progress);
+    if ((ret!=W25Q128FV_EC_OK) || (is_erase_in_progress==1))
+    {
+        return ret;
+    }
+
+    ret = w25q128fv_start_erase_sector(sector_number);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    *is_started = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status send_w25q128fv_write_enable_instruction(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable write_enable_instruction:</b> @ref uint8_t variable that is used to hold the data containing the Write Enable Instructions that is to be sent to the W25Q128FV Device in order to request to it to enable Page Program, Quad Page Program, Sector Erase, Block Erase, Chip Erase, Write Status Register and Erase/Program Security Registers instructions. */
+    uint8_t write_enable_instruction = W25Q128FV_WRITE_ENABLE_INSTRUCTION;
+
+    /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
+    ret = send_w25q128fv_single_byte_instruction(write_enable_instruction);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status send_w25q128fv_write_disable_instruction(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable write_disable_instruction:</b> @ref uint8_t variable that is used to hold the data containing the Write Disable Instructions that is to be sent to the W25Q128FV Device in order to disable Page Program, Quad Page Program, Sector Erase, Block Erase, Chip Erase, Write Status Register and Erase/Program Security Registers instructions. */
+    uint8_t write_disable_instruction = W25Q128FV_WRITE_DISABLE_INSTRUCTION;
+
+    /* Send the Write Disable Instruction to the W25Q128FV Flash Memory Device. */
+    ret = send_w25q128fv_single_byte_instruction(write_disable_instruction);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status suspend_background_erase(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable status_register_1:</b> @ref uint8_t Type variable used to hold the value of the Status Register-1 of the W25Q128FV Device. */
+    uint8_t status_register_1;
+
+    if ((is_background_erase_pending==0) || (is_background_erase_suspended==1))
+    {
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Check whether the pending Sector Erase has already finished, in which case there is nothing to suspend. */
+    ret = w25q128fv_read_status_register_1(&status_register_1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if ((status_register_1 & W25Q128FV_STATUS_REGISTER_1_BUSY_BIT) == 0)
+    {
+        is_background_erase_pending = 0;
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Give the W25Q128FV Device some time to progress on the Sector Erase if it was just started or resumed. */
+    if (HAL_GetTick() == background_erase_resume_tick)
+    {
+        w25q128fv_delay(1);
+    }
+
+    /* Send the Erase/Program Suspend Instruction to the W25Q128FV Flash Memory Device. */
+    ret = send_w25q128fv_single_byte_instruction(W25Q128FV_ERASE_PROGRAM_SUSPEND_INSTRUCTION);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    is_background_erase_suspended = 1;
+    w25q128fv_delay(1); // NOTE: The datasheet states that the W25Q128FV Flash Memory Device will take a maximum of 20us to suspend an erase (i.e., tSUS).
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status start_w25q128fv_fast_read(uint32_t w25q128fv_flash_memory_addr)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable fast_read_instruction:</b> @ref uint8_t array type variable that is used to hold the data containing the Fast Read instruction that is to be sent to the W25Q128FV Device in order to request reading data from it. */
+    uint8_t fast_read_instruction[5];
+    fast_read_instruction[0] = W25Q128FV_FAST_READ_INSTRUCTION;
+    fast_read_instruction[1] = (w25q128fv_flash_memory_addr>>16);
+    fast_read_instruction[2] = (w25q128fv_flash_memory_addr>>8);
+    fast_read_instruction[3] = (w25q128fv_flash_memory_addr);
+    fast_read_instruction[4] = 0x00; // NOTE: This data is interpreted as don't care by the W25Q128FV Device, since these 8 bits will give place during the 8 Dummy Clocks of the Fast Read Instruction.
+
+    /* Request fast reading data from the W25Q128FV Device. */
+    set_cs_pin_low();
+    ret = HAL_SPI_Transmit(p_hspi, fast_read_instruction, 5, W25Q128FV_SPI_TIMEOUT);
+    ret = HAL_ret_handler(ret);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        set_cs_pin_high();
+        return ret;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status receive_w25q128fv_data(uint8_t *dst, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable transfer_size:</b> @ref uint16_t Type variable used to hold the size in bytes of the current HAL SPI transfer. */
+    uint16_t transfer_size;
+
+#if W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES > 0
+    if (size >= W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES)
+    {
+        return receive_w25q128fv_data_via_dma(dst, size);
+    }
+#endif
+    while (size > 0)
+    {
+        transfer_size = (size > W25Q128FV_MAX_SPI_TRANSFER_SIZE_IN_BYTES) ? W25Q128FV_MAX_SPI_TRANSFER_SIZE_IN_BYTES : size;
+        ret = HAL_SPI_Receive(p_hspi, dst, transfer_size, W25Q128FV_SPI_TIMEOUT);
+        ret = HAL_ret_handler(ret);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        dst += transfer_size;
+        size -= transfer_size;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+#if W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES > 0
+static W25Q128FV_Status receive_w25q128fv_data_via_dma(uint8_t *dst, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+    /** <b>Local variable head_size:</b> @ref uint32_t Type variable used to hold the number of bytes at the start of \p dst that are received via the bounce buffer. */
+    uint32_t head_size = w25q128fv_dma_get_head_size(dst, size);
+    /** <b>Local variable body_size:</b> @ref uint32_t Type variable used to hold the number of bytes after the head that are received directly into \p dst . */
+    uint32_t body_size = w25q128fv_dma_get_body_size(dst, size);
+    /** <b>Local variable tail_size:</b> @ref uint32_t Type variable used to hold the number of bytes at the end of \p dst that are received via the bounce buffer. */
+    uint32_t tail_size = size - head_size - body_size;
+    /** <b>Local variable bounce_buffer:</b> @ref uint8_t Type pointer used to point to the transient buffer into which the head and the tail are received, or \c NULL if there are none. */
+    uint8_t *bounce_buffer = NULL;
+
+    if ((head_size>0) || (tail_size>0))
+    {
+        bounce_buffer = take_transient_buffer();
+        if (bounce_buffer == NULL)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+
+    if (head_size > 0)
+    {
+        ret = receive_w25q128fv_line_aligned_data_via_dma(bounce_buffer, head_size);
+        if (ret == W25Q128FV_EC_OK)
+        {
+            memcpy(dst, bounce_buffer, head_size);
+        }
+    }
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = receive_w25q128fv_line_aligned_data_via_dma(&dst[head_size], body_size);
+    }
+    if ((ret==W25Q128FV_EC_OK) && (tail_size>0))
+    {
+        ret = receive_w25q128fv_line_aligned_data_via_dma(bounce_buffer, tail_size);
+        if (ret == W25Q128FV_EC_OK)
+        {
+            memcpy(&dst[head_size+body_size], bounce_buffer, tail_size);
+        }
+    }
+    give_back_transient_buffer(bounce_buffer);
+
+    return ret;
+}
+
+static W25Q128FV_Status receive_w25q128fv_line_aligned_data_via_dma(uint8_t *dst, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable transfer_size:</b> @ref uint16_t Type variable used to hold the size in bytes of the current DMA transfer. */
+    uint16_t transfer_size;
+
+    while (size > 0)
+    {
+        transfer_size = (size > W25Q128FV_MAX_SPI_TRANSFER_SIZE_IN_BYTES) ? W25Q128FV_MAX_SPI_TRANSFER_SIZE_IN_BYTES : size;
+
+        /* Discard the cache lines of the buffer so that none of them is written back over the data of the DMA. */
+        w25q128fv_dma_invalidate(dst, W25Q128FV_DMA_ROUND_UP_TO_LINE(transfer_size));
+        ret = HAL_SPI_Receive_DMA(p_hspi, dst, transfer_size);
+        ret = HAL_ret_handler(ret);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        ret = wait_for_spi_dma_transfer();
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+
+        /* Discard the cache lines that the CPU may have speculatively fetched while the DMA was writing the buffer. */
+        w25q128fv_dma_invalidate(dst, W25Q128FV_DMA_ROUND_UP_TO_LINE(transfer_size));
+        dst += transfer_size;
+        size -= transfer_size;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+#endif
+
+static W25Q128FV_Status wait_for_spi_dma_transfer(void)
+{
+    /** <b>Local variable start_tick:</b> @ref uint32_t Type variable used to hold the value of the @ref HAL_GetTick function at the moment in which this function started waiting. */
+    uint32_t start_tick = HAL_GetTick();
+
+    /* Block the caller until the DMA interrupt signals the end of the transfer, if an RTOS provides a way to do so. */
+    if ((p_os_hooks!=NULL) && (p_os_hooks->wait_for_dma!=NULL))
+    {
+        if (p_os_hooks->wait_for_dma(W25Q128FV_SPI_TIMEOUT) != W25Q128FV_EC_OK)
+        {
+            HAL_SPI_Abort(p_hspi);
+            return W25Q128FV_EC_NR;
+        }
+    }
+    while (HAL_SPI_GetState(p_hspi) != HAL_SPI_STATE_READY)
+    {
+        if ((HAL_GetTick()-start_tick) > W25Q128FV_SPI_TIMEOUT)
+        {
+            HAL_SPI_Abort(p_hspi);
+            return W25Q128FV_EC_NR;
+        }
+    }
+    if (HAL_SPI_GetError(p_hspi) != HAL_SPI_ERROR_NONE)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status send_w25q128fv_single_byte_instruction(uint8_t instruction)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = transfer_w25q128fv_short_instruction(&instruction, NULL, 1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status transfer_w25q128fv_short_instruction(uint8_t *instruction, uint8_t *response, uint16_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    set_cs_pin_low();
+#if W25Q128FV_INTERRUPT_SHORT_COMMANDS == 1
+    if (response == NULL)
+    {
+        ret = HAL_SPI_Transmit_IT(p_hspi, instruction, size);
+    }
+    else
+    {
+        ret = HAL_SPI_TransmitReceive_IT(p_hspi, instruction, response, size);
+    }
+    ret = HAL_ret_handler(ret);
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = wait_for_spi_dma_transfer();
+    }
+#else
+    if (response == NULL)
+    {
+        ret = HAL_SPI_Transmit(p_hspi, instruction, size, W25Q128FV_SPI_TIMEOUT);
+    }
+    else
+    {
+        ret = HAL_SPI_TransmitReceive(p_hspi, instruction, response, size, W25Q128FV_SPI_TIMEOUT);
+    }
+    ret = HAL_ret_handler(ret);
+#endif
+    set_cs_pin_high();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static void set_cs_pin_low(void)
+{
+#if W25Q128FV_HARDWARE_NSS == 1
+    __HAL_SPI_ENABLE(p_hspi);
+#else
+    HAL_GPIO_WritePin(p_w25q128fv_peripherals->CS.GPIO_Port, p_w25q128fv_peripherals->CS.GPIO_Pin, GPIO_PIN_RESET);
+#endif
+}
+
+static void set_cs_pin_high(void)
+{
+#if W25Q128FV_HARDWARE_NSS == 1
+    __HAL_SPI_DISABLE(p_hspi);
+#else
+    HAL_GPIO_WritePin(p_w25q128fv_peripherals->CS.GPIO_Port, p_w25q128fv_peripherals->CS.GPIO_Pin, GPIO_PIN_SET);
+#endif
+}
+
+static W25Q128FV_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
+{
+    switch (HAL_status)
+    {
+        case HAL_BUSY:
+        case HAL_TIMEOUT:
+            return W25Q128FV_EC_NR;
+        case HAL_ERROR:
+            return W25Q128FV_EC_ERR;
+        default:
+            return HAL_status;
+    }
+}
+
+static W25Q128FV_Status write_flash_memory_via_buffer(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src, uint8_t *page_program_instruction)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable w25q128fv_flash_memory_addr_start:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address where it is desired to start writing data. */
+    uint32_t w25q128fv_flash_memory_addr_start = start_page * W25Q128FV_PAGE_SIZE_IN_BYTES + page_bytes_offset;
+    /** <b>Local variable w25q128fv_flash_memory_addr_end_plus_one:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address that is right after where it is expected for this function to write the last byte of the request data. */
+    uint32_t w25q128fv_flash_memory_addr_end_plus_one = w25q128fv_flash_memory_addr_start + size;
+
+    /* Suspend any Sector Erase that is in progress in the background so that the W25Q128FV Device accepts Page Program Instructions. */
+    ret = suspend_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /** <b>Local variable w25q128fv_flash_memory_page_start:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device Flash Memory Page where it is expected for that Device to start writing the desired data. */
+    uint32_t w25q128fv_flash_memory_page_start = start_page + page_bytes_offset/W25Q128FV_PAGE_SIZE_IN_BYTES;
+    page_program_instruction[0] = W25Q128FV_PAGE_PROGRAM_INSTRUCTION;
+    /** <b>Local Pointer page_program_instruction_data:</b> @ref uint8_t Pointer type variable that is used to point to the byte at which the \p page_program_instruction Param holds the actual data to be sent to the W25Q128FV Device in the next Page Program Instruction. */
+    uint8_t *page_program_instruction_data = (uint8_t *) &page_program_instruction[4];
+    /** <b>Local variable currently_written_bytes:</b> @ref uint32_t Type variable that will hold the value standing for the currently written bytes into the W25Q128FV Flash Memory Device. */
     uint32_t currently_written_bytes = 0;
     /** <b>Local variable current_page_program_instruction_size:</b> @ref uint16_t Type variable that holds the current size in bytes of the W25Q128FV Page Program Instruction that is currently being formulated. */
     uint16_t current_page_program_instruction_size = 4;
@@ -416,7 +1447,7 @@ W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_
         {
             return ret;
         }
-        HAL_Delay(3); // The W25Q128FV datasheet states that a maximum of 3ms of time is required for a W25Q128FV Device in order for it to finish writing data into one of its Flash Memory Pages.
+        w25q128fv_delay(3); // The W25Q128FV datasheet states that a maximum of 3ms of time is required for a W25Q128FV Device in order for it to finish writing data into one of its Flash Memory Pages.
 
         /* Send the Write Disable Instruction to the W25Q128FV Flash Memory Device. */
         ret = send_w25q128fv_write_disable_instruction();
@@ -429,66 +1460,26 @@ W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_
     return W25Q128FV_EC_OK;
 }
 
-static W25Q128FV_Status send_w25q128fv_write_enable_instruction(void)
+static uint8_t *take_transient_buffer(void)
 {
-    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
-    uint8_t ret;
-    /** <b>Local variable write_enable_instruction:</b> @ref uint8_t variable that is used to hold the data containing the Write Enable Instructions that is to be sent to the W25Q128FV Device in order to request to it to enable Page Program, Quad Page Program, Sector Erase, Block Erase, Chip Erase, Write Status Register and Erase/Program Security Registers instructions. */
-    uint8_t write_enable_instruction = W25Q128FV_WRITE_ENABLE_INSTRUCTION;
-
-    /* Send the Write Enable Instruction to the W25Q128FV Flash Memory Device. */
-    set_cs_pin_low();
-    ret = HAL_SPI_Transmit(p_hspi, &write_enable_instruction, 1, W25Q128FV_SPI_TIMEOUT);
-    set_cs_pin_high();
-    ret = HAL_ret_handler(ret);
-    if (ret != W25Q128FV_EC_OK)
-    {
-        return ret;
-    }
-
-    return W25Q128FV_EC_OK;
-}
-
-static W25Q128FV_Status send_w25q128fv_write_disable_instruction(void)
-{
-    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of either a HAL function or a @ref W25Q128FV_Status function type. */
-    uint8_t ret;
-    /** <b>Local variable write_disable_instruction:</b> @ref uint8_t variable that is used to hold the data containing the Write Disable Instructions that is to be sent to the W25Q128FV Device in order to disable Page Program, Quad Page Program, Sector Erase, Block Erase, Chip Erase, Write Status Register and Erase/Program Security Registers instructions. */
-    uint8_t write_disable_instruction = W25Q128FV_WRITE_DISABLE_INSTRUCTION;
+    /** <b>Local variable buffer:</b> @ref uint8_t Type pointer used to point to the buffer to be handed out. */
+    uint8_t *buffer = (uint8_t *) w25q128fv_mempool_alloc();
 
-    /* Send the Write Disable Instruction to the W25Q128FV Flash Memory Device. */
-    set_cs_pin_low();
-    ret = HAL_SPI_Transmit(p_hspi, &write_disable_instruction, 1, W25Q128FV_SPI_TIMEOUT);
-    set_cs_pin_high();
-    ret = HAL_ret_handler(ret);
-    if (ret != W25Q128FV_EC_OK)
+    if ((buffer==NULL) && (is_fallback_buffer_in_use==0))
     {
-        return ret;
+        is_fallback_buffer_in_use = 1;
+        buffer = fallback_buffer;
     }
 
-    return W25Q128FV_EC_OK;
+    return buffer;
 }
 
-static void set_cs_pin_low(void)
-{
-    HAL_GPIO_WritePin(p_w25q128fv_peripherals->CS.GPIO_Port, p_w25q128fv_peripherals->CS.GPIO_Pin, GPIO_PIN_RESET);
-}
-
-static void set_cs_pin_high(void)
+static void give_back_transient_buffer(uint8_t *buffer)
 {
-    HAL_GPIO_WritePin(p_w25q128fv_peripherals->CS.GPIO_Port, p_w25q128fv_peripherals->CS.GPIO_Pin, GPIO_PIN_SET);
-}
-
-static W25Q128FV_Status HAL_ret_handler(HAL_StatusTypeDef HAL_status)
-{
-    switch (HAL_status)
+    if (buffer == fallback_buffer)
     {
-        case HAL_BUSY:
-        case HAL_TIMEOUT:
-            return W25Q128FV_EC_NR;
-        case HAL_ERROR:
-            return W25Q128FV_EC_ERR;
-        default:
-            return HAL_status;
+        is_fallback_buffer_in_use = 0;
+        return;
     }
+    w25q128fv_mempool_free(buffer);
 }
@@ -0,0 +1,250 @@
+#include "w25q128fv_erase_pool.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define W25Q128FV_ERASE_POOL_SECTOR_STATE_DIRTY         (0)         /**< @brief State of a Sector whose contents are unknown or no longer needed, meaning that it must be erased before handing it out. */
+#define W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASING       (1)         /**< @brief State of the Sector that is currently being erased in the background. */
+#define W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASED        (2)         /**< @brief State of a Sector that is erased and waiting in the pool. */
+#define W25Q128FV_ERASE_POOL_SECTOR_STATE_ALLOCATED     (3)         /**< @brief State of a Sector that has been handed out to the application firmware. */
+#define W25Q128FV_ERASE_POOL_NO_SECTOR                  (0xFFFF)    /**< @brief Value used to indicate that no Sector of the managed region is designated. */
+
+static W25Q128FV_erase_pool_def_t pool;                                     /**< @brief Copy of the W25Q128FV Erase-Ahead Pool Definition parameters structure given at @ref init_w25q128fv_erase_pool_module . */
+static uint8_t sector_state[W25Q128FV_ERASE_POOL_MAX_SECTORS];              /**< @brief State of each managed Sector (e.g., @ref W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASED ). */
+static uint16_t erased_sectors_fifo[W25Q128FV_ERASE_POOL_MAX_SECTORS];      /**< @brief Circular FIFO with the indexes, relative to the managed region, of the Sectors that are waiting in the pool. */
+static uint16_t erased_sectors_fifo_head;                                   /**< @brief Position in @ref erased_sectors_fifo of the Sector that has been waiting in the pool for the longest time. */
+static uint16_t dirty_sectors_cursor;                                       /**< @brief Index, relative to the managed region, from which the next dirty Sector to be erased will be searched for, such that the erases are spread across the whole region. */
+static uint16_t erasing_sector;                                             /**< @brief Index, relative to the managed region, of the Sector that is currently being erased in the background. */
+static W25Q128FV_erase_pool_stats_t stats;                                  /**< @brief Statistics of the @ref w25q128fv_erase_pool . */
+
+/**@brief   Adds a Sector at the end of the @ref erased_sectors_fifo .
+ *
+ * @param sector_index  Index, relative to the managed region, of the erased Sector.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void push_erased_sector(uint16_t sector_index);
+
+/**@brief   Searches for the next dirty Sector, starting from @ref dirty_sectors_cursor .
+ *
+ * @return  The index, relative to the managed region, of the found Sector or @ref W25Q128FV_ERASE_POOL_NO_SECTOR if
+ *          there are no dirty Sectors.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t find_next_dirty_sector(void);
+
+W25Q128FV_Status init_w25q128fv_erase_pool_module(W25Q128FV_erase_pool_def_t *erase_pool_def)
+{
+    /* Validate the given W25Q128FV Erase-Ahead Pool Definition parameters. */
+    if ((erase_pool_def->total_sectors==0) || (erase_pool_def->total_sectors>W25Q128FV_ERASE_POOL_MAX_SECTORS)
+        || ((erase_pool_def->first_sector+erase_pool_def->total_sectors) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Erase-Ahead Pool Definition parameters. */
+    pool = *erase_pool_def;
+
+    /* Treat every managed Sector as a dirty one until the implementer tells otherwise. */
+    memset(sector_state, W25Q128FV_ERASE_POOL_SECTOR_STATE_DIRTY, sizeof(sector_state));
+    memset(&stats, 0, sizeof(stats));
+    stats.min_pool_depth = pool.target_depth;
+    erased_sectors_fifo_head = 0;
+    dirty_sectors_cursor = 0;
+    erasing_sector = W25Q128FV_ERASE_POOL_NO_SECTOR;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_erase_pool_mark_sector_as_allocated(uint32_t sector_number)
+{
+    /** <b>Local variable sector_index:</b> @ref uint32_t Type variable used to hold the index of the given Sector relative to the managed region. */
+    uint32_t sector_index = sector_number - pool.first_sector;
+
+    /* Validate that the given Sector is inside of the managed region and that it is not being erased. */
+    if ((sector_number<pool.first_sector) || (sector_index>=pool.total_sectors) || (sector_state[sector_index]==W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASING))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Take the Sector out of the pool if it was in it. */
+    if (sector_state[sector_index] == W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASED)
+    {
+        for (uint16_t i=0; i<stats.pool_depth; i++)
+        {
+            if (erased_sectors_fifo[(erased_sectors_fifo_head+i) % W25Q128FV_ERASE_POOL_MAX_SECTORS] == sector_index)
+            {
+                erased_sectors_fifo[(erased_sectors_fifo_head+i) % W25Q128FV_ERASE_POOL_MAX_SECTORS] = erased_sectors_fifo[erased_sectors_fifo_head];
+                erased_sectors_fifo_head = (erased_sectors_fifo_head+1) % W25Q128FV_ERASE_POOL_MAX_SECTORS;
+                stats.pool_depth--;
+                break;
+            }
+        }
+    }
+    sector_state[sector_index] = W25Q128FV_ERASE_POOL_SECTOR_STATE_ALLOCATED;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_erase_pool_mark_sector_as_erased(uint32_t sector_number)
+{
+    /** <b>Local variable sector_index:</b> @ref uint32_t Type variable used to hold the index of the given Sector relative to the managed region. */
+    uint32_t sector_index = sector_number - pool.first_sector;
+
+    /* Validate that the given Sector is a dirty one inside of the managed region. */
+    if ((sector_number<pool.first_sector) || (sector_index>=pool.total_sectors) || (sector_state[sector_index]!=W25Q128FV_ERASE_POOL_SECTOR_STATE_DIRTY))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    push_erased_sector(sector_index);
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_erase_pool_allocate_sector(uint32_t *sector_number)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable sector_index:</b> @ref uint16_t Type variable used to hold the index, relative to the managed region, of the Sector to be handed out. */
+    uint16_t sector_index;
+    /** <b>Local variable is_refill_erase:</b> @ref uint8_t Type variable used to hold whether the Sector Erase that is waited for was started by @ref w25q128fv_erase_pool_refill (i.e., 1) or not (i.e., 0). */
+    uint8_t is_refill_erase;
+
+    /* Stall for a Sector Erase only if the pool is exhausted. */
+    if (stats.pool_depth == 0)
+    {
+        /* Start erasing a dirty Sector in the background as a refill would, unless a refill already started one. */
+        is_refill_erase = (erasing_sector != W25Q128FV_ERASE_POOL_NO_SECTOR);
+        if (is_refill_erase == 0)
+        {
+            sector_index = find_next_dirty_sector();
+            if (sector_index == W25Q128FV_ERASE_POOL_NO_SECTOR)
+            {
+                return W25Q128FV_EC_ERR;
+            }
+            ret = w25q128fv_start_erase_sector(pool.first_sector + sector_index);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            sector_state[sector_index] = W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASING;
+            erasing_sector = sector_index;
+        }
+
+        /* Wait only for as long as the W25Q128FV Device takes to erase it, instead of for the worst case. */
+        ret = w25q128fv_wait_for_background_erase();
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        push_erased_sector(erasing_sector);
+        erasing_sector = W25Q128FV_ERASE_POOL_NO_SECTOR;
+        stats.background_erases += is_refill_erase;
+        stats.stalls++;
+    }
+
+    /* Hand out the Sector that has been waiting in the pool for the longest time. */
+    sector_index = erased_sectors_fifo[erased_sectors_fifo_head];
+    erased_sectors_fifo_head = (erased_sectors_fifo_head+1) % W25Q128FV_ERASE_POOL_MAX_SECTORS;
+    stats.pool_depth--;
+    sector_state[sector_index] = W25Q128FV_ERASE_POOL_SECTOR_STATE_ALLOCATED;
+    stats.allocations++;
+    if (stats.pool_depth < stats.min_pool_depth)
+    {
+        stats.min_pool_depth = stats.pool_depth;
+    }
+    *sector_number = pool.first_sector + sector_index;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_erase_pool_release_sector(uint32_t sector_number)
+{
+    /** <b>Local variable sector_index:</b> @ref uint32_t Type variable used to hold the index of the given Sector relative to the managed region. */
+    uint32_t sector_index = sector_number - pool.first_sector;
+
+    /* Validate that the given Sector is an allocated one inside of the managed region. */
+    if ((sector_number<pool.first_sector) || (sector_index>=pool.total_sectors) || (sector_state[sector_index]!=W25Q128FV_ERASE_POOL_SECTOR_STATE_ALLOCATED))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    sector_state[sector_index] = W25Q128FV_ERASE_POOL_SECTOR_STATE_DIRTY;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_erase_pool_refill(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable is_erase_in_progress:</b> @ref uint8_t Type variable used to hold whether the Sector Erase started by a previous call is still in progress (i.e., 1) or not (i.e., 0). */
+    uint8_t is_erase_in_progress;
+    /** <b>Local variable sector_index:</b> @ref uint16_t Type variable used to hold the index, relative to the managed region, of the next dirty Sector to be erased. */
+    uint16_t sector_index;
+
+    /* Add the Sector that a previous call started erasing into the pool once the W25Q128FV Device finishes erasing it. */
+    if (erasing_sector != W25Q128FV_ERASE_POOL_NO_SECTOR)
+    {
+        ret = w25q128fv_poll_background_erase(&is_erase_in_progress);
+        if ((ret!=W25Q128FV_EC_OK) || (is_erase_in_progress==1))
+        {
+            return ret;
+        }
+        push_erased_sector(erasing_sector);
+        erasing_sector = W25Q128FV_ERASE_POOL_NO_SECTOR;
+        stats.background_erases++;
+    }
+
+    /* Start erasing the next dirty Sector in the background if the pool is below its target depth. */
+    if (stats.pool_depth >= pool.target_depth)
+    {
+        return W25Q128FV_EC_OK;
+    }
+    sector_index = find_next_dirty_sector();
+    if (sector_index == W25Q128FV_ERASE_POOL_NO_SECTOR)
+    {
+        return W25Q128FV_EC_OK;
+    }
+    ret = w25q128fv_start_erase_sector(pool.first_sector + sector_index);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    sector_state[sector_index] = W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASING;
+    erasing_sector = sector_index;
+
+    return W25Q128FV_EC_OK;
+}
+
+void w25q128fv_erase_pool_get_stats(W25Q128FV_erase_pool_stats_t *erase_pool_stats)
+{
+    *erase_pool_stats = stats;
+}
+
+static void push_erased_sector(uint16_t sector_index)
+{
+    erased_sectors_fifo[(erased_sectors_fifo_head+stats.pool_depth) % W25Q128FV_ERASE_POOL_MAX_SECTORS] = sector_index;
+    sector_state[sector_index] = W25Q128FV_ERASE_POOL_SECTOR_STATE_ERASED;
+    stats.pool_depth++;
+}
+
+static uint16_t find_next_dirty_sector(void)
+{
+    /** <b>Local variable sector_index:</b> @ref uint16_t Type variable used to hold the index, relative to the managed region, of the Sector currently being checked. */
+    uint16_t sector_index;
+
+    for (uint16_t i=0; i<pool.total_sectors; i++)
+    {
+        sector_index = (dirty_sectors_cursor + i) % pool.total_sectors;
+        if (sector_state[sector_index] == W25Q128FV_ERASE_POOL_SECTOR_STATE_DIRTY)
+        {
+            dirty_sectors_cursor = (sector_index + 1) % pool.total_sectors;
+            return sector_index;
+        }
+    }
+
+    return W25Q128FV_ERASE_POOL_NO_SECTOR;
+}
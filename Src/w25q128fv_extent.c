@@ -0,0 +1,1214 @@
+#include "w25q128fv_extent.h"
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include "w25q128fv_mempool.h" // This custom Mortrack's library contains the fixed-block memory pool from which the transient buffers are taken.
+#include "w25q128fv_dma.h" // This custom Mortrack's library contains the cache policy of the buffers into which data is received via DMA.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define W25Q128FV_EXTENT_TABLE_MAGIC            (0x54584557)    /**< @brief Value that identifies the beginning of a copy of the allocation table (i.e., "WEXT" in little endian). */
+#define W25Q128FV_EXTENT_MAX_FREE_EXTENTS       (2*W25Q128FV_EXTENT_MAX_EXTENTS + 2)    /**< @brief Maximum number of free extents that may exist at the same time, which is one more than the maximum number of runs of allocated Sectors because there may be one free extent between each of them. @details Besides the extents of @ref table , the Sectors of up to @ref W25Q128FV_EXTENT_MAX_EXTENTS @ref pending_free_extents and of the destination of the extent being defragmented also stay allocated, so there may be up to twice the maximum number of extents plus one runs of allocated Sectors. */
+#define W25Q128FV_EXTENT_NO_NODE                (0xFFFF)        /**< @brief Value used to indicate that a link of a free extent node does not point to any node. */
+#define W25Q128FV_EXTENT_TREE_BY_LENGTH         (0)             /**< @brief Index of the AVL tree that orders the free extents by their length (and then by their starting Sector). */
+#define W25Q128FV_EXTENT_TREE_BY_START          (1)             /**< @brief Index of the AVL tree that orders the free extents by their starting Sector. */
+#define W25Q128FV_EXTENT_TREES                  (2)             /**< @brief Number of AVL trees that index the free extents. */
+#define W25Q128FV_EXTENT_DEFRAG_STATE_IDLE                  (0) /**< @brief State of the defragmentation when no extent is being relocated. */
+#define W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_DESTINATION   (1) /**< @brief State of the defragmentation when the Sectors where an extent will be relocated are being erased. */
+#define W25Q128FV_EXTENT_DEFRAG_STATE_COPYING               (2) /**< @brief State of the defragmentation when the pages of an extent are being copied into its new location. */
+#define W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_TABLE         (3) /**< @brief State of the defragmentation when the copy of the allocation table that will point to the new location of an extent is being erased. */
+#define W25Q128FV_EXTENT_DEFRAG_STATE_WRITING_TABLE         (4) /**< @brief State of the defragmentation when the allocation table that points to the new location of an extent is to be written. */
+
+/**@brief	Header of each copy of the allocation table, which is followed by its entries in the W25Q128FV Device.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;         //!< Must be @ref W25Q128FV_EXTENT_TABLE_MAGIC .
+    uint32_t crc32;         //!< CRC-32 of all the bytes that follow this field, up to the last entry of the allocation table.
+    uint32_t generation;    //!< Number that is incremented with each commit, such that the copy with the greatest one is the latest.
+    uint32_t total_extents; //!< Number of entries in the allocation table.
+} W25Q128FV_extent_table_header_t;
+
+/**@brief	Image of a copy of the allocation table as it is stored into the W25Q128FV Device.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    W25Q128FV_extent_table_header_t header;                     //!< Header of the allocation table.
+    W25Q128FV_extent_t extents[W25Q128FV_EXTENT_MAX_EXTENTS];   //!< Entries of the allocation table.
+} W25Q128FV_extent_table_t;
+
+/**@brief	Node of the AVL trees that index the free extents.
+ */
+typedef struct {
+    uint16_t first_sector;                      //!< Index, relative to the first data Sector, of the first Sector of the free extent.
+    uint16_t total_sectors;                     //!< Number of consecutive free Sectors of the free extent.
+    uint16_t left[W25Q128FV_EXTENT_TREES];      //!< Left child of this node in each AVL tree.
+    uint16_t right[W25Q128FV_EXTENT_TREES];     //!< Right child of this node in each AVL tree.
+    uint8_t height[W25Q128FV_EXTENT_TREES];     //!< Height of the subtree rooted at this node in each AVL tree.
+} W25Q128FV_extent_free_node_t;
+
+static W25Q128FV_extent_def_t region;                                               /**< @brief Copy of the W25Q128FV Extent Allocator Definition parameters structure given at @ref init_w25q128fv_extent_module . */
+static uint32_t data_sectors;                                                       /**< @brief Number of Sectors of the managed region that can be handed out as extents. */
+static W25Q128FV_extent_table_t table;                                              /**< @brief RAM copy of the allocation table, which is also used as the buffer to read and write it. */
+static uint8_t allocated_bitmap[(W25Q128FV_EXTENT_MAX_SECTORS + 7) / 8];            /**< @brief Bitmap where each set bit stands for an allocated data Sector. */
+static uint32_t free_sectors_count;                                                 /**< @brief Number of data Sectors that are not allocated. */
+static W25Q128FV_extent_free_node_t free_nodes[W25Q128FV_EXTENT_MAX_FREE_EXTENTS];  /**< @brief Pool of nodes of the AVL trees that index the free extents. */
+static uint16_t free_nodes_pool_head;                                               /**< @brief First unused node of @ref free_nodes , whose unused nodes are chained through their left link of the tree by length. */
+static uint16_t tree_root[W25Q128FV_EXTENT_TREES];                                  /**< @brief Root node of each AVL tree that indexes the free extents. */
+static uint8_t committed_copy;                                                      /**< @brief Copy of the allocation table (i.e., 0 for A and 1 for B) that holds the latest committed one. */
+static uint8_t committed_extents[W25Q128FV_EXTENT_MAX_EXTENTS];                     /**< @brief Flags that indicate, for each entry of @ref table , whether it is also in the latest committed allocation table (i.e., 1) or whether it was allocated after it (i.e., 0). */
+static W25Q128FV_extent_t pending_free_extents[W25Q128FV_EXTENT_MAX_EXTENTS];       /**< @brief Committed extents that were freed after the latest commit, whose Sectors are kept allocated until the next commit since the allocation table in the W25Q128FV Device still points to them. */
+static uint32_t total_pending_free_extents;                                         /**< @brief Number of extents in @ref pending_free_extents . */
+static uint8_t has_uncommitted_changes;                                             /**< @brief Flag that indicates whether extents were allocated or freed after the latest commit (i.e., 1) or not (i.e., 0). */
+static uint8_t defrag_state;                                                        /**< @brief Current state of the defragmentation (e.g., @ref W25Q128FV_EXTENT_DEFRAG_STATE_COPYING ). */
+static uint8_t is_defrag_erase_in_progress;                                         /**< @brief Flag that indicates whether a Sector Erase started by @ref w25q128fv_extent_defrag_run_slice may still be in progress (i.e., 1) or not (i.e., 0). */
+static uint8_t defrag_table_copy;                                                   /**< @brief Copy of the allocation table that is erased and then written by the defragmentation. */
+static uint32_t defrag_blob_id;                                                     /**< @brief ID of the blob whose extent is being relocated. */
+static uint16_t defrag_source_sector;                                               /**< @brief Index, relative to the first data Sector, of the first Sector where the relocated extent currently is. */
+static uint16_t defrag_destination_sector;                                          /**< @brief Index, relative to the first data Sector, of the first Sector where the relocated extent is being moved into. */
+static uint16_t defrag_total_sectors;                                               /**< @brief Number of Sectors of the relocated extent. */
+static uint32_t defrag_total_pages;                                                 /**< @brief Number of pages of the relocated extent that hold data of its blob and that must therefore be copied. */
+static uint32_t defrag_cursor;                                                      /**< @brief Next Sector to be erased or next page to be copied, relative to the beginning of the relocated extent. */
+static uint8_t defrag_fallback_page_buffer[W25Q128FV_PAGE_SIZE_IN_BYTES] W25Q128FV_DMA_BUFFER_ATTRIBUTES;  /**< @brief Buffer through which the defragmentation copies a page whenever the @ref w25q128fv_mempool is exhausted, so that the relocation of an extent never stalls on it. */
+
+/**@brief   Compares two free extent nodes according to the order of an AVL tree.
+ *
+ * @param tree  Index of the AVL tree (e.g., @ref W25Q128FV_EXTENT_TREE_BY_LENGTH ).
+ * @param a     First node.
+ * @param b     Second node.
+ *
+ * @return  A negative value if \p a goes before \p b , a positive one if it goes after or 0 if both are the same node.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static int32_t compare_free_nodes(uint8_t tree, uint16_t a, uint16_t b);
+
+/**@brief   Inserts a node into the subtree of an AVL tree and rebalances it.
+ *
+ * @param tree  Index of the AVL tree.
+ * @param root  Root node of the subtree.
+ * @param node  Node to be inserted.
+ *
+ * @return  The new root node of the subtree.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t insert_free_node(uint8_t tree, uint16_t root, uint16_t node);
+
+/**@brief   Removes a node from the subtree of an AVL tree and rebalances it.
+ *
+ * @param tree  Index of the AVL tree.
+ * @param root  Root node of the subtree.
+ * @param node  Node to be removed, which must be in the subtree.
+ *
+ * @return  The new root node of the subtree.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t remove_free_node(uint8_t tree, uint16_t root, uint16_t node);
+
+/**@brief   Rebalances a node of an AVL tree whose subtrees are already balanced.
+ *
+ * @param tree  Index of the AVL tree.
+ * @param node  Node to be rebalanced.
+ *
+ * @return  The new root node of the subtree that was rooted at \p node .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t rebalance_free_node(uint8_t tree, uint16_t node);
+
+/**@brief   Adds a free extent into both AVL trees.
+ *
+ * @param first_sector      Index, relative to the first data Sector, of the first Sector of the free extent.
+ * @param total_sectors     Number of consecutive free Sectors of the free extent.
+ *
+ * @retval  W25Q128FV_EC_OK     if the free extent was added.
+ * @retval  W25Q128FV_EC_ERR    if @ref free_nodes has no node left for it, in which case the AVL trees are left as
+ *                              they were.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status add_free_extent(uint16_t first_sector, uint16_t total_sectors);
+
+/**@brief   Removes a free extent from both AVL trees and gives its node back to @ref free_nodes .
+ *
+ * @param node  Node of the free extent.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void remove_free_extent(uint16_t node);
+
+/**@brief   Allocates the first Sectors of a free extent and gives back whatever is left of it.
+ *
+ * @param node              Node of the free extent.
+ * @param total_sectors     Number of Sectors to be allocated, which must not exceed those of the free extent.
+ *
+ * @return  The index, relative to the first data Sector, of the first allocated Sector.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t carve_free_extent(uint16_t node, uint16_t total_sectors);
+
+/**@brief   Frees a run of allocated data Sectors and coalesces it with its free neighbours.
+ *
+ * @param first_sector      Index, relative to the first data Sector, of the first Sector of the run.
+ * @param total_sectors     Number of Sectors of the run.
+ *
+ * @retval  W25Q128FV_EC_OK     if the Sectors were freed.
+ * @retval  W25Q128FV_EC_ERR    if the resulting free extent could not be added (see @ref add_free_extent ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status release_sectors(uint16_t first_sector, uint16_t total_sectors);
+
+/**@brief   Frees the Sectors of all the @ref pending_free_extents and marks every entry of @ref table as committed,
+ *          which must only be done once the RAM copy of the allocation table has been successfully written.
+ *
+ * @retval  W25Q128FV_EC_OK     if all the Sectors were freed.
+ * @retval  W25Q128FV_EC_ERR    if the Sectors of any of the @ref pending_free_extents could not be freed (see
+ *                              @ref release_sectors ).
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status release_pending_free_extents(void);
+
+/**@brief   Sets or clears the bits of @ref allocated_bitmap that stand for a run of consecutive data Sectors.
+ *
+ * @param first_sector      Index, relative to the first data Sector, of the first Sector of the run.
+ * @param total_sectors     Number of Sectors of the run.
+ * @param is_allocated      1 to set the bits or 0 to clear them.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void set_allocated_bits(uint32_t first_sector, uint32_t total_sectors, uint8_t is_allocated);
+
+/**@brief   Reads a copy of the allocation table into @ref table and validates it.
+ *
+ * @param copy  Copy of the allocation table (i.e., 0 for A and 1 for B).
+ *
+ * @retval	W25Q128FV_EC_OK     if the copy was read and it is valid.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the copy is not valid.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status read_table_copy(uint8_t copy);
+
+/**@brief   Rebuilds @ref allocated_bitmap and the AVL trees of free extents from the entries of @ref table .
+ *
+ * @retval	W25Q128FV_EC_OK     if the entries were successfully loaded.
+ * @retval  W25Q128FV_EC_ERR    if an entry lies outside of the data Sectors or overlaps another one.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status rebuild_free_extents(void);
+
+/**@brief   Writes the RAM copy of the allocation table, with the next generation, into an already erased copy of it.
+ *
+ * @param copy  Copy of the allocation table (i.e., 0 for A and 1 for B), which must not be @ref committed_copy .
+ *
+ * @retval	W25Q128FV_EC_OK     if the allocation table was successfully written, in which case \p copy becomes the
+ *                              @ref committed_copy .
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_table_copy(uint8_t copy);
+
+/**@brief   Counts the 64KB Blocks of the W25Q128FV Device that lie within a run of data Sectors.
+ *
+ * @param first_sector      Index, relative to the first data Sector, of the first Sector of the run.
+ * @param end_sector        Index, relative to the first data Sector, of the Sector right after the run.
+ * @param only_free_blocks  1 to count only the 64KB Blocks whose Sectors are all free or 0 to count all of them.
+ *
+ * @return  The number of 64KB Blocks.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t count_blocks_64kb(uint32_t first_sector, uint32_t end_sector, uint8_t only_free_blocks);
+
+/**@brief   Chooses the next extent to be relocated by the defragmentation and reserves the Sectors where it will be
+ *          moved into.
+ *
+ * @details If fully free 64KB Blocks can still be gained, then the free extents are visited from the lowest to the
+ *          highest address and, for the first one that can hold any extent located after it, the highest located of
+ *          those extents is chosen, which gradually packs the allocated extents towards the beginning of the managed
+ *          region and the free Sectors towards its end.
+ *
+ * @return  1 if an extent was chosen or 0 if the free space is already compacted.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t select_defrag_move(void);
+
+/**@brief   Gets the index in the RAM copy of the allocation table of the extent being relocated.
+ *
+ * @return  The index of that extent or @ref W25Q128FV_EXTENT_MAX_EXTENTS if its blob was freed or relocated by other
+ *          means since the relocation started.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t find_defrag_extent(void);
+
+W25Q128FV_Status init_w25q128fv_extent_module(W25Q128FV_extent_def_t *extent_def)
+{
+    /* Validate the given W25Q128FV Extent Allocator Definition parameters. */
+    if ((extent_def->total_sectors<=W25Q128FV_EXTENT_TABLE_SECTORS) || (extent_def->total_sectors>W25Q128FV_EXTENT_MAX_SECTORS)
+        || ((extent_def->first_sector+extent_def->total_sectors) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Extent Allocator Definition parameters. */
+    region = *extent_def;
+    data_sectors = region.total_sectors - W25Q128FV_EXTENT_TABLE_SECTORS;
+
+    /* Start with an empty allocation table until it is either mounted or formatted. */
+    memset(&table, 0, sizeof(table));
+    committed_copy = 1;
+    rebuild_free_extents();
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_extent_format(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    /* Invalidate the B copy of the allocation table so that the A one, written by the commit, is the only valid one. */
+    ret = w25q128fv_erase_sector(region.first_sector + 1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    memset(&table, 0, sizeof(table));
+    committed_copy = 1;
+    rebuild_free_extents();
+
+    return w25q128fv_extent_commit();
+}
+
+W25Q128FV_Status w25q128fv_extent_mount(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable generation:</b> @ref uint32_t Type variable used to hold the generation of each copy of the allocation table, which is 0 for invalid copies. */
+    uint32_t generation[W25Q128FV_EXTENT_TABLE_SECTORS] = {0, 0};
+    /** <b>Local variable latest_copy:</b> @ref uint8_t Type variable used to hold the copy of the allocation table with the greatest generation. */
+    uint8_t latest_copy;
+
+    /* Wait for a Sector Erase that a defragmentation slice may have left on a copy of the allocation table, since a suspended Sector does not read back its data. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Validate both copies of the allocation table. */
+    for (uint8_t copy=0; copy<W25Q128FV_EXTENT_TABLE_SECTORS; copy++)
+    {
+        ret = read_table_copy(copy);
+        if (ret == W25Q128FV_EC_OK)
+        {
+            generation[copy] = table.header.generation;
+        }
+        else if (ret != W25Q128FV_EC_NA)
+        {
+            return ret;
+        }
+    }
+    if ((generation[0]==0) && (generation[1]==0))
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    /* Load the copy of the allocation table with the greatest generation, taking into account its wrap-around. */
+    if ((generation[1] == 0) || ((generation[0] != 0) && ((int32_t) (generation[0] - generation[1]) > 0)))
+    {
+        latest_copy = 0;
+    }
+    else
+    {
+        latest_copy = 1;
+    }
+    if (latest_copy == 0)
+    {
+        ret = read_table_copy(latest_copy);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+    committed_copy = latest_copy;
+
+    return rebuild_free_extents();
+}
+
+W25Q128FV_Status w25q128fv_extent_allocate(uint32_t blob_id, uint32_t size, W25Q128FV_extent_t *extent)
+{
+    /** <b>Local variable required_sectors:</b> @ref uint32_t Type variable used to hold the number of Sectors required by the blob. */
+    uint32_t required_sectors = (size + W25Q128FV_SECTOR_SIZE_IN_BYTES - 1) / W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    /** <b>Local variable best_fit:</b> @ref uint16_t Type variable used to hold the smallest free extent that is large enough for the blob. */
+    uint16_t best_fit = W25Q128FV_EXTENT_NO_NODE;
+    /** <b>Local variable first_sector:</b> @ref uint16_t Type variable used to hold the index, relative to the first data Sector, of the first Sector of the allocated extent. */
+    uint16_t first_sector;
+
+    /* Validate the allocation request. */
+    if ((size==0) || (table.header.total_extents>=W25Q128FV_EXTENT_MAX_EXTENTS) || (w25q128fv_extent_find(blob_id, extent)==W25Q128FV_EC_OK))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Search for the best-fit free extent in the AVL tree ordered by length. */
+    for (uint16_t node=tree_root[W25Q128FV_EXTENT_TREE_BY_LENGTH]; node!=W25Q128FV_EXTENT_NO_NODE;)
+    {
+        if (free_nodes[node].total_sectors >= required_sectors)
+        {
+            best_fit = node;
+            node = free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_LENGTH];
+        }
+        else
+        {
+            node = free_nodes[node].right[W25Q128FV_EXTENT_TREE_BY_LENGTH];
+        }
+    }
+    if (best_fit == W25Q128FV_EXTENT_NO_NODE)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Carve the extent from the beginning of the best-fit free extent. */
+    first_sector = carve_free_extent(best_fit, required_sectors);
+
+    /* Add the extent to the RAM copy of the allocation table. */
+    extent->blob_id = blob_id;
+    extent->first_sector = region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS + first_sector;
+    extent->total_sectors = required_sectors;
+    extent->size = size;
+    committed_extents[table.header.total_extents] = 0;
+    table.extents[table.header.total_extents++] = *extent;
+    has_uncommitted_changes = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_extent_free(uint32_t blob_id)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+
+    for (uint32_t i=0; i<table.header.total_extents; i++)
+    {
+        if (table.extents[i].blob_id == blob_id)
+        {
+            // NOTE: The committed allocation table still points to the Sectors of a committed extent, so reusing them before the next commit would corrupt its blob if the power is lost before that commit.
+            if (committed_extents[i])
+            {
+                pending_free_extents[total_pending_free_extents++] = table.extents[i];
+            }
+            else
+            {
+                ret = release_sectors(table.extents[i].first_sector - region.first_sector - W25Q128FV_EXTENT_TABLE_SECTORS, table.extents[i].total_sectors);
+            }
+            table.header.total_extents--;
+            table.extents[i] = table.extents[table.header.total_extents];
+            committed_extents[i] = committed_extents[table.header.total_extents];
+            has_uncommitted_changes = 1;
+            return ret;
+        }
+    }
+
+    return W25Q128FV_EC_ERR;
+}
+
+W25Q128FV_Status w25q128fv_extent_find(uint32_t blob_id, W25Q128FV_extent_t *extent)
+{
+    for (uint32_t i=0; i<table.header.total_extents; i++)
+    {
+        if (table.extents[i].blob_id == blob_id)
+        {
+            *extent = table.extents[i];
+            return W25Q128FV_EC_OK;
+        }
+    }
+
+    return W25Q128FV_EC_NA;
+}
+
+W25Q128FV_Status w25q128fv_extent_erase(W25Q128FV_extent_t *extent)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    /* Validate that the given extent lies inside of the data Sectors of the managed region. */
+    if ((extent->first_sector<(region.first_sector+W25Q128FV_EXTENT_TABLE_SECTORS))
+        || ((uint32_t) (extent->first_sector+extent->total_sectors) > (region.first_sector+region.total_sectors)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Erase each 64KB Block that is fully covered by the extent at once and the rest of its Sectors one by one. */
+    for (uint32_t sector=extent->first_sector; sector<(uint32_t) (extent->first_sector+extent->total_sectors);)
+    {
+        if (((sector%W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS) == 0) && ((sector+W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS) <= (uint32_t) (extent->first_sector+extent->total_sectors)))
+        {
+            ret = w25q128fv_erase_block_64kb(sector / W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS);
+            sector += W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS;
+        }
+        else
+        {
+            ret = w25q128fv_erase_sector(sector);
+            sector++;
+        }
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_extent_commit(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable extent_index:</b> @ref uint32_t Type variable used to hold the index in the RAM copy of the allocation table of the extent whose relocation is concluded by this commit, if any. */
+    uint32_t extent_index = W25Q128FV_EXTENT_MAX_EXTENTS;
+
+    /* Conclude, with this same commit, the relocation of an extent whose data has already been fully copied. */
+    if ((defrag_state==W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_TABLE) || (defrag_state==W25Q128FV_EXTENT_DEFRAG_STATE_WRITING_TABLE))
+    {
+        extent_index = find_defrag_extent();
+        if (extent_index != W25Q128FV_EXTENT_MAX_EXTENTS)
+        {
+            table.extents[extent_index].first_sector = region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS + defrag_destination_sector;
+        }
+    }
+
+    /* Overwrite the copy that does not hold the latest committed allocation table. */
+    ret = w25q128fv_erase_sector(region.first_sector + (committed_copy^1));
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = write_table_copy(committed_copy ^ 1);
+    }
+    if (extent_index != W25Q128FV_EXTENT_MAX_EXTENTS)
+    {
+        if (ret != W25Q128FV_EC_OK)
+        {
+            table.extents[extent_index].first_sector = region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS + defrag_source_sector;
+            return ret;
+        }
+        defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_IDLE;
+        is_defrag_erase_in_progress = 0; // NOTE: The Sector Erase of the allocation table started by the defragmentation, if any, was already waited for by this commit.
+        ret = release_sectors(defrag_source_sector, defrag_total_sectors);
+    }
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = release_pending_free_extents();
+    }
+
+    return ret;
+}
+
+void w25q128fv_extent_get_free_space(uint32_t *free_sectors, uint32_t *largest_free_extent)
+{
+    /** <b>Local variable node:</b> @ref uint16_t Type variable used to walk down to the largest free extent in the AVL tree ordered by length. */
+    uint16_t node = tree_root[W25Q128FV_EXTENT_TREE_BY_LENGTH];
+
+    *free_sectors = free_sectors_count;
+    *largest_free_extent = 0;
+    while (node != W25Q128FV_EXTENT_NO_NODE)
+    {
+        *largest_free_extent = free_nodes[node].total_sectors;
+        node = free_nodes[node].right[W25Q128FV_EXTENT_TREE_BY_LENGTH];
+    }
+}
+
+uint32_t w25q128fv_extent_get_free_blocks_64kb(void)
+{
+    return count_blocks_64kb(0, data_sectors, 1);
+}
+
+W25Q128FV_Status w25q128fv_extent_defrag_run_slice(uint32_t bus_time_budget_in_ms, uint8_t *is_compacted)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+    /** <b>Local variable slice_start_tick:</b> @ref uint32_t Type variable used to hold the value of the @ref HAL_GetTick function when this slice started. */
+    uint32_t slice_start_tick = HAL_GetTick();
+    /** <b>Local variable units_of_work_done:</b> @ref uint32_t Type variable used to hold the number of page copies, Sector Erase starts or allocation table writes made during this slice. */
+    uint32_t units_of_work_done = 0;
+    /** <b>Local variable is_erase_in_progress:</b> @ref uint8_t Type variable used to hold whether the Sector Erase started by a previous slice is still in progress (i.e., 1) or not (i.e., 0). */
+    uint8_t is_erase_in_progress;
+    /** <b>Local variable is_erase_started:</b> @ref uint8_t Type variable used to hold whether this slice started a Sector Erase (i.e., 1) or found another one still in progress (i.e., 0). */
+    uint8_t is_erase_started;
+    /** <b>Local variable extent_index:</b> @ref uint32_t Type variable used to hold the index in the RAM copy of the allocation table of the extent being relocated. */
+    uint32_t extent_index;
+    /** <b>Local variable page:</b> @ref uint32_t Type variable used to hold the page, relative to the first data Sector, of the page being copied. */
+    uint32_t page;
+    /** <b>Local variable defrag_page_buffer:</b> @ref uint8_t Type pointer used to point to the block of the @ref w25q128fv_mempool , or to the @ref defrag_fallback_page_buffer , through which the page being copied passes. */
+    uint8_t *defrag_page_buffer;
+
+    *is_compacted = 0;
+    while (1)
+    {
+        /* Conclude the Sector Erase that a previous slice started, if any. */
+        if (is_defrag_erase_in_progress)
+        {
+            ret = w25q128fv_poll_background_erase(&is_erase_in_progress);
+            if ((ret!=W25Q128FV_EC_OK) || (is_erase_in_progress==1))
+            {
+                break;
+            }
+            is_defrag_erase_in_progress = 0;
+            if (defrag_state == W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_DESTINATION)
+            {
+                defrag_cursor++;
+            }
+            else
+            {
+                defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_WRITING_TABLE;
+            }
+        }
+
+        /* Choose the next extent to be relocated if there is none or abandon the current one if its blob was freed. */
+        if (defrag_state == W25Q128FV_EXTENT_DEFRAG_STATE_IDLE)
+        {
+            if (select_defrag_move() == 0)
+            {
+                *is_compacted = 1;
+                break;
+            }
+        }
+        extent_index = find_defrag_extent();
+        if (extent_index == W25Q128FV_EXTENT_MAX_EXTENTS)
+        {
+            defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_IDLE;
+            ret = release_sectors(defrag_destination_sector, defrag_total_sectors);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+            continue;
+        }
+
+        /* Leave the new location of the extent for the next commit if writing the allocation table now would also persist the allocations and frees that the implementer has not committed yet. */
+        if (((defrag_state==W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_TABLE) || (defrag_state==W25Q128FV_EXTENT_DEFRAG_STATE_WRITING_TABLE)) && has_uncommitted_changes)
+        {
+            break;
+        }
+
+        /* Stop if another unit of work would not fit into the bus-time budget of this slice. */
+        if ((units_of_work_done>0) && (((HAL_GetTick()-slice_start_tick)+W25Q128FV_EXTENT_DEFRAG_PAGE_COPY_MAX_TIME_IN_MS) > bus_time_budget_in_ms))
+        {
+            break;
+        }
+
+        if (defrag_state == W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_DESTINATION)
+        {
+            if (defrag_cursor == defrag_total_sectors)
+            {
+                defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_COPYING;
+                defrag_cursor = 0;
+                continue;
+            }
+            ret = w25q128fv_try_start_erase_sector(region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS + defrag_destination_sector + defrag_cursor, &is_erase_started);
+            is_defrag_erase_in_progress = is_erase_started;
+            break;
+        }
+        else if (defrag_state == W25Q128FV_EXTENT_DEFRAG_STATE_COPYING)
+        {
+            if (defrag_cursor == defrag_total_pages)
+            {
+                defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_TABLE;
+                continue;
+            }
+            page = (region.first_sector+W25Q128FV_EXTENT_TABLE_SECTORS) * W25Q128FV_SECTOR_SIZE_IN_PAGES + defrag_cursor;
+            defrag_page_buffer = (uint8_t *) w25q128fv_mempool_alloc();
+            if (defrag_page_buffer == NULL)
+            {
+                defrag_page_buffer = defrag_fallback_page_buffer;
+            }
+            ret = w25q128fv_fast_read_flash_memory(page + defrag_source_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, defrag_page_buffer);
+            if (ret == W25Q128FV_EC_OK)
+            {
+                ret = w25q128fv_write_flash_memory(page + defrag_destination_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, defrag_page_buffer);
+            }
+            if (defrag_page_buffer != defrag_fallback_page_buffer)
+            {
+                w25q128fv_mempool_free(defrag_page_buffer);
+            }
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+            defrag_cursor++;
+        }
+        else if (defrag_state == W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_TABLE)
+        {
+            defrag_table_copy = committed_copy ^ 1;
+            ret = w25q128fv_try_start_erase_sector(region.first_sector + defrag_table_copy, &is_erase_started);
+            is_defrag_erase_in_progress = is_erase_started;
+            break;
+        }
+        else
+        {
+            /* Commit the new location of the extent and only then free its old location. */
+            table.extents[extent_index].first_sector = region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS + defrag_destination_sector;
+            ret = write_table_copy(defrag_table_copy);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                table.extents[extent_index].first_sector = region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS + defrag_source_sector;
+                defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_TABLE;
+                break;
+            }
+            defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_IDLE;
+            ret = release_sectors(defrag_source_sector, defrag_total_sectors);
+            if (ret == W25Q128FV_EC_OK)
+            {
+                ret = release_pending_free_extents();
+            }
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+        }
+        units_of_work_done++;
+    }
+
+    return ret;
+}
+
+static int32_t compare_free_nodes(uint8_t tree, uint16_t a, uint16_t b)
+{
+    if ((tree==W25Q128FV_EXTENT_TREE_BY_LENGTH) && (free_nodes[a].total_sectors!=free_nodes[b].total_sectors))
+    {
+        return (int32_t) free_nodes[a].total_sectors - free_nodes[b].total_sectors;
+    }
+
+    return (int32_t) free_nodes[a].first_sector - free_nodes[b].first_sector;
+}
+
+/**@brief   Gets the height of the subtree rooted at a node of an AVL tree, which is 0 for @ref W25Q128FV_EXTENT_NO_NODE .
+ *
+ * @param tree  Index of the AVL tree.
+ * @param node  Root node of the subtree.
+ *
+ * @return  The height of the subtree.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static inline uint8_t get_height(uint8_t tree, uint16_t node)
+{
+    return (node == W25Q128FV_EXTENT_NO_NODE) ? 0 : free_nodes[node].height[tree];
+}
+
+/**@brief   Recalculates the height of a node of an AVL tree from the heights of its children.
+ *
+ * @param tree  Index of the AVL tree.
+ * @param node  Node whose height is to be recalculated.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static inline void update_height(uint8_t tree, uint16_t node)
+{
+    /** <b>Local variable left_height:</b> @ref uint8_t Type variable used to hold the height of the left subtree. */
+    uint8_t left_height = get_height(tree, free_nodes[node].left[tree]);
+    /** <b>Local variable right_height:</b> @ref uint8_t Type variable used to hold the height of the right subtree. */
+    uint8_t right_height = get_height(tree, free_nodes[node].right[tree]);
+
+    free_nodes[node].height[tree] = ((left_height>right_height) ? left_height : right_height) + 1;
+}
+
+/**@brief   Rotates a subtree of an AVL tree to the right or to the left.
+ *
+ * @param tree      Index of the AVL tree.
+ * @param node      Root node of the subtree.
+ * @param to_right  1 to rotate to the right or 0 to rotate to the left.
+ *
+ * @return  The new root node of the subtree.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t rotate_free_node(uint8_t tree, uint16_t node, uint8_t to_right)
+{
+    /** <b>Local variable pivot:</b> @ref uint16_t Type variable used to hold the child of \p node that becomes the new root of the subtree. */
+    uint16_t pivot;
+
+    if (to_right)
+    {
+        pivot = free_nodes[node].left[tree];
+        free_nodes[node].left[tree] = free_nodes[pivot].right[tree];
+        free_nodes[pivot].right[tree] = node;
+    }
+    else
+    {
+        pivot = free_nodes[node].right[tree];
+        free_nodes[node].right[tree] = free_nodes[pivot].left[tree];
+        free_nodes[pivot].left[tree] = node;
+    }
+    update_height(tree, node);
+    update_height(tree, pivot);
+
+    return pivot;
+}
+
+static uint16_t rebalance_free_node(uint8_t tree, uint16_t node)
+{
+    /** <b>Local variable balance:</b> @ref int16_t Type variable used to hold the height of the left subtree minus the height of the right subtree. */
+    int16_t balance;
+    /** <b>Local variable child:</b> @ref uint16_t Type variable used to hold the child of \p node in the taller side. */
+    uint16_t child;
+
+    update_height(tree, node);
+    balance = (int16_t) get_height(tree, free_nodes[node].left[tree]) - get_height(tree, free_nodes[node].right[tree]);
+    if (balance > 1)
+    {
+        child = free_nodes[node].left[tree];
+        if (get_height(tree, free_nodes[child].left[tree]) < get_height(tree, free_nodes[child].right[tree]))
+        {
+            free_nodes[node].left[tree] = rotate_free_node(tree, child, 0);
+        }
+        return rotate_free_node(tree, node, 1);
+    }
+    if (balance < -1)
+    {
+        child = free_nodes[node].right[tree];
+        if (get_height(tree, free_nodes[child].right[tree]) < get_height(tree, free_nodes[child].left[tree]))
+        {
+            free_nodes[node].right[tree] = rotate_free_node(tree, child, 1);
+        }
+        return rotate_free_node(tree, node, 0);
+    }
+
+    return node;
+}
+
+static uint16_t insert_free_node(uint8_t tree, uint16_t root, uint16_t node)
+{
+    if (root == W25Q128FV_EXTENT_NO_NODE)
+    {
+        free_nodes[node].left[tree] = W25Q128FV_EXTENT_NO_NODE;
+        free_nodes[node].right[tree] = W25Q128FV_EXTENT_NO_NODE;
+        free_nodes[node].height[tree] = 1;
+        return node;
+    }
+    if (compare_free_nodes(tree, node, root) < 0)
+    {
+        free_nodes[root].left[tree] = insert_free_node(tree, free_nodes[root].left[tree], node);
+    }
+    else
+    {
+        free_nodes[root].right[tree] = insert_free_node(tree, free_nodes[root].right[tree], node);
+    }
+
+    return rebalance_free_node(tree, root);
+}
+
+static uint16_t remove_free_node(uint8_t tree, uint16_t root, uint16_t node)
+{
+    /** <b>Local variable comparison:</b> @ref int32_t Type variable used to hold the order of \p node with respect to \p root . */
+    int32_t comparison = compare_free_nodes(tree, node, root);
+    /** <b>Local variable successor:</b> @ref uint16_t Type variable used to hold the node that replaces \p root whenever it is the one being removed and it has two children. */
+    uint16_t successor;
+
+    if (comparison < 0)
+    {
+        free_nodes[root].left[tree] = remove_free_node(tree, free_nodes[root].left[tree], node);
+    }
+    else if (comparison > 0)
+    {
+        free_nodes[root].right[tree] = remove_free_node(tree, free_nodes[root].right[tree], node);
+    }
+    else
+    {
+        if (free_nodes[root].left[tree] == W25Q128FV_EXTENT_NO_NODE)
+        {
+            return free_nodes[root].right[tree];
+        }
+        if (free_nodes[root].right[tree] == W25Q128FV_EXTENT_NO_NODE)
+        {
+            return free_nodes[root].left[tree];
+        }
+
+        /* Replace the removed node with the leftmost node of its right subtree. */
+        successor = free_nodes[root].right[tree];
+        while (free_nodes[successor].left[tree] != W25Q128FV_EXTENT_NO_NODE)
+        {
+            successor = free_nodes[successor].left[tree];
+        }
+        free_nodes[successor].right[tree] = remove_free_node(tree, free_nodes[root].right[tree], successor);
+        free_nodes[successor].left[tree] = free_nodes[root].left[tree];
+        root = successor;
+    }
+
+    return rebalance_free_node(tree, root);
+}
+
+static W25Q128FV_Status add_free_extent(uint16_t first_sector, uint16_t total_sectors)
+{
+    /** <b>Local variable node:</b> @ref uint16_t Type variable used to hold the node taken from @ref free_nodes for the free extent. */
+    uint16_t node = free_nodes_pool_head;
+
+    if (node == W25Q128FV_EXTENT_NO_NODE)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    free_nodes_pool_head = free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_LENGTH];
+    free_nodes[node].first_sector = first_sector;
+    free_nodes[node].total_sectors = total_sectors;
+    for (uint8_t tree=0; tree<W25Q128FV_EXTENT_TREES; tree++)
+    {
+        tree_root[tree] = insert_free_node(tree, tree_root[tree], node);
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static void remove_free_extent(uint16_t node)
+{
+    for (uint8_t tree=0; tree<W25Q128FV_EXTENT_TREES; tree++)
+    {
+        tree_root[tree] = remove_free_node(tree, tree_root[tree], node);
+    }
+    free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_LENGTH] = free_nodes_pool_head;
+    free_nodes_pool_head = node;
+}
+
+static uint16_t carve_free_extent(uint16_t node, uint16_t total_sectors)
+{
+    /** <b>Local variable first_sector:</b> @ref uint16_t Type variable used to hold the index, relative to the first data Sector, of the first Sector of the free extent. */
+    uint16_t first_sector = free_nodes[node].first_sector;
+    /** <b>Local variable remaining_sectors:</b> @ref uint16_t Type variable used to hold the number of Sectors of the free extent that are left after the allocation. */
+    uint16_t remaining_sectors = free_nodes[node].total_sectors - total_sectors;
+
+    remove_free_extent(node);
+    if (remaining_sectors != 0)
+    {
+        (void) add_free_extent(first_sector + total_sectors, remaining_sectors); // NOTE: This cannot fail because the node of the carved free extent was just given back to @ref free_nodes .
+    }
+    set_allocated_bits(first_sector, total_sectors, 1);
+    free_sectors_count -= total_sectors;
+
+    return first_sector;
+}
+
+static W25Q128FV_Status release_sectors(uint16_t first_sector, uint16_t total_sectors)
+{
+    /** <b>Local variable predecessor:</b> @ref uint16_t Type variable used to hold the free extent that starts right before the freed Sectors. */
+    uint16_t predecessor = W25Q128FV_EXTENT_NO_NODE;
+    /** <b>Local variable successor:</b> @ref uint16_t Type variable used to hold the free extent that starts right after the freed Sectors. */
+    uint16_t successor = W25Q128FV_EXTENT_NO_NODE;
+
+    set_allocated_bits(first_sector, total_sectors, 0);
+    free_sectors_count += total_sectors;
+
+    /* Search for the free neighbours of the freed Sectors in the AVL tree ordered by starting Sector. */
+    for (uint16_t node=tree_root[W25Q128FV_EXTENT_TREE_BY_START]; node!=W25Q128FV_EXTENT_NO_NODE;)
+    {
+        if (free_nodes[node].first_sector < first_sector)
+        {
+            predecessor = node;
+            node = free_nodes[node].right[W25Q128FV_EXTENT_TREE_BY_START];
+        }
+        else
+        {
+            successor = node;
+            node = free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_START];
+        }
+    }
+
+    /* Coalesce the freed Sectors with their free neighbours. */
+    if ((predecessor!=W25Q128FV_EXTENT_NO_NODE) && ((free_nodes[predecessor].first_sector+free_nodes[predecessor].total_sectors)==first_sector))
+    {
+        first_sector = free_nodes[predecessor].first_sector;
+        total_sectors += free_nodes[predecessor].total_sectors;
+        remove_free_extent(predecessor);
+    }
+    if ((successor!=W25Q128FV_EXTENT_NO_NODE) && ((first_sector+total_sectors)==free_nodes[successor].first_sector))
+    {
+        total_sectors += free_nodes[successor].total_sectors;
+        remove_free_extent(successor);
+    }
+
+    return add_free_extent(first_sector, total_sectors);
+}
+
+static W25Q128FV_Status release_pending_free_extents(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+
+    for (uint32_t i=0; i<total_pending_free_extents; i++)
+    {
+        if (release_sectors(pending_free_extents[i].first_sector - region.first_sector - W25Q128FV_EXTENT_TABLE_SECTORS, pending_free_extents[i].total_sectors) != W25Q128FV_EC_OK)
+        {
+            ret = W25Q128FV_EC_ERR;
+        }
+    }
+    total_pending_free_extents = 0;
+    memset(committed_extents, 1, sizeof(committed_extents));
+    has_uncommitted_changes = 0;
+
+    return ret;
+}
+
+static void set_allocated_bits(uint32_t first_sector, uint32_t total_sectors, uint8_t is_allocated)
+{
+    for (uint32_t sector=first_sector; sector<(first_sector+total_sectors); sector++)
+    {
+        if (is_allocated)
+        {
+            allocated_bitmap[sector/8] |= (1 << (sector%8));
+        }
+        else
+        {
+            allocated_bitmap[sector/8] &= ~(1 << (sector%8));
+        }
+    }
+}
+
+static W25Q128FV_Status read_table_copy(uint8_t copy)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable table_page:</b> @ref uint32_t Type variable used to hold the first Page of the given copy of the allocation table. */
+    uint32_t table_page = (region.first_sector+copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES;
+
+    /* Read the header first so that the entries are only read for copies that look valid. */
+    ret = w25q128fv_fast_read_flash_memory(table_page, 0, sizeof(W25Q128FV_extent_table_header_t), (uint8_t *) &table.header);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if ((table.header.magic!=W25Q128FV_EXTENT_TABLE_MAGIC) || (table.header.generation==0) || (table.header.total_extents>W25Q128FV_EXTENT_MAX_EXTENTS))
+    {
+        return W25Q128FV_EC_NA;
+    }
+    if (table.header.total_extents != 0)
+    {
+        ret = w25q128fv_fast_read_flash_memory(table_page, sizeof(W25Q128FV_extent_table_header_t), table.header.total_extents*sizeof(W25Q128FV_extent_t), (uint8_t *) table.extents);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    if (w25q128fv_crc32_update(0, ((uint8_t *) &table) + 2*sizeof(uint32_t), sizeof(W25Q128FV_extent_table_header_t) - 2*sizeof(uint32_t) + table.header.total_extents*sizeof(W25Q128FV_extent_t)) != table.header.crc32)
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status rebuild_free_extents(void)
+{
+    /** <b>Local variable first_sector:</b> @ref uint32_t Type variable used to hold the index, relative to the first data Sector, of the first Sector of each entry. */
+    uint32_t first_sector;
+    /** <b>Local variable run_start:</b> @ref uint32_t Type variable used to hold the first Sector of the run of free Sectors that is currently being measured. */
+    uint32_t run_start = 0;
+
+    /* Reset the bitmap and the AVL trees, chaining all the nodes into the pool of unused ones, which also drops any relocation that the defragmentation had in progress. */
+    memset(allocated_bitmap, 0, sizeof(allocated_bitmap));
+    defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_IDLE;
+    is_defrag_erase_in_progress = 0;
+    total_pending_free_extents = 0;
+    memset(committed_extents, 1, sizeof(committed_extents));
+    has_uncommitted_changes = 0;
+    free_sectors_count = data_sectors;
+    for (uint16_t node=0; node<W25Q128FV_EXTENT_MAX_FREE_EXTENTS; node++)
+    {
+        free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_LENGTH] = ((node+1)<W25Q128FV_EXTENT_MAX_FREE_EXTENTS) ? (node+1) : W25Q128FV_EXTENT_NO_NODE;
+    }
+    free_nodes_pool_head = 0;
+    tree_root[W25Q128FV_EXTENT_TREE_BY_LENGTH] = W25Q128FV_EXTENT_NO_NODE;
+    tree_root[W25Q128FV_EXTENT_TREE_BY_START] = W25Q128FV_EXTENT_NO_NODE;
+
+    /* Mark the Sectors of each entry as allocated, validating that the entries do not overlap. */
+    for (uint32_t i=0; i<table.header.total_extents; i++)
+    {
+        first_sector = table.extents[i].first_sector - region.first_sector - W25Q128FV_EXTENT_TABLE_SECTORS;
+        if ((table.extents[i].first_sector<(region.first_sector+W25Q128FV_EXTENT_TABLE_SECTORS)) || (table.extents[i].total_sectors==0)
+            || ((first_sector+table.extents[i].total_sectors) > data_sectors))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        for (uint32_t sector=first_sector; sector<(first_sector+table.extents[i].total_sectors); sector++)
+        {
+            if (allocated_bitmap[sector/8] & (1 << (sector%8)))
+            {
+                return W25Q128FV_EC_ERR;
+            }
+        }
+        set_allocated_bits(first_sector, table.extents[i].total_sectors, 1);
+        free_sectors_count -= table.extents[i].total_sectors;
+    }
+
+    /* Add each run of free Sectors of the bitmap as a free extent. */
+    for (uint32_t sector=0; sector<=data_sectors; sector++)
+    {
+        if ((sector==data_sectors) || (allocated_bitmap[sector/8] & (1 << (sector%8))))
+        {
+            if ((sector>run_start) && (add_free_extent(run_start, sector-run_start)!=W25Q128FV_EC_OK))
+            {
+                return W25Q128FV_EC_ERR;
+            }
+            run_start = sector + 1;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status write_table_copy(uint8_t copy)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable table_size:</b> @ref uint32_t Type variable used to hold the size in bytes of the allocation table to be written. */
+    uint32_t table_size = sizeof(W25Q128FV_extent_table_header_t) + table.header.total_extents*sizeof(W25Q128FV_extent_t);
+
+    /* Formulate the allocation table with the next generation, skipping 0 because it stands for invalid copies at mount. */
+    table.header.magic = W25Q128FV_EXTENT_TABLE_MAGIC;
+    table.header.generation++;
+    if (table.header.generation == 0)
+    {
+        table.header.generation++;
+    }
+    table.header.crc32 = w25q128fv_crc32_update(0, ((uint8_t *) &table) + 2*sizeof(uint32_t), table_size - 2*sizeof(uint32_t));
+
+    ret = w25q128fv_write_flash_memory((region.first_sector+copy) * W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, table_size, (uint8_t *) &table);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        table.header.generation--;
+        return ret;
+    }
+    committed_copy = copy;
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint32_t count_blocks_64kb(uint32_t first_sector, uint32_t end_sector, uint8_t only_free_blocks)
+{
+    /** <b>Local variable base_sector:</b> @ref uint32_t Type variable used to hold the Flash Memory Sector of the W25Q128FV Device of the first data Sector. */
+    uint32_t base_sector = region.first_sector + W25Q128FV_EXTENT_TABLE_SECTORS;
+    /** <b>Local variable total_blocks:</b> @ref uint32_t Type variable used to hold the number of counted 64KB Blocks. */
+    uint32_t total_blocks = 0;
+    /** <b>Local variable is_block_free:</b> @ref uint8_t Type variable used to hold whether all the Sectors of the current 64KB Block are free (i.e., 1) or not (i.e., 0). */
+    uint8_t is_block_free;
+
+    /* Start from the first Sector of the run that is aligned to a 64KB Block of the W25Q128FV Device. */
+    first_sector += (W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS - (base_sector+first_sector)%W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS) % W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS;
+    for (uint32_t sector=first_sector; (sector+W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS)<=end_sector; sector+=W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS)
+    {
+        is_block_free = 1;
+        for (uint32_t i=0; (only_free_blocks==1) && (i<W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS); i++)
+        {
+            if (allocated_bitmap[(sector+i)/8] & (1 << ((sector+i)%8)))
+            {
+                is_block_free = 0;
+                break;
+            }
+        }
+        total_blocks += is_block_free;
+    }
+
+    return total_blocks;
+}
+
+static uint8_t select_defrag_move(void)
+{
+    /** <b>Local variable hole:</b> @ref uint16_t Type variable used to hold the free extent into which an extent is searched to be moved. */
+    uint16_t hole = W25Q128FV_EXTENT_NO_NODE;
+    /** <b>Local variable best_extent:</b> @ref uint32_t Type variable used to hold the index in the allocation table of the highest located extent that fits into the \c hole . */
+    uint32_t best_extent;
+    /** <b>Local variable hole_start:</b> @ref uint16_t Type variable used to hold the first Sector of the free extent that was just visited. */
+    uint16_t hole_start;
+
+    /* Stop once all the free Sectors that could form whole 64KB Blocks already do so. */
+    if (count_blocks_64kb(0, data_sectors, 1) >= count_blocks_64kb(data_sectors - free_sectors_count, data_sectors, 0))
+    {
+        return 0;
+    }
+
+    /* Visit the free extents in order of address, starting from the lowest one. */
+    // NOTE: The free extents never hold the Sectors of a committed extent that was freed after the latest commit (see @ref pending_free_extents ), so erasing the chosen hole never destroys a blob that the committed allocation table still points to.
+    for (uint16_t node=tree_root[W25Q128FV_EXTENT_TREE_BY_START]; node!=W25Q128FV_EXTENT_NO_NODE; node=free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_START])
+    {
+        hole = node;
+    }
+    while (hole != W25Q128FV_EXTENT_NO_NODE)
+    {
+        best_extent = W25Q128FV_EXTENT_MAX_EXTENTS;
+        for (uint32_t i=0; i<table.header.total_extents; i++)
+        {
+            if ((table.extents[i].total_sectors<=free_nodes[hole].total_sectors)
+                && ((table.extents[i].first_sector-region.first_sector-W25Q128FV_EXTENT_TABLE_SECTORS)>free_nodes[hole].first_sector)
+                && ((best_extent==W25Q128FV_EXTENT_MAX_EXTENTS) || (table.extents[i].first_sector>table.extents[best_extent].first_sector)))
+            {
+                best_extent = i;
+            }
+        }
+        if (best_extent != W25Q128FV_EXTENT_MAX_EXTENTS)
+        {
+            defrag_blob_id = table.extents[best_extent].blob_id;
+            defrag_source_sector = table.extents[best_extent].first_sector - region.first_sector - W25Q128FV_EXTENT_TABLE_SECTORS;
+            defrag_total_sectors = table.extents[best_extent].total_sectors;
+            defrag_total_pages = (table.extents[best_extent].size + W25Q128FV_PAGE_SIZE_IN_BYTES - 1) / W25Q128FV_PAGE_SIZE_IN_BYTES;
+            defrag_destination_sector = carve_free_extent(hole, defrag_total_sectors);
+            defrag_cursor = 0;
+            defrag_state = W25Q128FV_EXTENT_DEFRAG_STATE_ERASING_DESTINATION;
+            return 1;
+        }
+
+        /* Move on to the free extent that follows the current one. */
+        hole_start = free_nodes[hole].first_sector;
+        hole = W25Q128FV_EXTENT_NO_NODE;
+        for (uint16_t node=tree_root[W25Q128FV_EXTENT_TREE_BY_START]; node!=W25Q128FV_EXTENT_NO_NODE;)
+        {
+            if (free_nodes[node].first_sector > hole_start)
+            {
+                hole = node;
+                node = free_nodes[node].left[W25Q128FV_EXTENT_TREE_BY_START];
+            }
+            else
+            {
+                node = free_nodes[node].right[W25Q128FV_EXTENT_TREE_BY_START];
+            }
+        }
+    }
+
+    return 0;
+}
+
+static uint32_t find_defrag_extent(void)
+{
+    for (uint32_t i=0; i<table.header.total_extents; i++)
+    {
+        if ((table.extents[i].blob_id==defrag_blob_id) && (table.extents[i].first_sector==(region.first_sector+W25Q128FV_EXTENT_TABLE_SECTORS+defrag_source_sector)))
+        {
+            return i;
+        }
+    }
+
+    return W25Q128FV_EXTENT_MAX_EXTENTS;
+}
+
+/** @} */
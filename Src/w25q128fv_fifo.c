@@ -0,0 +1,574 @@
+#include "w25q128fv_fifo.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define W25Q128FV_FIFO_SECTOR_MAGIC                 (0x46494657)    /**< @brief Value that identifies the header of a Sector of the @ref w25q128fv_fifo (i.e., "WFIF" in little endian). */
+#define W25Q128FV_FIFO_SECTOR_FLAGS_OFFSET          (8)             /**< @brief Offset in bytes of the flags byte inside the Sector header. */
+#define W25Q128FV_FIFO_SECTOR_FLAG_CONSUMED         (0x01)          /**< @brief Bit of the flags byte of a Sector header that is cleared once all the records of that Sector have been consumed. */
+#define W25Q128FV_FIFO_RECORD_FLAGS_OFFSET          (2)             /**< @brief Offset in bytes of the flags byte inside the record header. */
+#define W25Q128FV_FIFO_RECORD_FLAG_WRITTEN          (0x01)          /**< @brief Bit of the flags byte of a record header that is cleared once the whole record has been written. */
+#define W25Q128FV_FIFO_RECORD_FLAG_CONSUMED         (0x02)          /**< @brief Bit of the flags byte of a record header that is cleared once the record has been consumed. */
+#define W25Q128FV_FIFO_BLANK_LENGTH                 (0xFFFF)        /**< @brief Length of a record header that has not been written. */
+
+/**@brief	Header at the beginning of each Sector of the @ref w25q128fv_fifo .
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;         //!< Must be @ref W25Q128FV_FIFO_SECTOR_MAGIC .
+    uint32_t sequence;      //!< Number that is incremented each time that the writer moves into the next Sector.
+    uint8_t flags;          //!< Flags whose bits are only ever cleared (e.g., @ref W25Q128FV_FIFO_SECTOR_FLAG_CONSUMED ).
+    uint8_t reserved[3];    //!< Reserved bytes, which are left erased.
+} W25Q128FV_fifo_sector_header_t;
+
+/**@brief	Header that precedes each record of the @ref w25q128fv_fifo .
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t length;        //!< Size in bytes of the record data or @ref W25Q128FV_FIFO_BLANK_LENGTH if no record was written here.
+    uint8_t flags;          //!< Flags whose bits are only ever cleared (e.g., @ref W25Q128FV_FIFO_RECORD_FLAG_WRITTEN ).
+    uint8_t reserved;       //!< Reserved byte, which is left erased.
+} W25Q128FV_fifo_record_header_t;
+
+static W25Q128FV_fifo_def_t fifo;               /**< @brief Copy of the W25Q128FV Persistent FIFO Definition parameters structure given at @ref init_w25q128fv_fifo_module . */
+static uint32_t tail_sector;                    /**< @brief Index, relative to the managed region, of the Sector into which records are appended. */
+static uint32_t tail_sequence;                  /**< @brief Sequence number of the @ref tail_sector . */
+static uint32_t tail_offset;                    /**< @brief Offset in bytes, inside of the @ref tail_sector , where the next record will be appended. */
+static uint32_t head_sector;                    /**< @brief Index, relative to the managed region, of the Sector that holds the record at the head of the queue. */
+static uint32_t head_offset;                    /**< @brief Offset in bytes, inside of the @ref head_sector , from which the record at the head of the queue is searched for. */
+static uint8_t is_head_record_located;          /**< @brief Flag that indicates whether @ref head_offset already points to the record at the head of the queue (i.e., 1) or not (i.e., 0). */
+static uint16_t head_record_length;             /**< @brief Size in bytes of the record at the head of the queue whenever @ref is_head_record_located is 1. */
+
+/**@brief   Reads data from a Sector of the managed region.
+ *
+ * @param sector        Index, relative to the managed region, of the Sector.
+ * @param offset        Offset in bytes inside of the Sector.
+ * @param size          Size in bytes of the data.
+ * @param[out] dst      Pointer to the Memory Location Address where the data will be stored.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status read_sector_data(uint32_t sector, uint32_t offset, uint32_t size, uint8_t *dst);
+
+/**@brief   Writes data into a Sector of the managed region.
+ *
+ * @param sector        Index, relative to the managed region, of the Sector.
+ * @param offset        Offset in bytes inside of the Sector.
+ * @param size          Size in bytes of the data.
+ * @param[in] src       Pointer to the Memory Location Address where the data is located at.
+ *
+ * @retval	W25Q128FV_EC_OK     if the data was successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_sector_data(uint32_t sector, uint32_t offset, uint32_t size, uint8_t *src);
+
+/**@brief   Reads the header of a Sector of the managed region and tells whether it is a valid one.
+ *
+ * @param sector        Index, relative to the managed region, of the Sector.
+ * @param[out] header   Pointer to the Memory Location Address where the Sector header will be stored.
+ * @param[out] is_valid Pointer to the Memory Location Address where a 1 will be written if the Sector header is valid or
+ *                      a 0 if otherwise.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector header was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status read_sector_header(uint32_t sector, W25Q128FV_fifo_sector_header_t *header, uint8_t *is_valid);
+
+/**@brief   Reads the record header at a given offset of a Sector and tells whether a record ends the Sector there.
+ *
+ * @details A Sector ends at a given offset if there is no room for another record header, if the record header is
+ *          blank or if its length is not valid (e.g., because a power loss interrupted its writing).
+ *
+ * @param sector            Index, relative to the managed region, of the Sector.
+ * @param offset            Offset in bytes inside of the Sector.
+ * @param[out] header       Pointer to the Memory Location Address where the record header will be stored.
+ * @param[out] is_end       Pointer to the Memory Location Address where a 1 will be written if the Sector ends at
+ *                          \p offset or a 0 if otherwise.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record header was successfully read.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status read_record_header(uint32_t sector, uint32_t offset, W25Q128FV_fifo_record_header_t *header, uint8_t *is_end);
+
+/**@brief   Makes @ref head_offset point to the record at the head of the queue, moving the @ref head_sector forward
+ *          (and clearing the consumed flag of the Sectors left behind) whenever needed.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record at the head of the queue was located.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_NA     if the queue is empty.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status locate_head_record(void);
+
+/**@brief   Erases a Sector of the managed region and writes its Sector header.
+ *
+ * @param sector    Index, relative to the managed region, of the Sector.
+ * @param sequence  Sequence number of the Sector.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Sector was successfully started.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status start_sector(uint32_t sector, uint32_t sequence);
+
+W25Q128FV_Status init_w25q128fv_fifo_module(W25Q128FV_fifo_def_t *fifo_def)
+{
+    /* Validate the given W25Q128FV Persistent FIFO Definition parameters. */
+    if ((fifo_def->total_sectors<2) || ((fifo_def->first_sector+fifo_def->total_sectors) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Persistent FIFO Definition parameters. */
+    fifo = *fifo_def;
+    tail_sector = 0;
+    tail_sequence = 0;
+    tail_offset = W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    head_sector = 0;
+    head_offset = W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    is_head_record_located = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_fifo_format(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    /* Erase every Sector so that no Sector header of a previous queue can be mistaken as part of the new one. */
+    for (uint32_t sector=1; sector<fifo.total_sectors; sector++)
+    {
+        ret = w25q128fv_erase_sector(fifo.first_sector + sector);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    ret = start_sector(0, 0);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    tail_sector = 0;
+    tail_sequence = 0;
+    tail_offset = W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES;
+    head_sector = 0;
+    head_offset = W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES;
+    is_head_record_located = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_fifo_mount(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_fifo_sector_header_t Type variable used to hold the Sector header that was last read. */
+    W25Q128FV_fifo_sector_header_t header;
+    /** <b>Local variable is_valid:</b> @ref uint8_t Type variable used to hold whether the Sector header that was last read is valid (i.e., 1) or not (i.e., 0). */
+    uint8_t is_valid = 0;
+    /** <b>Local variable is_first_sector_valid:</b> @ref uint8_t Type variable used to hold whether the Sector header of the first Sector of the managed region is valid (i.e., 1) or not (i.e., 0). */
+    uint8_t is_first_sector_valid = 0;
+    /** <b>Local variable first_sector_sequence:</b> @ref uint32_t Type variable used to hold the sequence number of the first Sector of the managed region. */
+    uint32_t first_sector_sequence;
+    /** <b>Local variable low:</b> @ref uint32_t Type variable used to hold the lower bound of each binary search. */
+    uint32_t low;
+    /** <b>Local variable high:</b> @ref uint32_t Type variable used to hold the upper bound of each binary search. */
+    uint32_t high;
+    /** <b>Local variable middle:</b> @ref uint32_t Type variable used to hold the middle point of each binary search. */
+    uint32_t middle;
+    /** <b>Local variable oldest_sector:</b> @ref uint32_t Type variable used to hold the index, relative to the managed region, of the oldest Sector of the queue. */
+    uint32_t oldest_sector;
+    /** <b>Local variable record_header:</b> @ref W25Q128FV_fifo_record_header_t Type variable used to hold the record header that was last read. */
+    W25Q128FV_fifo_record_header_t record_header;
+    /** <b>Local variable is_end:</b> @ref uint8_t Type variable used to hold whether the Sector being walked ends at the current offset (i.e., 1) or not (i.e., 0). */
+    uint8_t is_end = 0;
+
+    /* Binary search the tail Sector, which is the last one whose sequence number follows from that of the first Sector, since the writer goes through the Sectors in order and only erases the Sector right after the tail. */
+    ret = read_sector_header(0, &header, &is_first_sector_valid);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    first_sector_sequence = header.sequence;
+    if (is_first_sector_valid)
+    {
+        low = 0;
+        high = fifo.total_sectors;
+        while ((high-low) > 1)
+        {
+            middle = (low+high) / 2;
+            ret = read_sector_header(middle, &header, &is_valid);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            if ((is_valid==1) && (header.sequence==(first_sector_sequence+middle)))
+            {
+                low = middle;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        tail_sector = low;
+        tail_sequence = first_sector_sequence + low;
+    }
+    else
+    {
+        /* NOTE: The first Sector can only be blank if the writer was wrapping around into it when power was lost. */
+        ret = read_sector_header(fifo.total_sectors-1, &header, &is_valid);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (is_valid == 0)
+        {
+            return W25Q128FV_EC_NA;
+        }
+        tail_sector = fifo.total_sectors - 1;
+        tail_sequence = header.sequence;
+    }
+
+    /* Find the oldest Sector, which follows the tail Sector unless that one was being erased when power was lost or unless the writer has not wrapped around yet. */
+    oldest_sector = is_first_sector_valid ? 0 : tail_sector;
+    for (uint32_t i=1; i<=2; i++)
+    {
+        ret = read_sector_header((tail_sector+i) % fifo.total_sectors, &header, &is_valid);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if ((is_valid==1) && ((tail_sequence-header.sequence)!=0) && ((tail_sequence-header.sequence)<fifo.total_sectors))
+        {
+            oldest_sector = (tail_sector+i) % fifo.total_sectors;
+            break;
+        }
+    }
+
+    /* Binary search the head Sector, which is the oldest one whose consumed flag has not been cleared. */
+    low = 0;
+    high = (tail_sector - oldest_sector + fifo.total_sectors) % fifo.total_sectors;
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        ret = read_sector_header((oldest_sector+middle) % fifo.total_sectors, &header, &is_valid);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if ((header.flags&W25Q128FV_FIFO_SECTOR_FLAG_CONSUMED) == 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    head_sector = (oldest_sector+low) % fifo.total_sectors;
+
+    /* Walk the records of the tail Sector up to where the next record is to be appended. */
+    tail_offset = W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES;
+    while (1)
+    {
+        ret = read_record_header(tail_sector, tail_offset, &record_header, &is_end);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (is_end)
+        {
+            if (record_header.length != W25Q128FV_FIFO_BLANK_LENGTH)
+            {
+                tail_offset = W25Q128FV_SECTOR_SIZE_IN_BYTES; // NOTE: A partially written record header closes the tail Sector.
+            }
+            break;
+        }
+        tail_offset += W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES + record_header.length;
+    }
+
+    /* Walk the records of the head Sector up to the first one that has not been consumed. */
+    head_offset = W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES;
+    is_head_record_located = 0;
+    ret = locate_head_record();
+    if ((ret!=W25Q128FV_EC_OK) && (ret!=W25Q128FV_EC_NA))
+    {
+        return ret;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_fifo_enqueue(uint8_t *src, uint16_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable next_sector:</b> @ref uint32_t Type variable used to hold the index, relative to the managed region, of the Sector that follows the tail Sector. */
+    uint32_t next_sector = (tail_sector+1) % fifo.total_sectors;
+    /** <b>Local variable record_offset:</b> @ref uint32_t Type variable used to hold the offset in bytes, inside of the tail Sector, where the record is appended. */
+    uint32_t record_offset;
+    /** <b>Local variable header:</b> @ref W25Q128FV_fifo_record_header_t Type variable used to hold the record header to be written. */
+    W25Q128FV_fifo_record_header_t header = {size, 0xFF, 0xFF};
+    /** <b>Local variable flags:</b> @ref uint8_t Type variable used to hold the flags byte of the record header with its written flag cleared. */
+    uint8_t flags = 0xFF & ~W25Q128FV_FIFO_RECORD_FLAG_WRITTEN;
+
+    /* Validate the size of the record. */
+    if ((size==0) || (size>W25Q128FV_FIFO_MAX_RECORD_SIZE_IN_BYTES))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Move into the next Sector if the record does not fit into the rest of the tail Sector, as long as the next Sector holds no records that are yet to be consumed. */
+    if ((tail_offset+W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES+size) > W25Q128FV_SECTOR_SIZE_IN_BYTES)
+    {
+        if (next_sector == head_sector)
+        {
+            ret = locate_head_record();
+            if ((ret!=W25Q128FV_EC_OK) && (ret!=W25Q128FV_EC_NA))
+            {
+                return ret;
+            }
+            if (next_sector == head_sector)
+            {
+                return W25Q128FV_EC_ERR;
+            }
+        }
+        ret = start_sector(next_sector, tail_sequence+1);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        tail_sector = next_sector;
+        tail_sequence++;
+        tail_offset = W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES;
+    }
+
+    /* Write the record header, then the record data and only then clear the written flag. */
+    record_offset = tail_offset;
+    tail_offset = W25Q128FV_SECTOR_SIZE_IN_BYTES; // NOTE: If anything fails from here on, the tail Sector is closed so that no record is ever appended after an incomplete one.
+    ret = write_sector_data(tail_sector, record_offset, W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES, (uint8_t *) &header);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = write_sector_data(tail_sector, record_offset+W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES, size, src);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = write_sector_data(tail_sector, record_offset+W25Q128FV_FIFO_RECORD_FLAGS_OFFSET, 1, &flags);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    tail_offset = record_offset + W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES + size;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_fifo_peek(uint8_t *dst, uint16_t max_size, uint16_t *size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = locate_head_record();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (head_record_length > max_size)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    *size = head_record_length;
+
+    return read_sector_data(head_sector, head_offset+W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES, head_record_length, dst);
+}
+
+W25Q128FV_Status w25q128fv_fifo_pop(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable flags:</b> @ref uint8_t Type variable used to hold the flags byte of the record header with its written and consumed flags cleared. */
+    uint8_t flags = 0xFF & ~(W25Q128FV_FIFO_RECORD_FLAG_WRITTEN|W25Q128FV_FIFO_RECORD_FLAG_CONSUMED);
+
+    ret = locate_head_record();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = write_sector_data(head_sector, head_offset+W25Q128FV_FIFO_RECORD_FLAGS_OFFSET, 1, &flags);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    head_offset += W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES + head_record_length;
+    is_head_record_located = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_fifo_dequeue(uint8_t *dst, uint16_t max_size, uint16_t *size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = w25q128fv_fifo_peek(dst, max_size, size);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return w25q128fv_fifo_pop();
+}
+
+static W25Q128FV_Status read_sector_data(uint32_t sector, uint32_t offset, uint32_t size, uint8_t *dst)
+{
+    return w25q128fv_fast_read_flash_memory((fifo.first_sector+sector)*W25Q128FV_SECTOR_SIZE_IN_PAGES + offset/W25Q128FV_PAGE_SIZE_IN_BYTES, offset%W25Q128FV_PAGE_SIZE_IN_BYTES, size, dst);
+}
+
+static W25Q128FV_Status write_sector_data(uint32_t sector, uint32_t offset, uint32_t size, uint8_t *src)
+{
+    return w25q128fv_write_flash_memory((fifo.first_sector+sector)*W25Q128FV_SECTOR_SIZE_IN_PAGES + offset/W25Q128FV_PAGE_SIZE_IN_BYTES, offset%W25Q128FV_PAGE_SIZE_IN_BYTES, size, src);
+}
+
+static W25Q128FV_Status read_sector_header(uint32_t sector, W25Q128FV_fifo_sector_header_t *header, uint8_t *is_valid)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = read_sector_data(sector, 0, sizeof(W25Q128FV_fifo_sector_header_t), (uint8_t *) header);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    *is_valid = (header->magic == W25Q128FV_FIFO_SECTOR_MAGIC);
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status read_record_header(uint32_t sector, uint32_t offset, W25Q128FV_fifo_record_header_t *header, uint8_t *is_end)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if ((offset+W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES) > W25Q128FV_SECTOR_SIZE_IN_BYTES)
+    {
+        header->length = W25Q128FV_FIFO_BLANK_LENGTH;
+        *is_end = 1;
+        return W25Q128FV_EC_OK;
+    }
+    ret = read_sector_data(sector, offset, sizeof(W25Q128FV_fifo_record_header_t), (uint8_t *) header);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    *is_end = ((header->length==0) || (header->length>W25Q128FV_FIFO_MAX_RECORD_SIZE_IN_BYTES)
+               || ((offset+W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES+header->length) > W25Q128FV_SECTOR_SIZE_IN_BYTES));
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status locate_head_record(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_fifo_record_header_t Type variable used to hold the record header at the @ref head_offset . */
+    W25Q128FV_fifo_record_header_t header;
+    /** <b>Local variable is_end:</b> @ref uint8_t Type variable used to hold whether the head Sector ends at the @ref head_offset (i.e., 1) or not (i.e., 0). */
+    uint8_t is_end = 0;
+    /** <b>Local variable flags:</b> @ref uint8_t Type variable used to hold the flags byte of a Sector header with its consumed flag cleared. */
+    uint8_t flags = 0xFF & ~W25Q128FV_FIFO_SECTOR_FLAG_CONSUMED;
+
+    while (is_head_record_located == 0)
+    {
+        /* Stop at the tail of the queue, which is either where the next record will be appended or the end of a closed tail Sector. */
+        if ((head_sector==tail_sector) && (head_offset>=tail_offset))
+        {
+            return W25Q128FV_EC_NA;
+        }
+        ret = read_record_header(head_sector, head_offset, &header, &is_end);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (is_end)
+        {
+            if (head_sector == tail_sector)
+            {
+                return W25Q128FV_EC_NA;
+            }
+
+            /* Leave behind a Sector whose records have all been consumed so that the writer may reclaim it. */
+            ret = write_sector_data(head_sector, W25Q128FV_FIFO_SECTOR_FLAGS_OFFSET, 1, &flags);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            head_sector = (head_sector+1) % fifo.total_sectors;
+            head_offset = W25Q128FV_FIFO_SECTOR_HEADER_SIZE_IN_BYTES;
+        }
+        else if (((header.flags&W25Q128FV_FIFO_RECORD_FLAG_WRITTEN)!=0) || ((header.flags&W25Q128FV_FIFO_RECORD_FLAG_CONSUMED)==0))
+        {
+            /* Skip the records whose writing was interrupted and the ones that have already been consumed. */
+            head_offset += W25Q128FV_FIFO_RECORD_HEADER_SIZE_IN_BYTES + header.length;
+        }
+        else
+        {
+            head_record_length = header.length;
+            is_head_record_located = 1;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status start_sector(uint32_t sector, uint32_t sequence)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_fifo_sector_header_t Type variable used to hold the Sector header to be written. */
+    W25Q128FV_fifo_sector_header_t header;
+
+    ret = w25q128fv_erase_sector(fifo.first_sector + sector);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    memset(&header, 0xFF, sizeof(header));
+    header.magic = W25Q128FV_FIFO_SECTOR_MAGIC;
+    header.sequence = sequence;
+
+    /* Write the magic only after the rest of the Sector header so that a power loss never leaves a valid looking Sector header with an incomplete sequence number. */
+    ret = write_sector_data(sector, sizeof(header.magic), sizeof(header)-sizeof(header.magic), ((uint8_t *) &header) + sizeof(header.magic));
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return write_sector_data(sector, 0, sizeof(header.magic), (uint8_t *) &header.magic);
+}
+
+/** @} */
@@ -0,0 +1,428 @@
+#include "w25q128fv_gc.h"
+#include "w25q128fv_mempool.h" // This custom Mortrack's library contains the fixed-block memory pool from which the transient buffers are taken.
+#include "w25q128fv_dma.h" // This custom Mortrack's library contains the cache policy of the buffers into which data is received via DMA.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define W25Q128FV_GC_SECTOR_STATE_DIRTY         (0)         /**< @brief State of a Sector whose contents are unknown or no longer needed, meaning that it must be erased before writing into it. */
+#define W25Q128FV_GC_SECTOR_STATE_FULL          (1)         /**< @brief State of a Sector that has been entirely written and that will not be written again until it is erased. */
+#define W25Q128FV_GC_SECTOR_STATE_OPEN          (2)         /**< @brief State of the Sector that is currently the write frontier. */
+#define W25Q128FV_GC_SECTOR_STATE_FREE          (3)         /**< @brief State of a Sector that is erased and ready to become the write frontier. */
+#define W25Q128FV_GC_SECTOR_STATE_ERASING       (4)         /**< @brief State of the Sector that is currently being erased in the background. */
+#define W25Q128FV_GC_NO_SECTOR                  (0xFFFF)    /**< @brief Value used to indicate that no Sector of the managed region is designated. */
+#define W25Q128FV_GC_ALL_PAGES_LIVE             (0xFFFF)    /**< @brief Value of the live pages bitmap of a Sector whose 16 pages are all live. */
+
+static W25Q128FV_gc_def_t gc;                                       /**< @brief Copy of the W25Q128FV Garbage Collector Definition parameters structure given at @ref init_w25q128fv_gc_module . */
+static uint16_t sector_live_pages[W25Q128FV_GC_MAX_SECTORS];        /**< @brief Bitmap of the live pages of each managed Sector, where the bit 0 stands for the first page of the Sector. */
+static uint32_t sector_write_sequence[W25Q128FV_GC_MAX_SECTORS];    /**< @brief Value of @ref write_sequence when each managed Sector was last written, which is used to calculate its age. */
+static uint8_t sector_state[W25Q128FV_GC_MAX_SECTORS];              /**< @brief State of each managed Sector (e.g., @ref W25Q128FV_GC_SECTOR_STATE_FREE ). */
+static uint32_t write_sequence;                                     /**< @brief Counter of the pages that have been allocated via @ref w25q128fv_gc_allocate_page , which works as the clock used to age the Sectors. */
+static uint16_t frontier_sector;                                    /**< @brief Index, relative to the managed region, of the Sector that is currently the write frontier. */
+static uint8_t frontier_next_page;                                  /**< @brief Index, relative to the @ref frontier_sector , of the next page to be allocated. */
+static uint16_t victim_sector;                                      /**< @brief Index, relative to the managed region, of the Sector whose live pages are currently being relocated. */
+static uint16_t erasing_sector;                                     /**< @brief Index, relative to the managed region, of the Sector that is currently being erased in the background. */
+static W25Q128FV_gc_stats_t stats;                                  /**< @brief Statistics of the @ref w25q128fv_gc . */
+static uint8_t fallback_page_copy_buffer[W25Q128FV_PAGE_SIZE_IN_BYTES] W25Q128FV_DMA_BUFFER_ATTRIBUTES;    /**< @brief Buffer through which a live page is relocated whenever the @ref w25q128fv_mempool is exhausted, since otherwise the free Sectors could run out while the Garbage Collector waits for a block. */
+
+/**@brief   Takes the next page of the write frontier, opening a new frontier Sector if required.
+ *
+ * @param is_gc_allocation  1 if the page is requested by the Garbage Collector itself, which is allowed to use the
+ *                          @ref W25Q128FV_GC_RESERVED_FREE_SECTORS reserved Sectors, or 0 if otherwise.
+ * @param[out] page_index   Pointer to the Memory Location Address where this function will store the index, relative
+ *                          to the first page of the managed region, of the allocated page.
+ *
+ * @retval	W25Q128FV_EC_OK     if a page was successfully allocated.
+ * @retval  W25Q128FV_EC_ERR    if there are no erased pages available.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status allocate_frontier_page(uint8_t is_gc_allocation, uint32_t *page_index);
+
+/**@brief   Selects the Sector with the best cost-benefit score to be the next victim of the Garbage Collector.
+ *
+ * @details The score is ((1-u) * age) / (1+u), which is calculated as ((16-live) * age) / (16+live) with integers.
+ *          Sectors with live pages are only considered if the free Sectors are fewer than
+ *          @ref W25Q128FV_GC_MIN_FREE_SECTORS .
+ *
+ * @return  The index, relative to the managed region, of the selected Sector or @ref W25Q128FV_GC_NO_SECTOR if there
+ *          is no Sector worth collecting.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint16_t select_victim_sector(void);
+
+/**@brief   Copies one live page of the current victim Sector into the write frontier.
+ *
+ * @retval	W25Q128FV_EC_OK     if the live page was successfully relocated.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status relocate_one_victim_page(void);
+
+/**@brief	Counts how many bits are set in a live pages bitmap.
+ *
+ * @param live_pages    Live pages bitmap of a Sector.
+ *
+ * @return  The number of live pages in that bitmap.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t count_live_pages(uint16_t live_pages);
+
+W25Q128FV_Status init_w25q128fv_gc_module(W25Q128FV_gc_def_t *gc_def)
+{
+    /* Validate the given W25Q128FV Garbage Collector Definition parameters. */
+    if ((gc_def->total_sectors<2) || (gc_def->total_sectors>W25Q128FV_GC_MAX_SECTORS)
+        || ((gc_def->first_sector+gc_def->total_sectors) > W25Q128FV_TOTAL_SECTORS) || (gc_def->relocation_callback==NULL))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Garbage Collector Definition parameters. */
+    gc = *gc_def;
+
+    /* Treat every managed Sector as a dirty one until the implementer tells otherwise. */
+    memset(sector_live_pages, 0, sizeof(sector_live_pages));
+    memset(sector_write_sequence, 0, sizeof(sector_write_sequence));
+    memset(sector_state, W25Q128FV_GC_SECTOR_STATE_DIRTY, sizeof(sector_state));
+    memset(&stats, 0, sizeof(stats));
+    write_sequence = 0;
+    frontier_sector = W25Q128FV_GC_NO_SECTOR;
+    frontier_next_page = 0;
+    victim_sector = W25Q128FV_GC_NO_SECTOR;
+    erasing_sector = W25Q128FV_GC_NO_SECTOR;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_gc_mark_page_as_live(uint32_t page, uint32_t page_write_sequence)
+{
+    /** <b>Local variable page_index:</b> @ref uint32_t Type variable used to hold the index of the given page relative to the first page of the managed region. */
+    uint32_t page_index = page - gc.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES;
+    /** <b>Local variable sector_index:</b> @ref uint16_t Type variable used to hold the index of the Sector of the given page relative to the managed region. */
+    uint16_t sector_index = page_index / W25Q128FV_SECTOR_SIZE_IN_PAGES;
+
+    /* Validate that the given page is inside of the managed region. */
+    if ((page < gc.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES) || (sector_index >= gc.total_sectors))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Register the page as live and its Sector as a full one. */
+    if (sector_state[sector_index] == W25Q128FV_GC_SECTOR_STATE_FREE)
+    {
+        stats.free_sectors--;
+    }
+    sector_state[sector_index] = W25Q128FV_GC_SECTOR_STATE_FULL;
+    sector_live_pages[sector_index] |= (1 << (page_index % W25Q128FV_SECTOR_SIZE_IN_PAGES));
+    if (page_write_sequence > sector_write_sequence[sector_index])
+    {
+        sector_write_sequence[sector_index] = page_write_sequence;
+    }
+    if (page_write_sequence >= write_sequence)
+    {
+        write_sequence = page_write_sequence + 1;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_gc_mark_sector_as_erased(uint32_t sector_number)
+{
+    /** <b>Local variable sector_index:</b> @ref uint32_t Type variable used to hold the index of the given Sector relative to the managed region. */
+    uint32_t sector_index = sector_number - gc.first_sector;
+
+    /* Validate that the given Sector is a dirty one inside of the managed region. */
+    if ((sector_number < gc.first_sector) || (sector_index >= gc.total_sectors) || (sector_live_pages[sector_index] != 0))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    if (sector_state[sector_index] == W25Q128FV_GC_SECTOR_STATE_DIRTY)
+    {
+        sector_state[sector_index] = W25Q128FV_GC_SECTOR_STATE_FREE;
+        stats.free_sectors++;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_gc_allocate_page(uint32_t *page)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable page_index:</b> @ref uint32_t Type variable used to hold the index of the allocated page relative to the first page of the managed region. */
+    uint32_t page_index;
+
+    ret = allocate_frontier_page(0, &page_index);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Age the write frontier with the newly allocated page. */
+    sector_write_sequence[frontier_sector] = write_sequence++;
+    *page = gc.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + page_index;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_gc_invalidate_page(uint32_t page)
+{
+    /** <b>Local variable page_index:</b> @ref uint32_t Type variable used to hold the index of the given page relative to the first page of the managed region. */
+    uint32_t page_index = page - gc.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES;
+
+    /* Validate that the given page is inside of the managed region. */
+    if ((page < gc.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES) || (page_index >= gc.total_sectors*W25Q128FV_SECTOR_SIZE_IN_PAGES))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    sector_live_pages[page_index/W25Q128FV_SECTOR_SIZE_IN_PAGES] &= ~(1 << (page_index % W25Q128FV_SECTOR_SIZE_IN_PAGES));
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_gc_run_slice(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+    /** <b>Local variable slice_start_tick:</b> @ref uint32_t Type variable used to hold the value of the @ref HAL_GetTick function when this slice started. */
+    uint32_t slice_start_tick = HAL_GetTick();
+    /** <b>Local variable elapsed_time_in_ms:</b> @ref uint32_t Type variable used to hold the time in milliseconds that this slice has taken so far. */
+    uint32_t elapsed_time_in_ms;
+    /** <b>Local variable units_of_work_done:</b> @ref uint32_t Type variable used to hold the number of page copies or Sector Erase starts made during this slice. */
+    uint32_t units_of_work_done = 0;
+    /** <b>Local variable is_erase_in_progress:</b> @ref uint8_t Type variable used to hold whether the Sector Erase started by a previous slice, or by anything else, is still in progress (i.e., 1) or not (i.e., 0). */
+    uint8_t is_erase_in_progress;
+    /** <b>Local variable is_erase_started:</b> @ref uint8_t Type variable used to hold whether this slice started erasing the victim Sector (i.e., 1) or found another Sector Erase still in progress (i.e., 0). */
+    uint8_t is_erase_started;
+
+    while (1)
+    {
+        /* Conclude the Sector Erase that a previous slice started, if any. */
+        if (erasing_sector != W25Q128FV_GC_NO_SECTOR)
+        {
+            ret = w25q128fv_poll_background_erase(&is_erase_in_progress);
+            if ((ret!=W25Q128FV_EC_OK) || (is_erase_in_progress==1))
+            {
+                break;
+            }
+            sector_state[erasing_sector] = W25Q128FV_GC_SECTOR_STATE_FREE;
+            sector_live_pages[erasing_sector] = 0;
+            erasing_sector = W25Q128FV_GC_NO_SECTOR;
+            stats.free_sectors++;
+            stats.erased_sectors++;
+        }
+
+        /* Choose the next victim Sector if there is none. */
+        if (victim_sector == W25Q128FV_GC_NO_SECTOR)
+        {
+            victim_sector = select_victim_sector();
+            if (victim_sector == W25Q128FV_GC_NO_SECTOR)
+            {
+                break;
+            }
+        }
+
+        /* Stop if another unit of work would not fit into the time budget of this slice. */
+        elapsed_time_in_ms = HAL_GetTick() - slice_start_tick;
+        if ((units_of_work_done>0) && ((elapsed_time_in_ms+W25Q128FV_GC_PAGE_COPY_MAX_TIME_IN_MS) > gc.slice_time_budget_in_ms))
+        {
+            break;
+        }
+
+        /* Either relocate the next live page of the victim Sector or start erasing it if it has no live pages left. */
+        if (sector_live_pages[victim_sector] != 0)
+        {
+            ret = relocate_one_victim_page();
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+        }
+        else
+        {
+            ret = w25q128fv_try_start_erase_sector(gc.first_sector + victim_sector, &is_erase_started);
+            if (is_erase_started == 1)
+            {
+                sector_state[victim_sector] = W25Q128FV_GC_SECTOR_STATE_ERASING;
+                erasing_sector = victim_sector;
+                victim_sector = W25Q128FV_GC_NO_SECTOR;
+                units_of_work_done++;
+            }
+            break;
+        }
+        units_of_work_done++;
+    }
+
+    /* Keep track of the longest pause caused by a slice. */
+    elapsed_time_in_ms = HAL_GetTick() - slice_start_tick;
+    if (elapsed_time_in_ms > stats.max_slice_time_in_ms)
+    {
+        stats.max_slice_time_in_ms = elapsed_time_in_ms;
+    }
+
+    return ret;
+}
+
+uint32_t w25q128fv_gc_get_guaranteed_pause_in_ms(void)
+{
+    if (gc.slice_time_budget_in_ms > W25Q128FV_GC_PAGE_COPY_MAX_TIME_IN_MS)
+    {
+        return gc.slice_time_budget_in_ms;
+    }
+
+    return W25Q128FV_GC_PAGE_COPY_MAX_TIME_IN_MS;
+}
+
+void w25q128fv_gc_get_stats(W25Q128FV_gc_stats_t *gc_stats)
+{
+    *gc_stats = stats;
+}
+
+static W25Q128FV_Status allocate_frontier_page(uint8_t is_gc_allocation, uint32_t *page_index)
+{
+    /* Open a new write frontier if there is none or if the current one is full. */
+    if ((frontier_sector==W25Q128FV_GC_NO_SECTOR) || (frontier_next_page==W25Q128FV_SECTOR_SIZE_IN_PAGES))
+    {
+        if ((stats.free_sectors==0) || ((is_gc_allocation==0) && (stats.free_sectors<=W25Q128FV_GC_RESERVED_FREE_SECTORS)))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        if (frontier_sector != W25Q128FV_GC_NO_SECTOR)
+        {
+            sector_state[frontier_sector] = W25Q128FV_GC_SECTOR_STATE_FULL;
+        }
+        for (uint16_t sector=0; sector<gc.total_sectors; sector++)
+        {
+            if (sector_state[sector] == W25Q128FV_GC_SECTOR_STATE_FREE)
+            {
+                frontier_sector = sector;
+                break;
+            }
+        }
+        sector_state[frontier_sector] = W25Q128FV_GC_SECTOR_STATE_OPEN;
+        sector_live_pages[frontier_sector] = 0;
+        frontier_next_page = 0;
+        stats.free_sectors--;
+    }
+
+    /* Hand out the next page of the write frontier as a live one. */
+    sector_live_pages[frontier_sector] |= (1 << frontier_next_page);
+    *page_index = frontier_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + frontier_next_page;
+    frontier_next_page++;
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint16_t select_victim_sector(void)
+{
+    /** <b>Local variable best_sector:</b> @ref uint16_t Type variable used to hold the index of the Sector with the best score found so far. */
+    uint16_t best_sector = W25Q128FV_GC_NO_SECTOR;
+    /** <b>Local variable best_score:</b> @ref uint64_t Type variable used to hold the best cost-benefit score found so far. */
+    uint64_t best_score = 0;
+    /** <b>Local variable score:</b> @ref uint64_t Type variable used to hold the cost-benefit score of the Sector currently being evaluated. */
+    uint64_t score;
+    /** <b>Local variable live:</b> @ref uint8_t Type variable used to hold the number of live pages of the Sector currently being evaluated. */
+    uint8_t live;
+    /** <b>Local variable is_relocation_allowed:</b> @ref uint8_t Type variable used to hold whether Sectors with live pages may be selected (i.e., 1) or not (i.e., 0). */
+    uint8_t is_relocation_allowed = (stats.free_sectors < W25Q128FV_GC_MIN_FREE_SECTORS);
+
+    for (uint16_t sector=0; sector<gc.total_sectors; sector++)
+    {
+        if ((sector_state[sector]!=W25Q128FV_GC_SECTOR_STATE_FULL) && (sector_state[sector]!=W25Q128FV_GC_SECTOR_STATE_DIRTY))
+        {
+            continue;
+        }
+        if ((sector_live_pages[sector]==W25Q128FV_GC_ALL_PAGES_LIVE) || ((sector_live_pages[sector]!=0) && (is_relocation_allowed==0)))
+        {
+            continue;
+        }
+        live = count_live_pages(sector_live_pages[sector]);
+        score = ((uint64_t) (W25Q128FV_SECTOR_SIZE_IN_PAGES-live) * (write_sequence-sector_write_sequence[sector]+1)) / (W25Q128FV_SECTOR_SIZE_IN_PAGES+live);
+        if (score > best_score)
+        {
+            best_score = score;
+            best_sector = sector;
+        }
+    }
+
+    return best_sector;
+}
+
+static W25Q128FV_Status relocate_one_victim_page(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable victim_page:</b> @ref uint8_t Type variable used to hold the index, relative to the victim Sector, of the live page to be relocated. */
+    uint8_t victim_page = 0;
+    /** <b>Local variable new_page_index:</b> @ref uint32_t Type variable used to hold the index, relative to the first page of the managed region, of the page into which the live page will be relocated. */
+    uint32_t new_page_index;
+    /** <b>Local variable region_first_page:</b> @ref uint32_t Type variable used to hold the first Flash Memory Page of the managed region. */
+    uint32_t region_first_page = gc.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES;
+    /** <b>Local variable old_page:</b> @ref uint32_t Type variable used to hold the Flash Memory Page of the live page to be relocated. */
+    uint32_t old_page;
+    /** <b>Local variable page_copy_buffer:</b> @ref uint8_t Type pointer used to point to the block of the @ref w25q128fv_mempool , or to the @ref fallback_page_copy_buffer , that holds the data of the live page that is being relocated. */
+    uint8_t *page_copy_buffer;
+
+    while ((sector_live_pages[victim_sector] & (1<<victim_page)) == 0)
+    {
+        victim_page++;
+    }
+    old_page = region_first_page + victim_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + victim_page;
+
+    /* Copy the live page into the write frontier. */
+    page_copy_buffer = (uint8_t *) w25q128fv_mempool_alloc();
+    if (page_copy_buffer == NULL)
+    {
+        page_copy_buffer = fallback_page_copy_buffer;
+    }
+    ret = w25q128fv_fast_read_flash_memory(old_page, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, page_copy_buffer);
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = allocate_frontier_page(1, &new_page_index);
+    }
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = w25q128fv_write_flash_memory(region_first_page+new_page_index, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, page_copy_buffer);
+    }
+    if (page_copy_buffer != fallback_page_copy_buffer)
+    {
+        w25q128fv_mempool_free(page_copy_buffer);
+    }
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Relocated data keeps the age of the victim Sector instead of looking as if it had just been written. */
+    if (sector_write_sequence[victim_sector] > sector_write_sequence[frontier_sector])
+    {
+        sector_write_sequence[frontier_sector] = sector_write_sequence[victim_sector];
+    }
+    sector_live_pages[victim_sector] &= ~(1 << victim_page);
+    gc.relocation_callback(old_page, region_first_page+new_page_index);
+    stats.relocated_pages++;
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint8_t count_live_pages(uint16_t live_pages)
+{
+    /** <b>Local variable live:</b> @ref uint8_t Type variable used to hold the number of live pages counted so far. */
+    uint8_t live = 0;
+
+    while (live_pages != 0)
+    {
+        live_pages &= (live_pages - 1);
+        live++;
+    }
+
+    return live;
+}
@@ -0,0 +1,228 @@
+#include "w25q128fv_image.h"
+#include "w25q128fv_writer.h" // This custom Mortrack's library contains the functions, definitions and variables of the W25Q128FV Stream Writer module.
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <stddef.h> // Library from which "offsetof()" is located at.
+
+#define W25Q128FV_IMAGE_MAGIC                   (0x474D4957)    /**< @brief Value that identifies the header of an installable image (i.e., "WIMG" in little endian). */
+#define W25Q128FV_IMAGE_STATE_IDLE              (0)             /**< @brief State in which no image is being staged. */
+#define W25Q128FV_IMAGE_STATE_RECEIVING         (1)             /**< @brief State in which the chunks of an image are being written. */
+#define W25Q128FV_IMAGE_STATE_WRITTEN           (2)             /**< @brief State in which the whole image was written and its digest is known. */
+#define W25Q128FV_IMAGE_STATE_VERIFIED          (3)             /**< @brief State in which the image was read back and its digest matched. */
+
+/**@brief	Header at the first Page of the managed region, which describes the installable image.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;                                         //!< Must be @ref W25Q128FV_IMAGE_MAGIC .
+    uint32_t crc32;                                         //!< CRC-32 of the rest of the header.
+    uint32_t size_in_bytes;                                 //!< Size in bytes of the image.
+    uint8_t digest[W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES];  //!< SHA-256 digest of the image.
+} W25Q128FV_image_header_t;
+
+static W25Q128FV_image_def_t image;                                     /**< @brief Copy of the W25Q128FV Image Staging Definition parameters structure given at @ref init_w25q128fv_image_module . */
+static uint8_t image_state = W25Q128FV_IMAGE_STATE_IDLE;                /**< @brief State of the image being staged (e.g., @ref W25Q128FV_IMAGE_STATE_RECEIVING ). */
+static W25Q128FV_writer_t image_writer;                                 /**< @brief Writer of the image being staged. */
+static W25Q128FV_sha256_t image_sha256;                                 /**< @brief SHA-256 calculation of the image being staged, which is used while writing it and then again while reading it back. */
+static uint8_t written_digest[W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES];   /**< @brief SHA-256 digest of the data that was written for the image being staged. */
+
+/**@brief   Feeds a chunk read back by @ref w25q128fv_image_verify into @ref image_sha256 .
+ *
+ * @param[in] chunk Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK always, so that the whole image is read.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status hash_read_chunk(uint8_t *chunk, uint16_t size);
+
+W25Q128FV_Status init_w25q128fv_image_module(W25Q128FV_image_def_t *image_def)
+{
+    /* Validate the given W25Q128FV Image Staging Definition parameters. */
+    if ((image_def->total_sectors<2) || (image_def->first_sector>=W25Q128FV_TOTAL_SECTORS)
+        || (image_def->total_sectors>(W25Q128FV_TOTAL_SECTORS-image_def->first_sector)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV Image Staging Definition parameters. */
+    image = *image_def;
+    image_state = W25Q128FV_IMAGE_STATE_IDLE;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_image_begin(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    image_state = W25Q128FV_IMAGE_STATE_IDLE;
+
+    /* Make the previously installable image, if any, not installable anymore. */
+    ret = w25q128fv_erase_sector(image.first_sector);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    ret = w25q128fv_writer_open(&image_writer, image.first_sector+1, image.total_sectors-1);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    w25q128fv_sha256_init(&image_sha256);
+    image_state = W25Q128FV_IMAGE_STATE_RECEIVING;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_image_write(uint8_t *data, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if (image_state != W25Q128FV_IMAGE_STATE_RECEIVING)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Write the chunk first so that it is only hashed if it was accepted by the writer. */
+    ret = w25q128fv_writer_write(&image_writer, data, size);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    w25q128fv_sha256_update(&image_sha256, data, size);
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_image_end(const uint8_t *expected_digest)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if (image_state != W25Q128FV_IMAGE_STATE_RECEIVING)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    ret = w25q128fv_writer_close(&image_writer);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    w25q128fv_sha256_final(&image_sha256, written_digest);
+
+    /* Discard the image if it is not the expected one. */
+    if ((expected_digest!=NULL) && (memcmp(written_digest, expected_digest, W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES)!=0))
+    {
+        image_state = W25Q128FV_IMAGE_STATE_IDLE;
+        return W25Q128FV_EC_ERR;
+    }
+    image_state = W25Q128FV_IMAGE_STATE_WRITTEN;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_image_verify(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable read_digest:</b> @ref uint8_t array Type variable used to hold the SHA-256 digest of the data read back. */
+    uint8_t read_digest[W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES];
+
+    if ((image_state!=W25Q128FV_IMAGE_STATE_WRITTEN) && (image_state!=W25Q128FV_IMAGE_STATE_VERIFIED))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Hash the image while it is read back, such that each chunk is hashed while the next one is being received. */
+    w25q128fv_sha256_init(&image_sha256);
+    ret = w25q128fv_stream_read((image.first_sector+1)*W25Q128FV_SECTOR_SIZE_IN_BYTES, image_writer.size_in_bytes, hash_read_chunk);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    w25q128fv_sha256_final(&image_sha256, read_digest);
+
+    /* Discard the image if any of its data was not correctly stored. */
+    if (memcmp(read_digest, written_digest, W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES) != 0)
+    {
+        image_state = W25Q128FV_IMAGE_STATE_IDLE;
+        return W25Q128FV_EC_ERR;
+    }
+    image_state = W25Q128FV_IMAGE_STATE_VERIFIED;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_image_install(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_image_header_t Type variable used to hold the header of the image. */
+    W25Q128FV_image_header_t header;
+
+    if (image_state != W25Q128FV_IMAGE_STATE_VERIFIED)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    header.magic = W25Q128FV_IMAGE_MAGIC;
+    header.size_in_bytes = image_writer.size_in_bytes;
+    memcpy(header.digest, written_digest, W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES);
+    header.crc32 = w25q128fv_crc32_update(0, (uint8_t *) &header.size_in_bytes, sizeof(header)-offsetof(W25Q128FV_image_header_t, size_in_bytes));
+
+    /* Write the header with its magic number last, such that a power loss in between leaves no installable image. */
+    ret = w25q128fv_write_flash_memory(image.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, offsetof(W25Q128FV_image_header_t, crc32), sizeof(header)-offsetof(W25Q128FV_image_header_t, crc32), (uint8_t *) &header.crc32);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = w25q128fv_write_flash_memory(image.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(header.magic), (uint8_t *) &header.magic);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    image_state = W25Q128FV_IMAGE_STATE_IDLE;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_image_get_installed(W25Q128FV_image_info_t *info)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_image_header_t Type variable used to hold the header of the image. */
+    W25Q128FV_image_header_t header;
+
+    ret = w25q128fv_fast_read_flash_memory(image.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(header), (uint8_t *) &header);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if ((header.magic != W25Q128FV_IMAGE_MAGIC)
+        || (header.crc32 != w25q128fv_crc32_update(0, (uint8_t *) &header.size_in_bytes, sizeof(header)-offsetof(W25Q128FV_image_header_t, size_in_bytes)))
+        || (header.size_in_bytes > ((image.total_sectors-1)*W25Q128FV_SECTOR_SIZE_IN_BYTES)))
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    info->address = (image.first_sector+1)*W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    info->size_in_bytes = header.size_in_bytes;
+    memcpy(info->digest, header.digest, W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES);
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status hash_read_chunk(uint8_t *chunk, uint16_t size)
+{
+    w25q128fv_sha256_update(&image_sha256, chunk, size);
+
+    return W25Q128FV_EC_OK;
+}
+
+/** @} */
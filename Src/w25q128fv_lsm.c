@@ -0,0 +1,1376 @@
+#include "w25q128fv_lsm.h"
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include "w25q128fv_scan.h" // This custom Mortrack's library contains the scan of Sector headers used at mount time.
+#include <stddef.h> // Library from which "offsetof()" and "NULL" are located at.
+#include <string.h>	// Library from which "memset()", "memcpy()" and "memmove()" are located at.
+
+#define W25Q128FV_LSM_RUN_MAGIC                 (0x4D534C57)    /**< @brief Value that identifies the header of a sorted run (i.e., "WLSM" in little endian). */
+#define W25Q128FV_LSM_ENTRIES_PER_PAGE          (W25Q128FV_PAGE_SIZE_IN_BYTES / sizeof(W25Q128FV_lsm_entry_t))  /**< @brief Number of key/value pairs of each data Page of a sorted run. */
+#define W25Q128FV_LSM_KEYS_PER_INDEX_PAGE       (W25Q128FV_PAGE_SIZE_IN_BYTES / sizeof(uint32_t))               /**< @brief Number of keys of each sparse index Page of a sorted run. */
+#define W25Q128FV_LSM_MAX_DATA_PAGES            ((W25Q128FV_LSM_MAX_RUN_ENTRIES + 31) / 32)                     /**< @brief Maximum number of data Pages of a single sorted run. */
+#define W25Q128FV_LSM_MAX_INDEX_PAGES           ((W25Q128FV_LSM_MAX_DATA_PAGES + 63) / 64)                      /**< @brief Maximum number of sparse index Pages of a single sorted run. */
+#define W25Q128FV_LSM_NO_PAGE                   (0xFFFFFFFF)    /**< @brief Value that indicates that no data Page of an input run has been loaded into its merge buffer. */
+#define W25Q128FV_LSM_MERGE_STATE_IDLE          (0) /**< @brief State of the merge compaction when no runs are being merged. */
+#define W25Q128FV_LSM_MERGE_STATE_ERASING       (1) /**< @brief State of the merge compaction when the Sectors of the merged run are being erased. */
+#define W25Q128FV_LSM_MERGE_STATE_MERGING       (2) /**< @brief State of the merge compaction when the data Pages of the merged run are being written. */
+#define W25Q128FV_LSM_MERGE_STATE_WRITING_INDEX (3) /**< @brief State of the merge compaction when the sparse index Pages of the merged run are being written. */
+#define W25Q128FV_LSM_MERGE_STATE_WRITING_BLOOM (4) /**< @brief State of the merge compaction when the Bloom filter Pages of the merged run are being written. */
+#define W25Q128FV_LSM_MERGE_STATE_WRITING_HEADER (5) /**< @brief State of the merge compaction when the header of the merged run is to be written. */
+
+/**@brief	Key/value pair as stored in the memtable and in the data Pages of a sorted run.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t key;           //!< Key.
+    uint32_t value;         //!< Value of the key or @ref W25Q128FV_LSM_TOMBSTONE if it was deleted.
+} W25Q128FV_lsm_entry_t;
+
+/**@brief	Header at the beginning of the first Sector of a sorted run.
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;                 //!< Must be @ref W25Q128FV_LSM_RUN_MAGIC .
+    uint32_t crc32;                 //!< CRC-32 of the rest of the header.
+    uint32_t sequence;              //!< Greatest sequence number covered by the run, where newer runs have greater ones.
+    uint32_t first_sequence;        //!< Smallest sequence number covered by the run, which is smaller than @ref sequence only for merged runs.
+    uint32_t total_entries;         //!< Number of key/value pairs of the run.
+    uint32_t min_key;               //!< Smallest key of the run.
+    uint32_t max_key;               //!< Greatest key of the run.
+    uint16_t total_sectors;         //!< Number of Sectors of the run.
+    uint16_t bloom_size_in_bytes;   //!< Size in bytes of the Bloom filter of the run or 0 if it has none.
+    uint8_t bloom_hashes;           //!< Number of hashes of the Bloom filter of the run.
+    uint8_t reserved[3];            //!< Reserved, written as 0.
+} W25Q128FV_lsm_run_header_t;
+
+/**@brief	RAM state of a sorted run.
+ */
+typedef struct {
+    uint16_t first_sector;          //!< First Sector of the run, relative to the managed region.
+    uint16_t total_sectors;         //!< Number of Sectors of the run.
+    uint32_t sequence;              //!< Greatest sequence number covered by the run.
+    uint32_t first_sequence;        //!< Smallest sequence number covered by the run.
+    uint32_t total_entries;         //!< Number of key/value pairs of the run.
+    uint32_t min_key;               //!< Smallest key of the run.
+    uint32_t max_key;               //!< Greatest key of the run.
+    uint16_t bloom_size_in_bytes;   //!< Size in bytes of the Bloom filter of the run as stored into the W25Q128FV Device.
+    uint8_t bloom_hashes;           //!< Number of hashes of the Bloom filter of the run.
+    uint16_t bloom_offset;          //!< Offset in bytes of the Bloom filter of the run inside of the @ref bloom_pool .
+    uint8_t is_bloom_cached;        //!< Flag that indicates whether the Bloom filter of the run is held by the @ref bloom_pool (i.e., 1) or not (i.e., 0).
+    uint32_t index_page_keys[W25Q128FV_LSM_MAX_INDEX_PAGES];   //!< First key of each sparse index Page of the run.
+} W25Q128FV_lsm_run_t;
+
+static W25Q128FV_lsm_def_t lsm;                                                     /**< @brief Copy of the W25Q128FV LSM Sorted Runs Definition parameters structure given at @ref init_w25q128fv_lsm_module . */
+static uint8_t is_mounted;                                                          /**< @brief Flag that indicates whether the store is mounted (i.e., 1) or not (i.e., 0). */
+static W25Q128FV_lsm_entry_t memtable[W25Q128FV_LSM_MEMTABLE_ENTRIES];              /**< @brief Memtable, sorted by key. */
+static uint16_t memtable_count;                                                     /**< @brief Number of key/value pairs in the @ref memtable . */
+static W25Q128FV_lsm_run_t runs[W25Q128FV_LSM_MAX_RUNS+1];                          /**< @brief RAM state of the sorted runs, from the newest to the oldest. @details The extra entry lets @ref w25q128fv_lsm_mount hold a run whose header a power loss left valid after it was merged, until the merged run that covers it is found. */
+static uint8_t run_count;                                                           /**< @brief Number of sorted runs in @ref runs . */
+static uint32_t next_sequence;                                                      /**< @brief Sequence number of the next flushed run. */
+static uint8_t sector_bitmap[(W25Q128FV_LSM_MAX_SECTORS+7)/8];                      /**< @brief Bitmap of the Sectors of the managed region, where a set bit means that the Sector belongs to a run or to the merge in progress. */
+static uint8_t bloom_pool[W25Q128FV_LSM_BLOOM_POOL_SIZE_IN_BYTES];                  /**< @brief RAM pool of the Bloom filters of the sorted runs, which are packed one after the other. */
+static uint16_t bloom_pool_used;                                                    /**< @brief Number of bytes in use of the @ref bloom_pool . */
+static uint32_t lookup_buffer[W25Q128FV_LSM_KEYS_PER_INDEX_PAGE];                   /**< @brief Buffer for the sparse index Pages and the data Pages that are read by lookups, and for the sparse index Pages and the Bloom filter Pages that are written by flushes. */
+static uint8_t merge_state;                                                         /**< @brief Current state of the merge compaction (e.g., @ref W25Q128FV_LSM_MERGE_STATE_MERGING ). */
+static uint8_t is_merge_erase_in_progress;                                          /**< @brief Flag that indicates whether the merge compaction started a Sector Erase that has not been concluded yet (i.e., 1) or not (i.e., 0). */
+static uint32_t merge_newer_sequence;                                               /**< @brief Sequence number of the newer of the two runs being merged, whose older neighbour is the other one. */
+static uint8_t merge_drop_tombstones;                                               /**< @brief Flag that indicates whether the older run being merged is the oldest one, in which case tombstones are dropped (i.e., 1) or not (i.e., 0). */
+static W25Q128FV_lsm_run_t merge_run;                                               /**< @brief RAM state of the merged run, whose total Sectors are the reserved ones until it is committed. */
+static uint32_t merge_cursor;                                                       /**< @brief Number of Sectors erased or of sparse index or Bloom filter Pages written so far by the current state of the merge. */
+static uint32_t merge_positions[2];                                                 /**< @brief Index of the next key/value pair of the newer (i.e., 0) and of the older (i.e., 1) run being merged. */
+static uint32_t merge_loaded_pages[2];                                              /**< @brief Data Page of each run being merged that is held by @ref merge_input_buffers or @ref W25Q128FV_LSM_NO_PAGE . */
+static W25Q128FV_lsm_entry_t merge_input_buffers[2][W25Q128FV_LSM_ENTRIES_PER_PAGE]; /**< @brief Data Page of each run being merged. */
+static W25Q128FV_lsm_entry_t merge_output_buffer[W25Q128FV_LSM_ENTRIES_PER_PAGE];   /**< @brief Data Page of the merged run that is being filled. */
+static uint8_t merge_output_count;                                                  /**< @brief Number of key/value pairs in @ref merge_output_buffer . */
+static uint32_t merge_data_pages;                                                   /**< @brief Number of data Pages of the merged run written so far. */
+static uint32_t merge_index_keys[W25Q128FV_LSM_MAX_DATA_PAGES];                     /**< @brief First key of each data Page of the merged run (i.e., its sparse index). */
+static uint32_t merge_bloom_data_page;                                              /**< @brief Next data Page of the merged run whose keys are to be added into the Bloom filter Page that is being built in @ref merge_output_buffer , when that filter is not cached. */
+
+/**@brief   Recovers the sorted run of a header found by @ref w25q128fv_scan_headers , unless it is invalid or covered by
+ *          a merged run, and drops the recovered runs that it covers.
+ *
+ * @details The header of every dropped run is invalidated so that stale runs do not pile up across mounts.
+ *
+ * @param sector_number     Flash Memory Sector of the W25Q128FV Device where the header is.
+ * @param[in] header_data   Pointer to the Memory Location Address of the header.
+ *
+ * @retval	W25Q128FV_EC_OK     if the header was successfully processed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the runs recovered so far, which may still include one that a later header covers,
+ *                              exceed @ref runs or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status recover_run(uint32_t sector_number, uint8_t *header_data);
+
+/**@brief   Invalidates the header of a sorted run by clearing its magic, which needs no Sector Erase.
+ *
+ * @param first_sector  First Sector of the run, relative to the managed region.
+ *
+ * @retval	W25Q128FV_EC_OK     if the header was successfully invalidated.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status invalidate_run_header(uint16_t first_sector);
+
+/**@brief   Gets the number of Pages of a sorted run, including its header Page.
+ *
+ * @param total_entries         Number of key/value pairs of the run.
+ * @param bloom_size_in_bytes   Size in bytes of the Bloom filter of the run.
+ *
+ * @return  The number of Pages of the run.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t get_run_total_pages(uint32_t total_entries, uint16_t bloom_size_in_bytes);
+
+/**@brief   Gets the Page of the W25Q128FV Device of a Page of a sorted run.
+ *
+ * @param first_sector  First Sector of the run, relative to the managed region.
+ * @param page          Page relative to the start of the run, where 0 is its header Page.
+ *
+ * @return  The Page of the W25Q128FV Device.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t get_run_device_page(uint16_t first_sector, uint32_t page);
+
+/**@brief   Reserves the first run of consecutive free Sectors of the managed region that is long enough.
+ *
+ * @param total_sectors     Number of Sectors to be reserved.
+ * @param[out] first_sector Pointer to the Memory Location Address where the first reserved Sector, relative to the
+ *                          managed region, will be stored.
+ *
+ * @return  1 if the Sectors were reserved or 0 if there are not enough consecutive free Sectors.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t reserve_sectors(uint32_t total_sectors, uint16_t *first_sector);
+
+/**@brief   Marks some consecutive Sectors of the managed region as either used or free.
+ *
+ * @param first_sector  First Sector, relative to the managed region.
+ * @param total_sectors Number of Sectors.
+ * @param is_used       1 to mark the Sectors as used or 0 to mark them as free.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void mark_sectors(uint16_t first_sector, uint32_t total_sectors, uint8_t is_used);
+
+/**@brief   Reserves space for a Bloom filter at the end of the @ref bloom_pool .
+ *
+ * @param size          Size in bytes of the Bloom filter.
+ * @param[out] offset   Pointer to the Memory Location Address where the offset of the reserved space will be stored.
+ *
+ * @return  1 if the space was reserved or 0 if the @ref bloom_pool does not have enough free space.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t reserve_bloom(uint16_t size, uint16_t *offset);
+
+/**@brief   Releases the space of a Bloom filter from the @ref bloom_pool by moving the filters that follow it, whose
+ *          offsets are updated accordingly.
+ *
+ * @param offset    Offset in bytes of the Bloom filter inside of the @ref bloom_pool .
+ * @param size      Size in bytes of the Bloom filter.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void release_bloom(uint16_t offset, uint16_t size);
+
+/**@brief   Writes the header of a sorted run, with its magic written last.
+ *
+ * @param[in] run   Pointer to the Memory Location Address of the RAM state of the run.
+ *
+ * @retval	W25Q128FV_EC_OK     if the header was successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_run_header(W25Q128FV_lsm_run_t *run);
+
+/**@brief   Searches a sorted run for a key.
+ *
+ * @param[in] run       Pointer to the Memory Location Address of the RAM state of the run.
+ * @param key           Key to be searched for.
+ * @param[out] value    Pointer to the Memory Location Address where the value of the \p key will be stored if it is
+ *                      found.
+ * @param[out] is_found Pointer to the Memory Location Address where a 1 will be written if the \p key was found or a 0
+ *                      if otherwise.
+ *
+ * @retval	W25Q128FV_EC_OK     if the run was successfully searched.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status search_run(W25Q128FV_lsm_run_t *run, uint32_t key, uint32_t *value, uint8_t *is_found);
+
+/**@brief   Gets the index in @ref runs of the newest sorted run whose Bloom filter is not cached but fits into the free
+ *          space of the @ref bloom_pool .
+ *
+ * @return  The index of the run or @ref run_count if there is no such run.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t find_uncached_bloom(void);
+
+/**@brief   Reads the Bloom filter of a sorted run into the @ref bloom_pool , if it fits.
+ *
+ * @param run   Pointer to the Memory Location Address of the RAM state of the run.
+ *
+ * @retval	W25Q128FV_EC_OK     if the Bloom filter was successfully cached or if it does not fit.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status cache_bloom(W25Q128FV_lsm_run_t *run);
+
+/**@brief   Gets the index in @ref runs of the sorted run with a given sequence number.
+ *
+ * @param sequence  Sequence number of the run.
+ *
+ * @return  The index of the run or @ref run_count if there is no such run.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t find_run(uint32_t sequence);
+
+/**@brief   Inserts a key/value pair into the @ref memtable , flushing it first if it is full.
+ *
+ * @param key       Key to be inserted.
+ * @param value     Value of the \p key .
+ *
+ * @retval	W25Q128FV_EC_OK     if the key/value pair was successfully inserted.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the @ref memtable could not be flushed or if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status insert_into_memtable(uint32_t key, uint32_t value);
+
+/**@brief   Chooses the two adjacent sorted runs to be merged and reserves the Sectors of the merged run.
+ *
+ * @return  1 if a merge was started or 0 if there is nothing to merge or no room for the merged run.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t select_merge(void);
+
+/**@brief   Makes one unit of work of the @ref W25Q128FV_LSM_MERGE_STATE_MERGING state, which loads up to two data Pages
+ *          of the runs being merged and writes the data Page of the merged run once it is full.
+ *
+ * @param newer_run Index in @ref runs of the newer of the two runs being merged.
+ *
+ * @retval	W25Q128FV_EC_OK     if the unit of work was successfully made.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status merge_next_page(uint8_t newer_run);
+
+/**@brief   Replaces the two merged sorted runs with the merged one, whose header has already been written, invalidates
+ *          their headers and releases their Sectors and Bloom filters.
+ *
+ * @details The RAM state is replaced even if invalidating a header fails, since the merged run already covers both
+ *          runs and @ref w25q128fv_lsm_mount drops and invalidates any header that is left behind.
+ *
+ * @param newer_run Index in @ref runs of the newer of the two runs that were merged.
+ *
+ * @retval	W25Q128FV_EC_OK     if the headers of both runs were successfully invalidated.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status commit_merge(uint8_t newer_run);
+
+W25Q128FV_Status init_w25q128fv_lsm_module(W25Q128FV_lsm_def_t *lsm_def)
+{
+    /* Validate the given W25Q128FV LSM Sorted Runs Definition parameters. */
+    if ((lsm_def->total_sectors==0) || (lsm_def->total_sectors>W25Q128FV_LSM_MAX_SECTORS) || ((lsm_def->first_sector+lsm_def->total_sectors) > W25Q128FV_TOTAL_SECTORS))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV LSM Sorted Runs Definition parameters. */
+    lsm = *lsm_def;
+    is_mounted = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_lsm_format(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    is_mounted = 0;
+    for (uint32_t sector=0; sector<lsm.total_sectors; sector++)
+    {
+        ret = w25q128fv_erase_sector(lsm.first_sector + sector);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    return w25q128fv_lsm_mount();
+}
+
+W25Q128FV_Status w25q128fv_lsm_mount(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable data_pages:</b> @ref uint32_t Type variable used to hold the number of data Pages of a sorted run. */
+    uint32_t data_pages;
+    /** <b>Local variable index_pages:</b> @ref uint32_t Type variable used to hold the number of sparse index Pages of a sorted run. */
+    uint32_t index_pages;
+    /** <b>Local variable i:</b> @ref uint8_t Type variable used to iterate over the sorted runs. */
+    uint8_t i;
+
+    is_mounted = 0;
+    memtable_count = 0;
+    run_count = 0;
+    next_sequence = 1;
+    bloom_pool_used = 0;
+    merge_state = W25Q128FV_LSM_MERGE_STATE_IDLE;
+    is_merge_erase_in_progress = 0;
+    memset(sector_bitmap, 0, sizeof(sector_bitmap));
+
+    /* Wait for a Sector Erase that a merge slice may have left in the background, since a suspended Sector does not read back its data. */
+    ret = w25q128fv_wait_for_background_erase();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    /* Look for a valid run header at the beginning of every Sector, dropping the runs that are covered by a merged one. */
+    ret = w25q128fv_scan_headers(lsm.first_sector, lsm.total_sectors, W25Q128FV_LSM_RUN_MAGIC, sizeof(W25Q128FV_lsm_run_header_t), NULL, recover_run);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    if (run_count > W25Q128FV_LSM_MAX_RUNS)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Load the first key of each sparse index Page and the Bloom filter of every run. */
+    for (i=0; i<run_count; i++)
+    {
+        mark_sectors(runs[i].first_sector, runs[i].total_sectors, 1);
+        if ((runs[i].sequence+1) > next_sequence)
+        {
+            next_sequence = runs[i].sequence + 1;
+        }
+        data_pages = (runs[i].total_entries + W25Q128FV_LSM_ENTRIES_PER_PAGE-1) / W25Q128FV_LSM_ENTRIES_PER_PAGE;
+        index_pages = (data_pages + W25Q128FV_LSM_KEYS_PER_INDEX_PAGE-1) / W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+        for (uint32_t page=0; page<index_pages; page++)
+        {
+            ret = w25q128fv_fast_read_flash_memory(get_run_device_page(runs[i].first_sector, 1+data_pages+page), 0, sizeof(uint32_t), (uint8_t *) &runs[i].index_page_keys[page]);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+        }
+        ret = cache_bloom(&runs[i]);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_lsm_put(uint32_t key, uint32_t value)
+{
+    if ((is_mounted==0) || (value==W25Q128FV_LSM_TOMBSTONE))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    return insert_into_memtable(key, value);
+}
+
+W25Q128FV_Status w25q128fv_lsm_delete(uint32_t key)
+{
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    return insert_into_memtable(key, W25Q128FV_LSM_TOMBSTONE);
+}
+
+W25Q128FV_Status w25q128fv_lsm_get(uint32_t key, uint32_t *value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable is_found:</b> @ref uint8_t Type variable used to hold whether the key was found (i.e., 1) or not (i.e., 0). */
+    uint8_t is_found = 0;
+    /** <b>Local variable low:</b> @ref uint16_t Type variable used to hold the lower bound of the binary search in the memtable. */
+    uint16_t low = 0;
+    /** <b>Local variable high:</b> @ref uint16_t Type variable used to hold the upper bound of the binary search in the memtable. */
+    uint16_t high = memtable_count;
+    /** <b>Local variable middle:</b> @ref uint16_t Type variable used to hold the middle point of the binary search in the memtable. */
+    uint16_t middle;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Check the memtable first and then the runs from the newest to the oldest. */
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (memtable[middle].key < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if ((low<memtable_count) && (memtable[low].key==key))
+    {
+        *value = memtable[low].value;
+        is_found = 1;
+    }
+    for (uint8_t i=0; (i<run_count) && (is_found==0); i++)
+    {
+        ret = search_run(&runs[i], key, value, &is_found);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    if ((is_found==0) || (*value==W25Q128FV_LSM_TOMBSTONE))
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_lsm_flush(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+    /** <b>Local variable run:</b> @ref W25Q128FV_lsm_run_t Type variable used to hold the RAM state of the new run. */
+    W25Q128FV_lsm_run_t run;
+    /** <b>Local variable data_pages:</b> @ref uint32_t Type variable used to hold the number of data Pages of the new run. */
+    uint32_t data_pages = (memtable_count + W25Q128FV_LSM_ENTRIES_PER_PAGE-1) / W25Q128FV_LSM_ENTRIES_PER_PAGE;
+    /** <b>Local variable index_pages:</b> @ref uint32_t Type variable used to hold the number of sparse index Pages of the new run. */
+    uint32_t index_pages = (data_pages + W25Q128FV_LSM_KEYS_PER_INDEX_PAGE-1) / W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+    /** <b>Local variable count:</b> @ref uint32_t Type variable used to hold the number of entries of the Page being written. */
+    uint32_t count;
+
+    if ((is_mounted==0) || ((memtable_count>0) && (run_count==W25Q128FV_LSM_MAX_RUNS)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (memtable_count == 0)
+    {
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Reserve the Sectors of the new run and a place in RAM for its Bloom filter, which is still stored if the RAM pool is full. */
+    memset(&run, 0, sizeof(run));
+    run.total_entries = memtable_count;
+    run.bloom_size_in_bytes = w25q128fv_bloom_get_size(memtable_count, W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM);
+    run.bloom_hashes = w25q128fv_bloom_get_total_hashes(W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM);
+    run.is_bloom_cached = reserve_bloom(run.bloom_size_in_bytes, &run.bloom_offset);
+    run.total_sectors = (get_run_total_pages(run.total_entries, run.bloom_size_in_bytes) + W25Q128FV_SECTOR_SIZE_IN_PAGES-1) / W25Q128FV_SECTOR_SIZE_IN_PAGES;
+    if (reserve_sectors(run.total_sectors, &run.first_sector) == 0)
+    {
+        if (run.is_bloom_cached == 1)
+        {
+            release_bloom(run.bloom_offset, run.bloom_size_in_bytes);
+        }
+        return W25Q128FV_EC_ERR;
+    }
+    run.sequence = next_sequence;
+    run.first_sequence = next_sequence;
+    run.min_key = memtable[0].key;
+    run.max_key = memtable[memtable_count-1].key;
+
+    /* Erase the Sectors and write the data Pages, the sparse index Pages and the Bloom filter Pages in full Page bursts. */
+    for (uint32_t sector=0; sector<run.total_sectors; sector++)
+    {
+        ret = w25q128fv_erase_sector(lsm.first_sector + run.first_sector + sector);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            break;
+        }
+    }
+    for (uint32_t page=0; (page<data_pages) && (ret==W25Q128FV_EC_OK); page++)
+    {
+        count = memtable_count - page*W25Q128FV_LSM_ENTRIES_PER_PAGE;
+        count = (count > W25Q128FV_LSM_ENTRIES_PER_PAGE) ? W25Q128FV_LSM_ENTRIES_PER_PAGE : count;
+        ret = w25q128fv_write_flash_memory(get_run_device_page(run.first_sector, 1+page), 0, count*sizeof(W25Q128FV_lsm_entry_t), (uint8_t *) &memtable[page*W25Q128FV_LSM_ENTRIES_PER_PAGE]);
+    }
+    for (uint32_t page=0; (page<index_pages) && (ret==W25Q128FV_EC_OK); page++)
+    {
+        count = data_pages - page*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+        count = (count > W25Q128FV_LSM_KEYS_PER_INDEX_PAGE) ? W25Q128FV_LSM_KEYS_PER_INDEX_PAGE : count;
+        for (uint32_t i=0; i<count; i++)
+        {
+            lookup_buffer[i] = memtable[(page*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE + i) * W25Q128FV_LSM_ENTRIES_PER_PAGE].key;
+        }
+        run.index_page_keys[page] = lookup_buffer[0];
+        ret = w25q128fv_write_flash_memory(get_run_device_page(run.first_sector, 1+data_pages+page), 0, count*sizeof(uint32_t), (uint8_t *) lookup_buffer);
+    }
+    if ((run.is_bloom_cached==1) && (ret==W25Q128FV_EC_OK))
+    {
+        memset(&bloom_pool[run.bloom_offset], 0, run.bloom_size_in_bytes);
+        for (uint16_t i=0; i<memtable_count; i++)
+        {
+            w25q128fv_bloom_add(&bloom_pool[run.bloom_offset], run.bloom_size_in_bytes, run.bloom_hashes, memtable[i].key);
+        }
+        ret = w25q128fv_write_flash_memory(get_run_device_page(run.first_sector, 1+data_pages+index_pages), 0, run.bloom_size_in_bytes, &bloom_pool[run.bloom_offset]);
+    }
+    for (uint32_t offset=0; (run.is_bloom_cached==0) && (offset<run.bloom_size_in_bytes) && (ret==W25Q128FV_EC_OK); offset+=W25Q128FV_PAGE_SIZE_IN_BYTES)
+    {
+        /* Since every key falls into a single block, the Bloom filter can be built one Page at a time without the pool. */
+        count = run.bloom_size_in_bytes - offset;
+        count = (count > W25Q128FV_PAGE_SIZE_IN_BYTES) ? W25Q128FV_PAGE_SIZE_IN_BYTES : count;
+        memset(lookup_buffer, 0, sizeof(lookup_buffer));
+        for (uint16_t i=0; i<memtable_count; i++)
+        {
+            w25q128fv_bloom_add_to_window((uint8_t *) lookup_buffer, offset, count, run.bloom_size_in_bytes, run.bloom_hashes, memtable[i].key);
+        }
+        ret = w25q128fv_write_flash_memory(get_run_device_page(run.first_sector, 1+data_pages+index_pages+offset/W25Q128FV_PAGE_SIZE_IN_BYTES), 0, count, (uint8_t *) lookup_buffer);
+    }
+
+    /* Commit the new run by writing its header. */
+    if (ret == W25Q128FV_EC_OK)
+    {
+        ret = write_run_header(&run);
+    }
+    if (ret != W25Q128FV_EC_OK)
+    {
+        mark_sectors(run.first_sector, run.total_sectors, 0);
+        if (run.is_bloom_cached == 1)
+        {
+            release_bloom(run.bloom_offset, run.bloom_size_in_bytes);
+        }
+        return ret;
+    }
+    memmove(&runs[1], &runs[0], run_count * sizeof(W25Q128FV_lsm_run_t));
+    runs[0] = run;
+    run_count++;
+    next_sequence++;
+    memtable_count = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_lsm_compact_run_slice(uint32_t bus_time_budget_in_ms, uint8_t *is_compacted)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+    /** <b>Local variable slice_start_tick:</b> @ref uint32_t Type variable used to hold the value of the @ref HAL_GetTick function when this slice started. */
+    uint32_t slice_start_tick = HAL_GetTick();
+    /** <b>Local variable units_of_work_done:</b> @ref uint32_t Type variable used to hold the number of units of work made during this slice. */
+    uint32_t units_of_work_done = 0;
+    /** <b>Local variable is_erase_in_progress:</b> @ref uint8_t Type variable used to hold whether the Sector Erase started by a previous slice is still in progress (i.e., 1) or not (i.e., 0). */
+    uint8_t is_erase_in_progress;
+    /** <b>Local variable is_erase_started:</b> @ref uint8_t Type variable used to hold whether this slice started a Sector Erase (i.e., 1) or found another one still in progress (i.e., 0). */
+    uint8_t is_erase_started;
+    /** <b>Local variable newer_run:</b> @ref uint8_t Type variable used to hold the index in @ref runs of the newer of the two runs being merged. */
+    uint8_t newer_run;
+    /** <b>Local variable uncached_run:</b> @ref uint8_t Type variable used to hold the index in @ref runs of a run whose Bloom filter is to be cached. */
+    uint8_t uncached_run;
+    /** <b>Local variable pages:</b> @ref uint32_t Type variable used to hold the number of Pages to be written by the current state of the merge. */
+    uint32_t pages;
+    /** <b>Local variable count:</b> @ref uint32_t Type variable used to hold the number of sparse index keys or of Bloom filter bytes of the Page being written. */
+    uint32_t count;
+    /** <b>Local variable entries:</b> @ref uint32_t Type variable used to hold the number of key/value pairs of the data Page read to build a Bloom filter Page. */
+    uint32_t entries;
+
+    *is_compacted = 0;
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    while (1)
+    {
+        /* Conclude the Sector Erase that a previous slice started, if any. */
+        if (is_merge_erase_in_progress)
+        {
+            ret = w25q128fv_poll_background_erase(&is_erase_in_progress);
+            if ((ret!=W25Q128FV_EC_OK) || (is_erase_in_progress==1))
+            {
+                break;
+            }
+            is_merge_erase_in_progress = 0;
+            merge_cursor++;
+        }
+
+        if (merge_state == W25Q128FV_LSM_MERGE_STATE_IDLE)
+        {
+            /* Cache the Bloom filter of a run that did not fit into the pool before, since merges release some of it. */
+            uncached_run = find_uncached_bloom();
+            if (uncached_run < run_count)
+            {
+                if ((units_of_work_done>0) && (((HAL_GetTick()-slice_start_tick)+W25Q128FV_LSM_MERGE_UNIT_MAX_TIME_IN_MS) > bus_time_budget_in_ms))
+                {
+                    break;
+                }
+                ret = cache_bloom(&runs[uncached_run]);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    break;
+                }
+                units_of_work_done++;
+                continue;
+            }
+
+            /* Choose the next runs to be merged. */
+            if (select_merge() == 0)
+            {
+                *is_compacted = 1;
+                break;
+            }
+        }
+        newer_run = find_run(merge_newer_sequence);
+        if ((newer_run+1) >= run_count)
+        {
+            mark_sectors(merge_run.first_sector, merge_run.total_sectors, 0);
+            if (merge_run.is_bloom_cached == 1)
+            {
+                release_bloom(merge_run.bloom_offset, merge_run.bloom_size_in_bytes);
+            }
+            merge_state = W25Q128FV_LSM_MERGE_STATE_IDLE;
+            continue;
+        }
+
+        /* Stop if another unit of work would not fit into the bus-time budget of this slice. */
+        if ((units_of_work_done>0) && (((HAL_GetTick()-slice_start_tick)+W25Q128FV_LSM_MERGE_UNIT_MAX_TIME_IN_MS) > bus_time_budget_in_ms))
+        {
+            break;
+        }
+
+        if (merge_state == W25Q128FV_LSM_MERGE_STATE_ERASING)
+        {
+            if (merge_cursor == merge_run.total_sectors)
+            {
+                merge_state = W25Q128FV_LSM_MERGE_STATE_MERGING;
+                continue;
+            }
+            ret = w25q128fv_try_start_erase_sector(lsm.first_sector + merge_run.first_sector + merge_cursor, &is_erase_started);
+            is_merge_erase_in_progress = is_erase_started;
+            break;
+        }
+        else if (merge_state == W25Q128FV_LSM_MERGE_STATE_MERGING)
+        {
+            ret = merge_next_page(newer_run);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+        }
+        else if (merge_state == W25Q128FV_LSM_MERGE_STATE_WRITING_INDEX)
+        {
+            pages = (merge_data_pages + W25Q128FV_LSM_KEYS_PER_INDEX_PAGE-1) / W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+            if (merge_cursor == pages)
+            {
+                merge_state = W25Q128FV_LSM_MERGE_STATE_WRITING_BLOOM;
+                merge_cursor = 0;
+                continue;
+            }
+            count = merge_data_pages - merge_cursor*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+            count = (count > W25Q128FV_LSM_KEYS_PER_INDEX_PAGE) ? W25Q128FV_LSM_KEYS_PER_INDEX_PAGE : count;
+            ret = w25q128fv_write_flash_memory(get_run_device_page(merge_run.first_sector, 1+merge_data_pages+merge_cursor), 0, count*sizeof(uint32_t), (uint8_t *) &merge_index_keys[merge_cursor*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE]);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+            merge_run.index_page_keys[merge_cursor] = merge_index_keys[merge_cursor*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE];
+            merge_cursor++;
+        }
+        else if (merge_state == W25Q128FV_LSM_MERGE_STATE_WRITING_BLOOM)
+        {
+            pages = (merge_run.bloom_size_in_bytes + W25Q128FV_PAGE_SIZE_IN_BYTES-1) / W25Q128FV_PAGE_SIZE_IN_BYTES;
+            if (merge_cursor == pages)
+            {
+                merge_state = W25Q128FV_LSM_MERGE_STATE_WRITING_HEADER;
+                continue;
+            }
+            count = merge_run.bloom_size_in_bytes - merge_cursor*W25Q128FV_PAGE_SIZE_IN_BYTES;
+            count = (count > W25Q128FV_PAGE_SIZE_IN_BYTES) ? W25Q128FV_PAGE_SIZE_IN_BYTES : count;
+            if (merge_run.is_bloom_cached == 0)
+            {
+                /* Since every key falls into a single block, the Bloom filter that did not fit into the pool is built one
+                   Page at a time into the output buffer, which is idle by now, from one written data Page per unit of work. */
+                if (merge_bloom_data_page == 0)
+                {
+                    memset(merge_output_buffer, 0, sizeof(merge_output_buffer));
+                }
+                if (merge_bloom_data_page < merge_data_pages)
+                {
+                    entries = merge_run.total_entries - merge_bloom_data_page*W25Q128FV_LSM_ENTRIES_PER_PAGE;
+                    entries = (entries > W25Q128FV_LSM_ENTRIES_PER_PAGE) ? W25Q128FV_LSM_ENTRIES_PER_PAGE : entries;
+                    ret = w25q128fv_fast_read_flash_memory(get_run_device_page(merge_run.first_sector, 1+merge_bloom_data_page), 0, entries*sizeof(W25Q128FV_lsm_entry_t), (uint8_t *) merge_input_buffers[0]);
+                    if (ret != W25Q128FV_EC_OK)
+                    {
+                        break;
+                    }
+                    for (uint32_t i=0; i<entries; i++)
+                    {
+                        w25q128fv_bloom_add_to_window((uint8_t *) merge_output_buffer, merge_cursor*W25Q128FV_PAGE_SIZE_IN_BYTES, count, merge_run.bloom_size_in_bytes, merge_run.bloom_hashes, merge_input_buffers[0][i].key);
+                    }
+                    merge_bloom_data_page++;
+                    if (merge_bloom_data_page < merge_data_pages)
+                    {
+                        units_of_work_done++;
+                        continue;
+                    }
+                }
+            }
+            pages = (merge_data_pages + W25Q128FV_LSM_KEYS_PER_INDEX_PAGE-1) / W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+            ret = w25q128fv_write_flash_memory(get_run_device_page(merge_run.first_sector, 1+merge_data_pages+pages+merge_cursor), 0, count,
+                                               (merge_run.is_bloom_cached == 1) ? &bloom_pool[merge_run.bloom_offset + merge_cursor*W25Q128FV_PAGE_SIZE_IN_BYTES] : (uint8_t *) merge_output_buffer);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+            merge_bloom_data_page = 0;
+            merge_cursor++;
+        }
+        else
+        {
+            /* Commit the merged run by writing its header, which covers the sequence numbers of both of its inputs. */
+            pages = get_run_total_pages(merge_run.total_entries, merge_run.bloom_size_in_bytes);
+            mark_sectors(merge_run.first_sector, merge_run.total_sectors, 0);
+            merge_run.total_sectors = (pages + W25Q128FV_SECTOR_SIZE_IN_PAGES-1) / W25Q128FV_SECTOR_SIZE_IN_PAGES;
+            mark_sectors(merge_run.first_sector, merge_run.total_sectors, 1);
+            ret = write_run_header(&merge_run);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+            ret = commit_merge(newer_run);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                break;
+            }
+        }
+        units_of_work_done++;
+    }
+
+    return ret;
+}
+
+static W25Q128FV_Status recover_run(uint32_t sector_number, uint8_t *header_data)
+{
+    /** <b>Local variable header:</b> @ref W25Q128FV_lsm_run_header_t Pointer type variable used to point to the header of the sorted run. */
+    W25Q128FV_lsm_run_header_t *header = (W25Q128FV_lsm_run_header_t *) header_data;
+    /** <b>Local variable sector:</b> @ref uint32_t Type variable used to hold the Sector of the header, relative to the managed region. */
+    uint32_t sector = sector_number - lsm.first_sector;
+    /** <b>Local variable run:</b> @ref W25Q128FV_lsm_run_t Type variable used to hold the RAM state of the sorted run being recovered. */
+    W25Q128FV_lsm_run_t run;
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable is_obsolete:</b> @ref uint8_t Type variable used to hold whether the sorted run being recovered is covered by another one (i.e., 1) or not (i.e., 0). */
+    uint8_t is_obsolete;
+    /** <b>Local variable i:</b> @ref uint8_t Type variable used to iterate over the sorted runs. */
+    uint8_t i;
+
+    if ((header->crc32 != w25q128fv_crc32_update(0, (uint8_t *) &header->sequence, sizeof(W25Q128FV_lsm_run_header_t)-offsetof(W25Q128FV_lsm_run_header_t, sequence)))
+        || (header->total_entries > W25Q128FV_LSM_MAX_RUN_ENTRIES) || ((sector+header->total_sectors) > lsm.total_sectors)
+        || ((header->total_sectors*W25Q128FV_SECTOR_SIZE_IN_PAGES) < get_run_total_pages(header->total_entries, header->bloom_size_in_bytes)))
+    {
+        return W25Q128FV_EC_OK;
+    }
+    memset(&run, 0, sizeof(run));
+    run.first_sector = sector;
+    run.total_sectors = header->total_sectors;
+    run.sequence = header->sequence;
+    run.first_sequence = header->first_sequence;
+    run.total_entries = header->total_entries;
+    run.min_key = header->min_key;
+    run.max_key = header->max_key;
+    run.bloom_size_in_bytes = header->bloom_size_in_bytes;
+    run.bloom_hashes = header->bloom_hashes;
+    is_obsolete = 0;
+    i = 0;
+    while (i < run_count)
+    {
+        if ((runs[i].first_sequence<=run.first_sequence) && (run.sequence<=runs[i].sequence))
+        {
+            is_obsolete = 1;
+            break;
+        }
+        if ((run.first_sequence<=runs[i].first_sequence) && (runs[i].sequence<=run.sequence))
+        {
+            ret = invalidate_run_header(runs[i].first_sector);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            run_count--;
+            memmove(&runs[i], &runs[i+1], (run_count-i) * sizeof(W25Q128FV_lsm_run_t));
+            continue;
+        }
+        i++;
+    }
+    if (is_obsolete == 1)
+    {
+        return invalidate_run_header(run.first_sector);
+    }
+    // NOTE: The limit of W25Q128FV_LSM_MAX_RUNS runs is only enforced by w25q128fv_lsm_mount() once the scan is over, since a stale run may be found before the merged run that covers it.
+    if (run_count == (W25Q128FV_LSM_MAX_RUNS+1))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Keep the runs sorted from the newest to the oldest. */
+    for (i=run_count; (i>0) && (runs[i-1].sequence<run.sequence); i--)
+    {
+        runs[i] = runs[i-1];
+    }
+    runs[i] = run;
+    run_count++;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status invalidate_run_header(uint16_t first_sector)
+{
+    /** <b>Local variable magic:</b> @ref uint32_t Type variable used to hold the cleared magic to be written over the one of the header. */
+    uint32_t magic = 0;
+
+    return w25q128fv_write_flash_memory(get_run_device_page(first_sector, 0), 0, sizeof(magic), (uint8_t *) &magic);
+}
+
+static uint32_t get_run_total_pages(uint32_t total_entries, uint16_t bloom_size_in_bytes)
+{
+    /** <b>Local variable data_pages:</b> @ref uint32_t Type variable used to hold the number of data Pages of the run. */
+    uint32_t data_pages = (total_entries + W25Q128FV_LSM_ENTRIES_PER_PAGE-1) / W25Q128FV_LSM_ENTRIES_PER_PAGE;
+
+    return 1 + data_pages + (data_pages + W25Q128FV_LSM_KEYS_PER_INDEX_PAGE-1)/W25Q128FV_LSM_KEYS_PER_INDEX_PAGE + (bloom_size_in_bytes + W25Q128FV_PAGE_SIZE_IN_BYTES-1)/W25Q128FV_PAGE_SIZE_IN_BYTES;
+}
+
+static uint32_t get_run_device_page(uint16_t first_sector, uint32_t page)
+{
+    return (lsm.first_sector+first_sector)*W25Q128FV_SECTOR_SIZE_IN_PAGES + page;
+}
+
+static uint8_t reserve_sectors(uint32_t total_sectors, uint16_t *first_sector)
+{
+    /** <b>Local variable free_run:</b> @ref uint32_t Type variable used to hold the number of consecutive free Sectors found so far. */
+    uint32_t free_run = 0;
+
+    for (uint32_t sector=0; sector<lsm.total_sectors; sector++)
+    {
+        if (sector_bitmap[sector/8] & (1<<(sector%8)))
+        {
+            free_run = 0;
+            continue;
+        }
+        free_run++;
+        if (free_run == total_sectors)
+        {
+            *first_sector = sector + 1 - total_sectors;
+            mark_sectors(*first_sector, total_sectors, 1);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void mark_sectors(uint16_t first_sector, uint32_t total_sectors, uint8_t is_used)
+{
+    for (uint32_t sector=first_sector; sector<(first_sector+total_sectors); sector++)
+    {
+        if (is_used == 1)
+        {
+            sector_bitmap[sector/8] |= (1<<(sector%8));
+        }
+        else
+        {
+            sector_bitmap[sector/8] &= ~(1<<(sector%8));
+        }
+    }
+}
+
+static uint8_t reserve_bloom(uint16_t size, uint16_t *offset)
+{
+    if ((size==0) || ((bloom_pool_used+size) > W25Q128FV_LSM_BLOOM_POOL_SIZE_IN_BYTES))
+    {
+        return 0;
+    }
+    *offset = bloom_pool_used;
+    bloom_pool_used += size;
+
+    return 1;
+}
+
+static void release_bloom(uint16_t offset, uint16_t size)
+{
+    memmove(&bloom_pool[offset], &bloom_pool[offset+size], bloom_pool_used - (offset+size));
+    bloom_pool_used -= size;
+    for (uint8_t i=0; i<run_count; i++)
+    {
+        if ((runs[i].is_bloom_cached==1) && (runs[i].bloom_offset>offset))
+        {
+            runs[i].bloom_offset -= size;
+        }
+    }
+    if ((merge_state!=W25Q128FV_LSM_MERGE_STATE_IDLE) && (merge_run.is_bloom_cached==1) && (merge_run.bloom_offset>offset))
+    {
+        merge_run.bloom_offset -= size;
+    }
+}
+
+static W25Q128FV_Status write_run_header(W25Q128FV_lsm_run_t *run)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable header:</b> @ref W25Q128FV_lsm_run_header_t Type variable used to hold the header to be written. */
+    W25Q128FV_lsm_run_header_t header;
+
+    header.magic = W25Q128FV_LSM_RUN_MAGIC;
+    header.sequence = run->sequence;
+    header.first_sequence = run->first_sequence;
+    header.total_entries = run->total_entries;
+    header.min_key = run->min_key;
+    header.max_key = run->max_key;
+    header.total_sectors = run->total_sectors;
+    header.bloom_size_in_bytes = run->bloom_size_in_bytes;
+    header.bloom_hashes = run->bloom_hashes;
+    memset(header.reserved, 0, sizeof(header.reserved));
+    header.crc32 = w25q128fv_crc32_update(0, (uint8_t *) &header.sequence, sizeof(header)-offsetof(W25Q128FV_lsm_run_header_t, sequence));
+
+    /* Write the magic only after the rest of the header so that a power loss never leaves a valid looking incomplete run. */
+    ret = w25q128fv_write_flash_memory(get_run_device_page(run->first_sector, 0), sizeof(header.magic), sizeof(header)-sizeof(header.magic), ((uint8_t *) &header) + sizeof(header.magic));
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+
+    return w25q128fv_write_flash_memory(get_run_device_page(run->first_sector, 0), 0, sizeof(header.magic), (uint8_t *) &header.magic);
+}
+
+static W25Q128FV_Status search_run(W25Q128FV_lsm_run_t *run, uint32_t key, uint32_t *value, uint8_t *is_found)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable data_pages:</b> @ref uint32_t Type variable used to hold the number of data Pages of the run. */
+    uint32_t data_pages = (run->total_entries + W25Q128FV_LSM_ENTRIES_PER_PAGE-1) / W25Q128FV_LSM_ENTRIES_PER_PAGE;
+    /** <b>Local variable index_page:</b> @ref uint32_t Type variable used to hold the sparse index Page that covers the key. */
+    uint32_t index_page = 0;
+    /** <b>Local variable data_page:</b> @ref uint32_t Type variable used to hold the data Page that covers the key. */
+    uint32_t data_page;
+    /** <b>Local variable count:</b> @ref uint32_t Type variable used to hold the number of keys of the Page that is searched. */
+    uint32_t count;
+    /** <b>Local variable low:</b> @ref uint32_t Type variable used to hold the lower bound of a binary search. */
+    uint32_t low;
+    /** <b>Local variable high:</b> @ref uint32_t Type variable used to hold the upper bound of a binary search. */
+    uint32_t high;
+    /** <b>Local variable middle:</b> @ref uint32_t Type variable used to hold the middle point of a binary search. */
+    uint32_t middle;
+    /** <b>Local variable entries:</b> @ref W25Q128FV_lsm_entry_t Pointer type variable used to point to the key/value pairs of the data Page held by the @ref lookup_buffer . */
+    W25Q128FV_lsm_entry_t *entries = (W25Q128FV_lsm_entry_t *) lookup_buffer;
+
+    /* Skip the run without accessing the SPI bus if the key is out of its range or if its Bloom filter rules the key out. */
+    *is_found = 0;
+    if ((run->total_entries==0) || (key<run->min_key) || (key>run->max_key))
+    {
+        return W25Q128FV_EC_OK;
+    }
+    if ((run->is_bloom_cached==1) && (w25q128fv_bloom_may_contain(&bloom_pool[run->bloom_offset], run->bloom_size_in_bytes, run->bloom_hashes, key)==0))
+    {
+        return W25Q128FV_EC_OK;
+    }
+
+    /* Find the sparse index Page that covers the key from the RAM copy of their first keys. */
+    while (((index_page+1)*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE < data_pages) && (run->index_page_keys[index_page+1] <= key))
+    {
+        index_page++;
+    }
+
+    /* Read that sparse index Page and find the data Page that covers the key. */
+    count = data_pages - index_page*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+    count = (count > W25Q128FV_LSM_KEYS_PER_INDEX_PAGE) ? W25Q128FV_LSM_KEYS_PER_INDEX_PAGE : count;
+    ret = w25q128fv_fast_read_flash_memory(get_run_device_page(run->first_sector, 1+data_pages+index_page), 0, count*sizeof(uint32_t), (uint8_t *) lookup_buffer);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    low = 0;
+    high = count;
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (lookup_buffer[middle] <= key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    data_page = index_page*W25Q128FV_LSM_KEYS_PER_INDEX_PAGE + low - 1;
+
+    /* Read that data Page and search it for the key. */
+    count = run->total_entries - data_page*W25Q128FV_LSM_ENTRIES_PER_PAGE;
+    count = (count > W25Q128FV_LSM_ENTRIES_PER_PAGE) ? W25Q128FV_LSM_ENTRIES_PER_PAGE : count;
+    ret = w25q128fv_fast_read_flash_memory(get_run_device_page(run->first_sector, 1+data_page), 0, count*sizeof(W25Q128FV_lsm_entry_t), (uint8_t *) entries);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    low = 0;
+    high = count;
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (entries[middle].key < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if ((low<count) && (entries[low].key==key))
+    {
+        *value = entries[low].value;
+        *is_found = 1;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint8_t find_uncached_bloom(void)
+{
+    /** <b>Local variable i:</b> @ref uint8_t Type variable used to iterate over the sorted runs. */
+    uint8_t i;
+
+    for (i=0; i<run_count; i++)
+    {
+        if ((runs[i].is_bloom_cached==0) && (runs[i].bloom_size_in_bytes>0) && ((bloom_pool_used+runs[i].bloom_size_in_bytes) <= W25Q128FV_LSM_BLOOM_POOL_SIZE_IN_BYTES))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+static W25Q128FV_Status cache_bloom(W25Q128FV_lsm_run_t *run)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable data_pages:</b> @ref uint32_t Type variable used to hold the number of data Pages of the run. */
+    uint32_t data_pages = (run->total_entries + W25Q128FV_LSM_ENTRIES_PER_PAGE-1) / W25Q128FV_LSM_ENTRIES_PER_PAGE;
+    /** <b>Local variable index_pages:</b> @ref uint32_t Type variable used to hold the number of sparse index Pages of the run. */
+    uint32_t index_pages = (data_pages + W25Q128FV_LSM_KEYS_PER_INDEX_PAGE-1) / W25Q128FV_LSM_KEYS_PER_INDEX_PAGE;
+
+    if ((run->bloom_size_in_bytes==0) || (reserve_bloom(run->bloom_size_in_bytes, &run->bloom_offset)==0))
+    {
+        return W25Q128FV_EC_OK;
+    }
+    ret = w25q128fv_fast_read_flash_memory(get_run_device_page(run->first_sector, 1+data_pages+index_pages), 0, run->bloom_size_in_bytes, &bloom_pool[run->bloom_offset]);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        release_bloom(run->bloom_offset, run->bloom_size_in_bytes);
+        return ret;
+    }
+    run->is_bloom_cached = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint8_t find_run(uint32_t sequence)
+{
+    /** <b>Local variable i:</b> @ref uint8_t Type variable used to iterate over the sorted runs. */
+    uint8_t i;
+
+    for (i=0; (i<run_count) && (runs[i].sequence!=sequence); i++);
+
+    return i;
+}
+
+static W25Q128FV_Status insert_into_memtable(uint32_t key, uint32_t value)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable low:</b> @ref uint16_t Type variable used to hold the lower bound of the binary search. */
+    uint16_t low = 0;
+    /** <b>Local variable high:</b> @ref uint16_t Type variable used to hold the upper bound of the binary search. */
+    uint16_t high = memtable_count;
+    /** <b>Local variable middle:</b> @ref uint16_t Type variable used to hold the middle point of the binary search. */
+    uint16_t middle;
+
+    while (low < high)
+    {
+        middle = (low+high) / 2;
+        if (memtable[middle].key < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if ((low<memtable_count) && (memtable[low].key==key))
+    {
+        memtable[low].value = value;
+        return W25Q128FV_EC_OK;
+    }
+    if (memtable_count == W25Q128FV_LSM_MEMTABLE_ENTRIES)
+    {
+        ret = w25q128fv_lsm_flush();
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        low = 0;
+    }
+    memmove(&memtable[low+1], &memtable[low], (memtable_count-low) * sizeof(W25Q128FV_lsm_entry_t));
+    memtable[low].key = key;
+    memtable[low].value = value;
+    memtable_count++;
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint8_t select_merge(void)
+{
+    /** <b>Local variable best_run:</b> @ref uint8_t Type variable used to hold the index of the newer run of the best pair of adjacent runs found so far. */
+    uint8_t best_run = W25Q128FV_LSM_MAX_RUNS;
+    /** <b>Local variable best_entries:</b> @ref uint32_t Type variable used to hold the total entries of the best pair of adjacent runs found so far. */
+    uint32_t best_entries = 0;
+    /** <b>Local variable total_entries:</b> @ref uint32_t Type variable used to hold the total entries of a pair of adjacent runs. */
+    uint32_t total_entries;
+
+    if (run_count <= W25Q128FV_LSM_MERGE_TRIGGER_RUNS)
+    {
+        return 0;
+    }
+    for (uint8_t i=0; (i+1)<run_count; i++)
+    {
+        total_entries = runs[i].total_entries + runs[i+1].total_entries;
+        if ((total_entries<=W25Q128FV_LSM_MAX_RUN_ENTRIES) && ((best_run==W25Q128FV_LSM_MAX_RUNS) || (total_entries<best_entries)))
+        {
+            best_run = i;
+            best_entries = total_entries;
+        }
+    }
+    if (best_run == W25Q128FV_LSM_MAX_RUNS)
+    {
+        return 0;
+    }
+
+    /* Reserve the Sectors and the Bloom filter of the merged run for the worst case, in which no key is repeated. */
+    memset(&merge_run, 0, sizeof(merge_run));
+    merge_run.bloom_size_in_bytes = w25q128fv_bloom_get_size(best_entries, W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM);
+    merge_run.bloom_hashes = w25q128fv_bloom_get_total_hashes(W25Q128FV_LSM_BLOOM_FALSE_POSITIVE_PPM);
+    merge_run.is_bloom_cached = reserve_bloom(merge_run.bloom_size_in_bytes, &merge_run.bloom_offset); // NOTE: Otherwise, the Bloom filter is built on flash after the sparse index.
+    merge_run.total_sectors = (get_run_total_pages(best_entries, merge_run.bloom_size_in_bytes) + W25Q128FV_SECTOR_SIZE_IN_PAGES-1) / W25Q128FV_SECTOR_SIZE_IN_PAGES;
+    if (reserve_sectors(merge_run.total_sectors, &merge_run.first_sector) == 0)
+    {
+        if (merge_run.is_bloom_cached == 1)
+        {
+            release_bloom(merge_run.bloom_offset, merge_run.bloom_size_in_bytes);
+        }
+        return 0;
+    }
+    if (merge_run.is_bloom_cached == 1)
+    {
+        memset(&bloom_pool[merge_run.bloom_offset], 0, merge_run.bloom_size_in_bytes);
+    }
+    merge_run.sequence = runs[best_run].sequence;
+    merge_run.first_sequence = runs[best_run+1].first_sequence;
+    merge_run.min_key = 0xFFFFFFFF;
+    merge_run.max_key = 0;
+    merge_newer_sequence = runs[best_run].sequence;
+    merge_drop_tombstones = ((best_run+2) == run_count);
+    merge_positions[0] = 0;
+    merge_positions[1] = 0;
+    merge_loaded_pages[0] = W25Q128FV_LSM_NO_PAGE;
+    merge_loaded_pages[1] = W25Q128FV_LSM_NO_PAGE;
+    merge_output_count = 0;
+    merge_data_pages = 0;
+    merge_bloom_data_page = 0;
+    merge_cursor = 0;
+    merge_state = W25Q128FV_LSM_MERGE_STATE_ERASING;
+
+    return 1;
+}
+
+static W25Q128FV_Status merge_next_page(uint8_t newer_run)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable run:</b> @ref W25Q128FV_lsm_run_t Pointer type variable used to point to the RAM state of an input run. */
+    W25Q128FV_lsm_run_t *run;
+    /** <b>Local variable candidates:</b> @ref W25Q128FV_lsm_entry_t Pointer type array variable used to point to the next key/value pair of each input run or to NULL if it has none left. */
+    W25Q128FV_lsm_entry_t *candidates[2];
+    /** <b>Local variable entry:</b> @ref W25Q128FV_lsm_entry_t Type variable used to hold the key/value pair taken into the merged run. */
+    W25Q128FV_lsm_entry_t entry;
+    /** <b>Local variable page:</b> @ref uint32_t Type variable used to hold the data Page of an input run that holds its next key/value pair. */
+    uint32_t page;
+    /** <b>Local variable count:</b> @ref uint32_t Type variable used to hold the number of key/value pairs of a data Page. */
+    uint32_t count;
+    /** <b>Local variable pages_loaded:</b> @ref uint8_t Type variable used to hold the number of data Pages of the input runs loaded in this unit of work. */
+    uint8_t pages_loaded = 0;
+    /** <b>Local variable is_exhausted:</b> @ref uint8_t Type variable used to hold whether both input runs have no key/value pairs left (i.e., 1) or not (i.e., 0). */
+    uint8_t is_exhausted = 0;
+    /** <b>Local variable taken:</b> @ref uint8_t Type variable used to hold which input run (i.e., 0 for the newer and 1 for the older) gives the next key/value pair. */
+    uint8_t taken;
+
+    while (merge_output_count < W25Q128FV_LSM_ENTRIES_PER_PAGE)
+    {
+        /* Get the next key/value pair of each input run, stopping once a third data Page would have to be loaded. */
+        for (uint8_t input=0; input<2; input++)
+        {
+            run = &runs[newer_run + input];
+            candidates[input] = NULL;
+            if (merge_positions[input] >= run->total_entries)
+            {
+                continue;
+            }
+            page = merge_positions[input] / W25Q128FV_LSM_ENTRIES_PER_PAGE;
+            if (merge_loaded_pages[input] != page)
+            {
+                if (pages_loaded == 2)
+                {
+                    break;
+                }
+                count = run->total_entries - page*W25Q128FV_LSM_ENTRIES_PER_PAGE;
+                count = (count > W25Q128FV_LSM_ENTRIES_PER_PAGE) ? W25Q128FV_LSM_ENTRIES_PER_PAGE : count;
+                ret = w25q128fv_fast_read_flash_memory(get_run_device_page(run->first_sector, 1+page), 0, count*sizeof(W25Q128FV_lsm_entry_t), (uint8_t *) merge_input_buffers[input]);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    return ret;
+                }
+                merge_loaded_pages[input] = page;
+                pages_loaded++;
+            }
+            candidates[input] = &merge_input_buffers[input][merge_positions[input] % W25Q128FV_LSM_ENTRIES_PER_PAGE];
+        }
+        if ((pages_loaded==2) && (((merge_positions[0]<runs[newer_run].total_entries) && (merge_loaded_pages[0]!=merge_positions[0]/W25Q128FV_LSM_ENTRIES_PER_PAGE))
+            || ((merge_positions[1]<runs[newer_run+1].total_entries) && (merge_loaded_pages[1]!=merge_positions[1]/W25Q128FV_LSM_ENTRIES_PER_PAGE))))
+        {
+            break;
+        }
+        if ((candidates[0]==NULL) && (candidates[1]==NULL))
+        {
+            is_exhausted = 1;
+            break;
+        }
+
+        /* Take the smallest key, where the newer run wins if both runs have it. */
+        if ((candidates[0]!=NULL) && (candidates[1]!=NULL) && (candidates[0]->key==candidates[1]->key))
+        {
+            taken = 0;
+            merge_positions[1]++;
+        }
+        else if ((candidates[1]==NULL) || ((candidates[0]!=NULL) && (candidates[0]->key<candidates[1]->key)))
+        {
+            taken = 0;
+        }
+        else
+        {
+            taken = 1;
+        }
+        entry = *candidates[taken];
+        merge_positions[taken]++;
+        if ((merge_drop_tombstones==1) && (entry.value==W25Q128FV_LSM_TOMBSTONE))
+        {
+            continue;
+        }
+        merge_output_buffer[merge_output_count++] = entry;
+        merge_run.min_key = (entry.key < merge_run.min_key) ? entry.key : merge_run.min_key;
+        merge_run.max_key = (entry.key > merge_run.max_key) ? entry.key : merge_run.max_key;
+        if (merge_run.is_bloom_cached == 1)
+        {
+            w25q128fv_bloom_add(&bloom_pool[merge_run.bloom_offset], merge_run.bloom_size_in_bytes, merge_run.bloom_hashes, entry.key);
+        }
+    }
+
+    /* Write the data Page of the merged run once it is full or once both input runs are exhausted. */
+    if ((merge_output_count==W25Q128FV_LSM_ENTRIES_PER_PAGE) || ((is_exhausted==1) && (merge_output_count>0)))
+    {
+        ret = w25q128fv_write_flash_memory(get_run_device_page(merge_run.first_sector, 1+merge_data_pages), 0, merge_output_count*sizeof(W25Q128FV_lsm_entry_t), (uint8_t *) merge_output_buffer);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        merge_index_keys[merge_data_pages] = merge_output_buffer[0].key;
+        merge_data_pages++;
+        merge_run.total_entries += merge_output_count;
+        merge_output_count = 0;
+    }
+    if (is_exhausted == 1)
+    {
+        merge_state = W25Q128FV_LSM_MERGE_STATE_WRITING_INDEX;
+        merge_cursor = 0;
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status commit_merge(uint8_t newer_run)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret = W25Q128FV_EC_OK;
+
+    /* Invalidate the headers of both input runs before their Sectors can be reused, and release their Sectors and Bloom filters, which also moves the Bloom filter of the merged run. */
+    for (uint8_t input=0; input<2; input++)
+    {
+        if (ret == W25Q128FV_EC_OK)
+        {
+            ret = invalidate_run_header(runs[newer_run+input].first_sector);
+        }
+        mark_sectors(runs[newer_run+input].first_sector, runs[newer_run+input].total_sectors, 0);
+        if (runs[newer_run+input].is_bloom_cached == 1)
+        {
+            runs[newer_run+input].is_bloom_cached = 0;
+            release_bloom(runs[newer_run+input].bloom_offset, runs[newer_run+input].bloom_size_in_bytes);
+        }
+    }
+    mark_sectors(merge_run.first_sector, merge_run.total_sectors, 1);
+
+    /* Replace both input runs with the merged one. */
+    runs[newer_run] = merge_run;
+    run_count--;
+    memmove(&runs[newer_run+1], &runs[newer_run+2], (run_count-newer_run-1) * sizeof(W25Q128FV_lsm_run_t));
+    merge_state = W25Q128FV_LSM_MERGE_STATE_IDLE;
+
+    return ret;
+}
+
+/** @} */
@@ -0,0 +1,71 @@
+#include "w25q128fv_mempool.h"
+#include <stddef.h> // Library from which "NULL" is located at.
+
+/**@brief	Free block of the pool, whose first bytes link it to the next free block.
+ */
+typedef struct W25Q128FV_mempool_free_block {
+    struct W25Q128FV_mempool_free_block *next;  //!< Next free block, or \c NULL if this is the last one.
+} W25Q128FV_mempool_free_block_t;
+
+static uint8_t arena[W25Q128FV_MEMPOOL_TOTAL_BLOCKS][W25Q128FV_MEMPOOL_BLOCK_SIZE_IN_BYTES] __attribute__ ((aligned (W25Q128FV_MEMPOOL_ALIGNMENT_IN_BYTES)));   /**< @brief Blocks of the pool. */
+static W25Q128FV_mempool_free_block_t *free_list = NULL;    /**< @brief First block of the list of the blocks that were freed, or \c NULL if there is none. */
+static uint32_t total_untouched_blocks_used = 0;            /**< @brief Number of blocks of @ref arena , from its start, that have ever been allocated, so that the rest are free without being in @ref free_list . */
+static W25Q128FV_mempool_stats_t stats;                     /**< @brief Statistics of the @ref w25q128fv_mempool . */
+
+void *w25q128fv_mempool_alloc(void)
+{
+    /** <b>Local variable block:</b> @ref W25Q128FV_mempool_free_block_t Type pointer used to point to the block to be handed out. */
+    W25Q128FV_mempool_free_block_t *block = NULL;
+
+    W25Q128FV_MEMPOOL_ENTER_CRITICAL();
+    if (free_list != NULL)
+    {
+        block = free_list;
+        free_list = block->next;
+    }
+    else if (total_untouched_blocks_used < W25Q128FV_MEMPOOL_TOTAL_BLOCKS)
+    {
+        block = (W25Q128FV_mempool_free_block_t *) arena[total_untouched_blocks_used];
+        total_untouched_blocks_used++;
+    }
+
+    if (block == NULL)
+    {
+        stats.failed_allocations++;
+    }
+    else
+    {
+        stats.allocations++;
+        stats.used_blocks++;
+        if (stats.used_blocks > stats.high_water_blocks)
+        {
+            stats.high_water_blocks = stats.used_blocks;
+        }
+    }
+    W25Q128FV_MEMPOOL_EXIT_CRITICAL();
+
+    return block;
+}
+
+void w25q128fv_mempool_free(void *block)
+{
+    if (block == NULL)
+    {
+        return;
+    }
+
+    W25Q128FV_MEMPOOL_ENTER_CRITICAL();
+    ((W25Q128FV_mempool_free_block_t *) block)->next = free_list;
+    free_list = (W25Q128FV_mempool_free_block_t *) block;
+    stats.used_blocks--;
+    W25Q128FV_MEMPOOL_EXIT_CRITICAL();
+}
+
+void w25q128fv_mempool_get_stats(W25Q128FV_mempool_stats_t *mempool_stats)
+{
+    W25Q128FV_MEMPOOL_ENTER_CRITICAL();
+    *mempool_stats = stats;
+    W25Q128FV_MEMPOOL_EXIT_CRITICAL();
+}
+
+/** @} */
@@ -0,0 +1,78 @@
+#include "w25q128fv_ring.h"
+#include <stddef.h> // Library from which "NULL" is located at.
+
+void w25q128fv_ring_init(W25Q128FV_ring_t *ring)
+{
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+}
+
+W25Q128FV_Status w25q128fv_ring_push(W25Q128FV_ring_t *ring, const W25Q128FV_ring_request_t *request)
+{
+    /** <b>Local variable head:</b> @ref uint32_t Type variable used to hold the head index, which only this producer writes. */
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    // NOTE: The acquire pairs with the release of the consumer, so that its reads of a descriptor happen before it is overwritten here.
+    if ((head - atomic_load_explicit(&ring->tail, memory_order_acquire)) >= W25Q128FV_RING_SIZE)
+    {
+        return W25Q128FV_EC_NA;
+    }
+    ring->requests[head & (W25Q128FV_RING_SIZE-1)] = *request;
+
+    /* Publish the descriptor only after it has been completely written. */
+    atomic_store_explicit(&ring->head, head+1, memory_order_release);
+
+    return W25Q128FV_EC_OK;
+}
+
+uint32_t w25q128fv_ring_drain(W25Q128FV_ring_t *ring, uint32_t max_requests)
+{
+    /** <b>Local variable tail:</b> @ref uint32_t Type variable used to hold the tail index, which only this consumer writes. */
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    /** <b>Local variable total:</b> @ref uint32_t Type variable used to hold the number of requests to be executed in this batch. */
+    uint32_t total = atomic_load_explicit(&ring->head, memory_order_acquire) - tail;
+    /** <b>Local variable request:</b> @ref W25Q128FV_ring_request_t Type pointer used to point to the request being executed. */
+    W25Q128FV_ring_request_t *request;
+    /** <b>Local variable status:</b> @ref W25Q128FV_Status Type variable used to hold the status of the request being executed. */
+    W25Q128FV_Status status;
+
+    total = (total < max_requests) ? total : max_requests;
+    for (uint32_t i=0; i<total; i++)
+    {
+        request = &ring->requests[(tail+i) & (W25Q128FV_RING_SIZE-1)];
+        status = w25q128fv_ring_execute(request->type, request->number, request->page_bytes_offset, request->size, request->data);
+        if (request->done != NULL)
+        {
+            request->done(request, status);
+        }
+    }
+
+    /* Free all the descriptors of the batch at once, only after they have been completely read. */
+    if (total > 0)
+    {
+        atomic_store_explicit(&ring->tail, tail+total, memory_order_release);
+    }
+
+    return total;
+}
+
+W25Q128FV_Status w25q128fv_ring_execute(uint8_t type, uint32_t number, uint8_t page_bytes_offset, uint32_t size, uint8_t *data)
+{
+    switch (type)
+    {
+        case W25Q128FV_RING_REQUEST_READ:
+            return w25q128fv_read_flash_memory(number, page_bytes_offset, size, data);
+        case W25Q128FV_RING_REQUEST_FAST_READ:
+            return w25q128fv_fast_read_flash_memory(number, page_bytes_offset, size, data);
+        case W25Q128FV_RING_REQUEST_WRITE:
+            return w25q128fv_write_flash_memory(number, page_bytes_offset, size, data);
+        case W25Q128FV_RING_REQUEST_ERASE_SECTOR:
+            return w25q128fv_erase_sector(number);
+        case W25Q128FV_RING_REQUEST_ERASE_BLOCK_64KB:
+            return w25q128fv_erase_block_64kb(number);
+        default:
+            return W25Q128FV_EC_ERR;
+    }
+}
+
+/** @} */
@@ -0,0 +1,294 @@
+#include "w25q128fv_rtos.h"
+#include <stddef.h> // Library from which "NULL" is located at.
+
+static osMutexId_t w25q128fv_mutex = NULL;              /**< @brief Recursive mutex that guards the @ref w25q128fv . */
+static osSemaphoreId_t spi_dma_semaphore = NULL;        /**< @brief Binary semaphore that @ref w25q128fv_rtos_spi_dma_complete_from_isr gives at the end of each DMA transfer. */
+static osMessageQueueId_t request_queue = NULL;         /**< @brief Message queue of pointers to the requests for the worker task, or \c NULL if it is not enabled. */
+static osThreadId_t worker_thread = NULL;               /**< @brief Worker task, or \c NULL if it is not enabled. */
+static W25Q128FV_ring_t *rings[W25Q128FV_RTOS_MAX_RINGS];  /**< @brief Rings that the worker task drains. */
+static uint8_t total_rings = 0;                         /**< @brief Number of rings in @ref rings . */
+
+/**@brief   Blocks the calling task for at least a given number of milliseconds.
+ *
+ * @param delay_in_ms   Number of milliseconds to wait.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void rtos_delay(uint32_t delay_in_ms);
+
+/**@brief   Blocks the calling task until @ref w25q128fv_rtos_spi_dma_complete_from_isr is called.
+ *
+ * @param timeout_in_ms Maximum number of milliseconds to wait.
+ *
+ * @retval	W25Q128FV_EC_OK     if the DMA transfer completed.
+ * @retval  W25Q128FV_EC_NR     if the timeout passed.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status rtos_wait_for_dma(uint32_t timeout_in_ms);
+
+/**@brief   Executes a request while holding @ref w25q128fv_mutex .
+ *
+ * @param[in,out] request   Pointer to the Memory Location Address of the request, whose status will be set.
+ *
+ * @return  The status of the request.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status execute_request(W25Q128FV_rtos_request_t *request);
+
+/**@brief   Worker task, which sleeps until @ref W25Q128FV_RTOS_WAKE_FLAG is set and then executes the requests of
+ *          @ref rings and of @ref request_queue until there are none left.
+ *
+ * @param argument  Unused.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void worker_task(void *argument);
+
+/**@brief   Makes a request for a read or a write and waits for it to be executed.
+ *
+ * @param type              Type of the request.
+ * @param start_page        Flash Memory Page of the W25Q128FV Device from which the request starts.
+ * @param page_bytes_offset Offset in bytes inside that Flash Memory Page.
+ * @param size              Size in bytes of the request.
+ * @param data              Pointer to the Memory Location Address of the data of the request.
+ *
+ * @return  The value returned by @ref w25q128fv_rtos_submit .
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status submit_data_request(uint8_t type, uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *data);
+
+static const W25Q128FV_os_hooks_t rtos_os_hooks = {rtos_delay, rtos_wait_for_dma};   /**< @brief Hooks through which the @ref w25q128fv sleeps instead of busy-waiting. */
+
+W25Q128FV_Status init_w25q128fv_rtos_module(uint8_t is_worker_enabled)
+{
+    /** <b>Local variable mutex_attributes:</b> @ref osMutexAttr_t Type variable used to hold the attributes of @ref w25q128fv_mutex . */
+    const osMutexAttr_t mutex_attributes = {.name = "w25q128fv", .attr_bits = osMutexRecursive | osMutexPrioInherit};
+    /** <b>Local variable worker_attributes:</b> @ref osThreadAttr_t Type variable used to hold the attributes of the worker task. */
+    const osThreadAttr_t worker_attributes = {.name = "w25q128fv", .stack_size = W25Q128FV_RTOS_WORKER_STACK_SIZE_IN_BYTES, .priority = W25Q128FV_RTOS_WORKER_PRIORITY};
+
+    if (w25q128fv_mutex == NULL)
+    {
+        w25q128fv_mutex = osMutexNew(&mutex_attributes);
+    }
+    if (spi_dma_semaphore == NULL)
+    {
+        spi_dma_semaphore = osSemaphoreNew(1, 0, NULL);
+    }
+    if ((w25q128fv_mutex==NULL) || (spi_dma_semaphore==NULL))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    if (is_worker_enabled && (worker_thread==NULL))
+    {
+        if (request_queue == NULL)
+        {
+            request_queue = osMessageQueueNew(W25Q128FV_RTOS_QUEUE_LENGTH, sizeof(W25Q128FV_rtos_request_t *), NULL);
+            if (request_queue == NULL)
+            {
+                return W25Q128FV_EC_ERR;
+            }
+        }
+        worker_thread = osThreadNew(worker_task, NULL, &worker_attributes);
+        if (worker_thread == NULL)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+    w25q128fv_set_os_hooks(&rtos_os_hooks);
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_rtos_lock(void)
+{
+    return (osMutexAcquire(w25q128fv_mutex, osWaitForever) == osOK) ? W25Q128FV_EC_OK : W25Q128FV_EC_ERR;
+}
+
+W25Q128FV_Status w25q128fv_rtos_unlock(void)
+{
+    return (osMutexRelease(w25q128fv_mutex) == osOK) ? W25Q128FV_EC_OK : W25Q128FV_EC_ERR;
+}
+
+W25Q128FV_Status w25q128fv_rtos_submit(W25Q128FV_rtos_request_t *request)
+{
+    if (worker_thread == NULL)
+    {
+        if (request->callback != NULL)
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        return execute_request(request);
+    }
+
+    request->caller = (request->callback == NULL) ? osThreadGetId() : NULL;
+    if (osMessageQueuePut(request_queue, &request, 0, osWaitForever) != osOK)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    osThreadFlagsSet(worker_thread, W25Q128FV_RTOS_WAKE_FLAG);
+    if (request->callback != NULL)
+    {
+        return W25Q128FV_EC_OK;
+    }
+    osThreadFlagsWait(W25Q128FV_RTOS_DONE_FLAG, osFlagsWaitAny, osWaitForever);
+
+    return request->status;
+}
+
+W25Q128FV_Status w25q128fv_rtos_attach_ring(W25Q128FV_ring_t *ring)
+{
+    if (worker_thread == NULL)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (w25q128fv_rtos_lock() != W25Q128FV_EC_OK)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (total_rings >= W25Q128FV_RTOS_MAX_RINGS)
+    {
+        w25q128fv_rtos_unlock();
+        return W25Q128FV_EC_NA;
+    }
+
+    // NOTE: The worker task only reads the rings while holding the mutex, which orders it after these writes.
+    rings[total_rings] = ring;
+    total_rings++;
+    w25q128fv_rtos_unlock();
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_rtos_ring_push_from_isr(W25Q128FV_ring_t *ring, const W25Q128FV_ring_request_t *request)
+{
+    /** <b>Local variable status:</b> @ref W25Q128FV_Status Type variable used to hold the status of the push. */
+    W25Q128FV_Status status = w25q128fv_ring_push(ring, request);
+
+    if (status == W25Q128FV_EC_OK)
+    {
+        osThreadFlagsSet(worker_thread, W25Q128FV_RTOS_WAKE_FLAG);
+    }
+
+    return status;
+}
+
+W25Q128FV_Status w25q128fv_rtos_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst)
+{
+    return submit_data_request(W25Q128FV_RTOS_REQUEST_READ, start_page, page_bytes_offset, size, dst);
+}
+
+W25Q128FV_Status w25q128fv_rtos_fast_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst)
+{
+    return submit_data_request(W25Q128FV_RTOS_REQUEST_FAST_READ, start_page, page_bytes_offset, size, dst);
+}
+
+W25Q128FV_Status w25q128fv_rtos_write_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src)
+{
+    return submit_data_request(W25Q128FV_RTOS_REQUEST_WRITE, start_page, page_bytes_offset, size, src);
+}
+
+W25Q128FV_Status w25q128fv_rtos_erase_sector(uint32_t sector_number)
+{
+    return submit_data_request(W25Q128FV_RTOS_REQUEST_ERASE_SECTOR, sector_number, 0, 0, NULL);
+}
+
+void w25q128fv_rtos_spi_dma_complete_from_isr(void)
+{
+    osSemaphoreRelease(spi_dma_semaphore);
+}
+
+static void rtos_delay(uint32_t delay_in_ms)
+{
+    // NOTE: The delay is rounded up to whole RTOS ticks, plus one since the current tick is already partially elapsed.
+    osDelay((delay_in_ms*osKernelGetTickFreq() + 999) / 1000 + 1);
+}
+
+static W25Q128FV_Status rtos_wait_for_dma(uint32_t timeout_in_ms)
+{
+    return (osSemaphoreAcquire(spi_dma_semaphore, (timeout_in_ms*osKernelGetTickFreq() + 999) / 1000 + 1) == osOK) ? W25Q128FV_EC_OK : W25Q128FV_EC_NR;
+}
+
+static W25Q128FV_Status execute_request(W25Q128FV_rtos_request_t *request)
+{
+    if (w25q128fv_rtos_lock() != W25Q128FV_EC_OK)
+    {
+        request->status = W25Q128FV_EC_ERR;
+        return request->status;
+    }
+    request->status = w25q128fv_ring_execute(request->type, request->number, request->page_bytes_offset, request->size, request->data);
+    w25q128fv_rtos_unlock();
+
+    return request->status;
+}
+
+static void worker_task(void *argument)
+{
+    /** <b>Local variable request:</b> @ref W25Q128FV_rtos_request_t Type pointer used to point to the request being executed. */
+    W25Q128FV_rtos_request_t *request;
+    /** <b>Local variable total_executed:</b> @ref uint32_t Type variable used to hold the number of requests executed in the current pass. */
+    uint32_t total_executed;
+    /** <b>Local variable ring:</b> @ref W25Q128FV_ring_t Type pointer used to point to the ring being drained. */
+    W25Q128FV_ring_t *ring;
+
+    (void) argument;
+    for (;;)
+    {
+        osThreadFlagsWait(W25Q128FV_RTOS_WAKE_FLAG, osFlagsWaitAny, osWaitForever);
+
+        // NOTE: Each pass executes a batch of each ring and a single request of the queue, so that none of them starves the others.
+        do
+        {
+            total_executed = 0;
+            for (uint8_t n=0; n<W25Q128FV_RTOS_MAX_RINGS; n++)
+            {
+                if (w25q128fv_rtos_lock() != W25Q128FV_EC_OK)
+                {
+                    break;
+                }
+                // NOTE: The rings are read under the mutex, since @ref w25q128fv_rtos_attach_ring may attach one at any time.
+                ring = (n < total_rings) ? rings[n] : NULL;
+                if (ring != NULL)
+                {
+                    total_executed += w25q128fv_ring_drain(ring, W25Q128FV_RTOS_RING_BATCH_SIZE);
+                }
+                w25q128fv_rtos_unlock();
+                if (ring == NULL)
+                {
+                    break;
+                }
+            }
+            if (osMessageQueueGet(request_queue, &request, NULL, 0) == osOK)
+            {
+                total_executed++;
+                execute_request(request);
+                if (request->callback != NULL)
+                {
+                    request->callback(request);
+                }
+                else
+                {
+                    osThreadFlagsSet(request->caller, W25Q128FV_RTOS_DONE_FLAG);
+                }
+            }
+        } while (total_executed > 0);
+    }
+}
+
+static W25Q128FV_Status submit_data_request(uint8_t type, uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *data)
+{
+    /** <b>Local variable request:</b> @ref W25Q128FV_rtos_request_t Type variable used to hold the request, which lives until it is executed since this function waits for it. */
+    W25Q128FV_rtos_request_t request = {.type = type, .number = start_page, .page_bytes_offset = page_bytes_offset, .size = size, .data = data, .callback = NULL};
+
+    return w25q128fv_rtos_submit(&request);
+}
+
+/** @} */
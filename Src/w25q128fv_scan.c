@@ -0,0 +1,87 @@
+#include "w25q128fv_scan.h"
+#include <stddef.h> // Library from which "NULL" is located at.
+
+static uint32_t header_buffer[(W25Q128FV_SCAN_MAX_HEADER_SIZE_IN_BYTES+3)/4];  /**< @brief 32-bit aligned buffer that holds the header of the Sector being scanned. */
+
+W25Q128FV_Status w25q128fv_scan_headers(uint32_t first_sector, uint32_t total_sectors, uint32_t magic, uint16_t header_size_in_bytes, uint8_t *blank_sectors_bitmap, W25Q128FV_scan_header_callback_t on_header)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable sector:</b> @ref uint32_t Type variable used to hold the Sector being scanned, relative to \p first_sector . */
+    uint32_t sector;
+
+    /* Validate the given region and header size. */
+    if (((first_sector+total_sectors) > W25Q128FV_TOTAL_SECTORS) || (header_size_in_bytes<sizeof(uint32_t)) || (header_size_in_bytes>W25Q128FV_SCAN_MAX_HEADER_SIZE_IN_BYTES))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    for (sector=0; sector<total_sectors; sector++)
+    {
+        /* Read only the magic word and stop there if the Sector is blank or if it does not hold a header of the caller. */
+        ret = w25q128fv_fast_read_flash_memory((first_sector+sector) * W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(uint32_t), (uint8_t *) header_buffer);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (blank_sectors_bitmap != NULL)
+        {
+            if (header_buffer[0] == W25Q128FV_SCAN_BLANK_WORD)
+            {
+                blank_sectors_bitmap[sector/8] |= (1 << (sector%8));
+            }
+            else
+            {
+                blank_sectors_bitmap[sector/8] &= ~(1 << (sector%8));
+            }
+        }
+        if (header_buffer[0] != magic)
+        {
+            continue;
+        }
+
+        /* Read the rest of the header and give it to the caller. */
+        if (header_size_in_bytes > sizeof(uint32_t))
+        {
+            ret = w25q128fv_fast_read_flash_memory((first_sector+sector) * W25Q128FV_SECTOR_SIZE_IN_PAGES, sizeof(uint32_t), header_size_in_bytes-sizeof(uint32_t), (uint8_t *) &header_buffer[1]);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+        }
+        ret = on_header(first_sector+sector, (uint8_t *) header_buffer);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+uint8_t w25q128fv_scan_is_blank(const uint8_t *data, uint32_t size_in_bytes)
+{
+    /** <b>Local variable words:</b> @ref uint32_t Pointer type variable used to point to the buffer as 32-bit words. */
+    const uint32_t *words = (const uint32_t *) data;
+    /** <b>Local variable i:</b> @ref uint32_t Type variable used to iterate over the words and then over the remaining bytes of the buffer. */
+    uint32_t i;
+
+    for (i=0; i<(size_in_bytes/sizeof(uint32_t)); i++)
+    {
+        if (words[i] != W25Q128FV_SCAN_BLANK_WORD)
+        {
+            return 0;
+        }
+    }
+    for (i*=sizeof(uint32_t); i<size_in_bytes; i++)
+    {
+        if (data[i] != 0xFF)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/** @} */
@@ -0,0 +1,151 @@
+#include "w25q128fv_sha256.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+#define ROTR32(x, n)    (((x) >> (n)) | ((x) << (32 - (n))))   /**< @brief Rotates the 32-bit value \p x by \p n bits to the right. */
+
+static const uint32_t sha256_round_constants[64] =     /**< @brief Round constants of SHA-256, which are the first 32 bits of the fractional parts of the cube roots of the first 64 prime numbers. */
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/**@brief   Processes one block of data into the intermediate hash value of a SHA-256 calculation.
+ *
+ * @param sha256    Pointer to the Memory Location Address of the SHA-256 calculation context.
+ * @param[in] block Pointer to the Memory Location Address where the @ref W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES bytes of
+ *                  the block are located at.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void process_block(W25Q128FV_sha256_t *sha256, const uint8_t *block);
+
+void w25q128fv_sha256_init(W25Q128FV_sha256_t *sha256)
+{
+    sha256->state[0] = 0x6A09E667;
+    sha256->state[1] = 0xBB67AE85;
+    sha256->state[2] = 0x3C6EF372;
+    sha256->state[3] = 0xA54FF53A;
+    sha256->state[4] = 0x510E527F;
+    sha256->state[5] = 0x9B05688C;
+    sha256->state[6] = 0x1F83D9AB;
+    sha256->state[7] = 0x5BE0CD19;
+    sha256->total_size_in_bytes = 0;
+}
+
+void w25q128fv_sha256_update(W25Q128FV_sha256_t *sha256, const uint8_t *data, uint32_t size)
+{
+    /** <b>Local variable block_bytes:</b> @ref uint32_t Type variable used to hold the number of bytes that are waiting in the block of the context. */
+    uint32_t block_bytes = sha256->total_size_in_bytes % W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES;
+    /** <b>Local variable copy_size:</b> @ref uint32_t Type variable used to hold the number of bytes to be copied into the block of the context. */
+    uint32_t copy_size;
+
+    sha256->total_size_in_bytes += size;
+
+    /* Complete the block that is waiting in the context, if any. */
+    if (block_bytes > 0)
+    {
+        copy_size = W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES - block_bytes;
+        copy_size = (size < copy_size) ? size : copy_size;
+        memcpy(&sha256->block[block_bytes], data, copy_size);
+        data += copy_size;
+        size -= copy_size;
+        if ((block_bytes+copy_size) < W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES)
+        {
+            return;
+        }
+        process_block(sha256, sha256->block);
+    }
+
+    /* Process the whole blocks directly from the given data and keep the rest in the context. */
+    while (size >= W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES)
+    {
+        process_block(sha256, data);
+        data += W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES;
+        size -= W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES;
+    }
+    memcpy(sha256->block, data, size);
+}
+
+void w25q128fv_sha256_final(W25Q128FV_sha256_t *sha256, uint8_t *digest)
+{
+    /** <b>Local variable block_bytes:</b> @ref uint32_t Type variable used to hold the number of bytes that are waiting in the block of the context. */
+    uint32_t block_bytes = sha256->total_size_in_bytes % W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES;
+    /** <b>Local variable total_size_in_bits:</b> @ref uint64_t Type variable used to hold the size in bits of all the data that was fed. */
+    uint64_t total_size_in_bits = ((uint64_t) sha256->total_size_in_bytes) * 8;
+
+    /* Append the padding, which is a 1 bit followed by 0 bits up to the last 8 bytes of a block, and the size in bits of the data as a big endian value. */
+    sha256->block[block_bytes++] = 0x80;
+    if (block_bytes > (W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES-8))
+    {
+        memset(&sha256->block[block_bytes], 0, W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES-block_bytes);
+        process_block(sha256, sha256->block);
+        block_bytes = 0;
+    }
+    memset(&sha256->block[block_bytes], 0, (W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES-8)-block_bytes);
+    for (uint8_t i=0; i<8; i++)
+    {
+        sha256->block[W25Q128FV_SHA256_BLOCK_SIZE_IN_BYTES-1-i] = (uint8_t) (total_size_in_bits >> (8*i));
+    }
+    process_block(sha256, sha256->block);
+
+    /* Output the intermediate hash value as big endian words. */
+    for (uint8_t i=0; i<8; i++)
+    {
+        digest[4*i] = (uint8_t) (sha256->state[i] >> 24);
+        digest[4*i+1] = (uint8_t) (sha256->state[i] >> 16);
+        digest[4*i+2] = (uint8_t) (sha256->state[i] >> 8);
+        digest[4*i+3] = (uint8_t) (sha256->state[i]);
+    }
+}
+
+static void process_block(W25Q128FV_sha256_t *sha256, const uint8_t *block)
+{
+    /** <b>Local variable w:</b> @ref uint32_t array Type variable used to hold the message schedule, of which only the last 16 words are kept. */
+    uint32_t w[16];
+    /** <b>Local variable v:</b> @ref uint32_t array Type variable used to hold the working variables a, b, c, d, e, f, g and h. */
+    uint32_t v[8];
+    /** <b>Local variable t1:</b> @ref uint32_t Type variable used to hold the first temporary word of a round. */
+    uint32_t t1;
+    /** <b>Local variable t2:</b> @ref uint32_t Type variable used to hold the second temporary word of a round. */
+    uint32_t t2;
+
+    for (uint8_t i=0; i<16; i++)
+    {
+        w[i] = ((uint32_t) block[4*i] << 24) | ((uint32_t) block[4*i+1] << 16) | ((uint32_t) block[4*i+2] << 8) | block[4*i+3];
+    }
+    memcpy(v, sha256->state, sizeof(v));
+
+    for (uint8_t i=0; i<64; i++)
+    {
+        if (i >= 16)
+        {
+            t1 = w[(i-2) & 15];
+            t2 = w[(i-15) & 15];
+            w[i & 15] += (ROTR32(t1, 17) ^ ROTR32(t1, 19) ^ (t1 >> 10)) + w[(i-7) & 15] + (ROTR32(t2, 7) ^ ROTR32(t2, 18) ^ (t2 >> 3));
+        }
+        t1 = v[7] + (ROTR32(v[4], 6) ^ ROTR32(v[4], 11) ^ ROTR32(v[4], 25)) + ((v[4] & v[5]) ^ (~v[4] & v[6])) + sha256_round_constants[i] + w[i & 15];
+        t2 = (ROTR32(v[0], 2) ^ ROTR32(v[0], 13) ^ ROTR32(v[0], 22)) + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (uint8_t i=0; i<8; i++)
+    {
+        sha256->state[i] += v[i];
+    }
+}
+
+/** @} */
@@ -0,0 +1,683 @@
+#include "w25q128fv_slots.h"
+#include "w25q128fv_writer.h" // This custom Mortrack's library contains the functions, definitions and variables of the W25Q128FV Stream Writer module.
+#include "w25q128fv_sha256.h" // This custom Mortrack's library contains the functions, definitions and variables of the W25Q128FV SHA-256 module.
+#include "w25q128fv_crc32.h" // This custom Mortrack's library contains the CRC-32 function used to validate the data stored into the W25Q128FV Flash Memory Device.
+#include "w25q128fv_scan.h" // This custom Mortrack's library contains the functions, definitions and variables of the W25Q128FV Sector Header Scanner module.
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+#include <stddef.h> // Library from which "offsetof()" is located at.
+
+#define W25Q128FV_SLOTS_RECORD_MAGIC            (0x4C4A5357)    /**< @brief Value that identifies a record of the journal (i.e., "WSJL" in little endian). */
+#define W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES    (128)           /**< @brief Size in bytes of each record of the journal. */
+#define W25Q128FV_SLOTS_RECORDS_PER_SECTOR      (W25Q128FV_SECTOR_SIZE_IN_BYTES / W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES) /**< @brief Number of records that fit into each Sector of the journal. */
+#define W25Q128FV_SLOTS_TOTAL_RECORDS           (W25Q128FV_SLOTS_JOURNAL_SECTORS * W25Q128FV_SLOTS_RECORDS_PER_SECTOR)  /**< @brief Number of records that fit into the whole journal. */
+#define W25Q128FV_SLOTS_CHECKPOINT_INTERVAL     (W25Q128FV_SLOTS_CHECKPOINT_INTERVAL_IN_SECTORS * W25Q128FV_SECTOR_SIZE_IN_BYTES) /**< @brief Number of bytes of the new image after which the progress of the patch is appended into the journal. */
+#define W25Q128FV_SLOTS_CONTROL_SIZE_IN_BYTES   (12)            /**< @brief Size in bytes of the diff length, extra length and seek of a record of a patch. */
+#define W25Q128FV_SLOTS_RECORD_TYPE_COMMIT      (1)             /**< @brief Type of the records of the journal that state which slot holds the active image. */
+#define W25Q128FV_SLOTS_RECORD_TYPE_PROGRESS    (2)             /**< @brief Type of the records of the journal that hold the progress of a patch. */
+#define W25Q128FV_SLOTS_PHASE_HEADER            (0)             /**< @brief Phase of a patch in which its header is being received. */
+#define W25Q128FV_SLOTS_PHASE_CONTROL           (1)             /**< @brief Phase of a patch in which the diff length, extra length and seek of a record are being received. */
+#define W25Q128FV_SLOTS_PHASE_DIFF              (2)             /**< @brief Phase of a patch in which the diff bytes of a record are being received. */
+#define W25Q128FV_SLOTS_PHASE_EXTRA             (3)             /**< @brief Phase of a patch in which the extra bytes of a record are being received. */
+#define W25Q128FV_SLOTS_PHASE_DONE              (4)             /**< @brief Phase of a patch whose records have produced the whole new image. */
+
+/**@brief	Record of the journal of the @ref w25q128fv_slots .
+ */
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t magic;                                         //!< Must be @ref W25Q128FV_SLOTS_RECORD_MAGIC .
+    uint32_t crc32;                                         //!< CRC-32 of the rest of the record.
+    uint32_t sequence;                                      //!< Number that is incremented with each record, such that the record with the greatest one is the latest.
+    uint8_t type;                                           //!< Type of the record (e.g., @ref W25Q128FV_SLOTS_RECORD_TYPE_COMMIT ).
+    uint8_t slot;                                           //!< Slot that holds the active image in a commit record or that receives the new image in a progress record.
+    uint8_t phase;                                          //!< Phase of the patch (e.g., @ref W25Q128FV_SLOTS_PHASE_DIFF ).
+    uint8_t reserved;                                       //!< Reserved for future use.
+    uint32_t active_image_size;                             //!< Size in bytes of the active image.
+    uint32_t new_image_size;                                //!< Size in bytes of the new image.
+    uint32_t patch_offset;                                  //!< Offset within the patch of the next byte to be applied.
+    uint32_t new_offset;                                    //!< Offset within the new image of the next byte to be written.
+    uint32_t old_offset;                                    //!< Current position within the old image.
+    uint32_t diff_remaining;                                //!< Number of diff bytes of the current record of the patch that remain to be applied.
+    uint32_t extra_remaining;                               //!< Number of extra bytes of the current record of the patch that remain to be applied.
+    int32_t seek;                                           //!< Seek of the current record of the patch.
+    uint8_t digest[W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES];  //!< SHA-256 digest of the new image.
+    uint8_t padding[48];                                    //!< Padding up to @ref W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES bytes.
+} W25Q128FV_slots_record_t;
+
+static W25Q128FV_slots_def_t slots;                         /**< @brief Copy of the W25Q128FV A/B Slot Manager Definition parameters structure given at @ref init_w25q128fv_slots_module . */
+static uint8_t is_mounted = 0;                              /**< @brief Flag indicating whether the journal was mounted or formatted (i.e., 1) or not (i.e., 0). */
+static uint8_t active_slot;                                 /**< @brief Slot that holds the active image. */
+static uint32_t active_image_size;                          /**< @brief Size in bytes of the active image. */
+static uint32_t journal_sequence;                           /**< @brief Sequence of the latest record of the journal. */
+static uint32_t journal_next_position;                      /**< @brief Position within the journal, in records, at which the next record will be written. */
+static uint8_t is_patch_resumable = 0;                      /**< @brief Flag indicating whether the latest record of the journal that was mounted is a progress record (i.e., 1) or not (i.e., 0). */
+static uint8_t is_patch_in_progress = 0;                    /**< @brief Flag indicating whether a patch is being applied (i.e., 1) or not (i.e., 0). */
+static W25Q128FV_slots_record_t patch;                      /**< @brief Progress of the patch being applied, as it would be written into a progress record. */
+static uint8_t control_buffer[W25Q128FV_SLOTS_PATCH_HEADER_SIZE_IN_BYTES];  /**< @brief Buffer that gathers the header of the patch or the diff length, extra length and seek of its current record. */
+static uint8_t control_bytes;                               /**< @brief Number of bytes held in @ref control_buffer . */
+static uint8_t old_buffer[W25Q128FV_SLOTS_OLD_BUFFER_SIZE_IN_BYTES];       /**< @brief Buffer into which the bytes of the old image are read and then added to the diff bytes. */
+static W25Q128FV_writer_t new_slot_writer;                  /**< @brief Writer of the new image. */
+static W25Q128FV_sha256_t new_slot_sha256;                  /**< @brief SHA-256 calculation of the new image, which is used while checking it. */
+
+/**@brief   Appends a record into the journal, where its magic is written last.
+ *
+ * @details If the record is the first one of a Sector of the journal, then that Sector will be erased first, which is
+ *          safe since the latest records are always in the other Sector.
+ *
+ * @param record    Pointer to the Memory Location Address of the record, whose magic, CRC-32 and sequence will be set by
+ *                  this function.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record was successfully appended.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status append_record(W25Q128FV_slots_record_t *record);
+
+/**@brief   Appends a commit record stating the current active slot, which also discards any patch in progress.
+ *
+ * @retval	W25Q128FV_EC_OK     if the record was successfully appended.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status commit_active_slot(void);
+
+/**@brief   Writes some bytes of the new image and appends a progress record if they complete a checkpoint interval.
+ *
+ * @details The progress of the patch (e.g., @ref W25Q128FV_slots_record_t::patch_offset ) must already account for
+ *          these bytes, except for @ref W25Q128FV_slots_record_t::new_offset , which is updated by this function.
+ *
+ * @param[in] data  Pointer to the Memory Location Address where the bytes are located at.
+ * @param size      Number of bytes, which must not cross a multiple of @ref W25Q128FV_SLOTS_CHECKPOINT_INTERVAL .
+ *
+ * @retval	W25Q128FV_EC_OK     if the bytes were successfully written.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status write_new_image(uint8_t *data, uint32_t size);
+
+/**@brief   Applies the seek of the current record of the patch and moves on to the next record.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static void finish_patch_record(void);
+
+/**@brief   Parses the header or the control fields of a record of the patch that were gathered into
+ *          @ref control_buffer .
+ *
+ * @retval	W25Q128FV_EC_OK     if they were successfully parsed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if the patch is malformed or does not apply to the active image, or if anything else
+ *                              went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status parse_control_buffer(void);
+
+/**@brief   Feeds a chunk of the new image that @ref w25q128fv_slots_patch_end reads back into @ref new_slot_sha256 .
+ *
+ * @param[in] chunk Pointer to the Memory Location Address where the chunk is located at.
+ * @param size      Size in bytes of the chunk.
+ *
+ * @retval	W25Q128FV_EC_OK always, so that the whole new image is read.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status hash_new_slot_chunk(uint8_t *chunk, uint16_t size);
+
+/**@brief   Gets a little endian 32-bit value.
+ *
+ * @param[in] data  Pointer to the Memory Location Address where the 4 bytes of the value are located at.
+ *
+ * @return  The value.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint32_t get_le32(const uint8_t *data);
+
+/**@brief   Checks whether two ranges of Flash Memory Sectors of the W25Q128FV Device share any Sector.
+ *
+ * @param first_sector_a    First Sector of the first range.
+ * @param total_sectors_a   Number of Sectors of the first range.
+ * @param first_sector_b    First Sector of the second range.
+ * @param total_sectors_b   Number of Sectors of the second range.
+ *
+ * @return  1 if both ranges share at least one Sector or 0 if otherwise.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static uint8_t are_sectors_overlapping(uint32_t first_sector_a, uint32_t total_sectors_a, uint32_t first_sector_b, uint32_t total_sectors_b);
+
+W25Q128FV_Status init_w25q128fv_slots_module(W25Q128FV_slots_def_t *slots_def)
+{
+    /* Validate the given W25Q128FV A/B Slot Manager Definition parameters. */
+    if ((slots_def->slot_total_sectors == 0) || (slots_def->journal_first_sector > (W25Q128FV_TOTAL_SECTORS-W25Q128FV_SLOTS_JOURNAL_SECTORS)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    for (uint8_t slot=0; slot<2; slot++)
+    {
+        if ((slots_def->slot_first_sector[slot] >= W25Q128FV_TOTAL_SECTORS) || (slots_def->slot_total_sectors > (W25Q128FV_TOTAL_SECTORS-slots_def->slot_first_sector[slot])))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        if (are_sectors_overlapping(slots_def->slot_first_sector[slot], slots_def->slot_total_sectors, slots_def->journal_first_sector, W25Q128FV_SLOTS_JOURNAL_SECTORS))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+    }
+    if (are_sectors_overlapping(slots_def->slot_first_sector[0], slots_def->slot_total_sectors, slots_def->slot_first_sector[1], slots_def->slot_total_sectors))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Persist the W25Q128FV A/B Slot Manager Definition parameters. */
+    slots = *slots_def;
+    is_mounted = 0;
+    is_patch_resumable = 0;
+    is_patch_in_progress = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_format(uint8_t slot, uint32_t image_size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if ((slot > 1) || (image_size > (slots.slot_total_sectors*W25Q128FV_SECTOR_SIZE_IN_BYTES)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    is_mounted = 0;
+    is_patch_resumable = 0;
+    is_patch_in_progress = 0;
+    // NOTE: The first Sector is erased when the first record is appended, so that a power loss before that still leaves the previous journal.
+    for (uint8_t i=1; i<W25Q128FV_SLOTS_JOURNAL_SECTORS; i++)
+    {
+        ret = w25q128fv_erase_sector(slots.journal_first_sector + i);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+    journal_next_position = 0;
+    journal_sequence = 0;
+
+    active_slot = slot;
+    active_image_size = image_size;
+    ret = commit_active_slot();
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_mount(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable record:</b> @ref W25Q128FV_slots_record_t Type variable used to hold the record being read. */
+    W25Q128FV_slots_record_t record;
+    /** <b>Local variable record_words:</b> @ref uint32_t Type array variable used to hold the record as it is read, which is 32-bit aligned so that it can be checked for being erased one word at a time. */
+    uint32_t record_words[W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES/4];
+    /** <b>Local variable latest_position:</b> @ref uint32_t Type variable used to hold the position of the latest valid record found so far, or @ref W25Q128FV_SLOTS_TOTAL_RECORDS if none. */
+    uint32_t latest_position = W25Q128FV_SLOTS_TOTAL_RECORDS;
+    /** <b>Local variable blank_positions:</b> @ref uint8_t Type array variable used to hold a bit per position of the journal, which is set if its record is fully erased. */
+    uint8_t blank_positions[(W25Q128FV_SLOTS_TOTAL_RECORDS+7)/8] = {0};
+
+    is_mounted = 0;
+    is_patch_resumable = 0;
+    is_patch_in_progress = 0;
+
+    /* Find the latest valid record. */
+    for (uint32_t position=0; position<W25Q128FV_SLOTS_TOTAL_RECORDS; position++)
+    {
+        ret = w25q128fv_fast_read_flash_memory(slots.journal_first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES + position*W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES/W25Q128FV_PAGE_SIZE_IN_BYTES,
+                                               (position*W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES) % W25Q128FV_PAGE_SIZE_IN_BYTES, sizeof(record_words), (uint8_t *) record_words);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        if (w25q128fv_scan_is_blank((uint8_t *) record_words, sizeof(record_words)))
+        {
+            blank_positions[position/8] |= 1 << (position%8);
+            continue;
+        }
+        memcpy(&record, record_words, sizeof(record));
+        if ((record.magic != W25Q128FV_SLOTS_RECORD_MAGIC)
+            || (record.crc32 != w25q128fv_crc32_update(0, (uint8_t *) &record.sequence, sizeof(record)-offsetof(W25Q128FV_slots_record_t, sequence))))
+        {
+            continue;
+        }
+        if ((latest_position == W25Q128FV_SLOTS_TOTAL_RECORDS) || ((int32_t) (record.sequence-patch.sequence) > 0))
+        {
+            latest_position = position;
+            patch = record;
+        }
+    }
+    if (latest_position == W25Q128FV_SLOTS_TOTAL_RECORDS)
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    /* Continue the journal at the first blank record that follows the latest one within its Sector, or at the next Sector. */
+    journal_sequence = patch.sequence;
+    journal_next_position = latest_position + 1;
+    while (((journal_next_position % W25Q128FV_SLOTS_RECORDS_PER_SECTOR) != 0) && (((blank_positions[journal_next_position/8] >> (journal_next_position%8)) & 1) == 0))
+    {
+        journal_next_position++;
+    }
+    journal_next_position %= W25Q128FV_SLOTS_TOTAL_RECORDS;
+
+    if (patch.type == W25Q128FV_SLOTS_RECORD_TYPE_PROGRESS)
+    {
+        active_slot = patch.slot ^ 1;
+        is_patch_resumable = 1;
+    }
+    else
+    {
+        active_slot = patch.slot;
+    }
+    active_image_size = patch.active_image_size;
+    is_mounted = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_get_active(uint8_t *slot, uint32_t *image_size)
+{
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    *slot = active_slot;
+    *image_size = active_image_size;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_patch_begin(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    is_patch_resumable = 0;
+    is_patch_in_progress = 0;
+    memset(&patch, 0, sizeof(patch));
+    patch.type = W25Q128FV_SLOTS_RECORD_TYPE_PROGRESS;
+    patch.slot = active_slot ^ 1;
+    patch.phase = W25Q128FV_SLOTS_PHASE_HEADER;
+    patch.active_image_size = active_image_size;
+    control_bytes = 0;
+
+    ret = w25q128fv_writer_open(&new_slot_writer, slots.slot_first_sector[patch.slot], slots.slot_total_sectors);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    is_patch_in_progress = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_patch_resume(uint32_t *patch_offset)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable sector_index:</b> @ref uint32_t Type variable used to hold the index, relative to the new slot, of the Sector from which the new image will be written again. */
+    uint32_t sector_index;
+
+    if (is_mounted == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (is_patch_resumable == 0)
+    {
+        return W25Q128FV_EC_NA;
+    }
+
+    /* Write the new image again from the Sector that follows the last one covered by the progress record. */
+    // NOTE: Progress records are only appended at multiples of a Sector of the new image, so everything before it is already programmed.
+    sector_index = patch.new_offset / W25Q128FV_SECTOR_SIZE_IN_BYTES;
+    if (sector_index >= slots.slot_total_sectors)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    ret = w25q128fv_writer_open(&new_slot_writer, slots.slot_first_sector[patch.slot]+sector_index, slots.slot_total_sectors-sector_index);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    control_bytes = 0;
+    is_patch_resumable = 0;
+    is_patch_in_progress = 1;
+    *patch_offset = patch.patch_offset;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_patch_write(uint8_t *data, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable n:</b> @ref uint32_t Type variable used to hold the number of bytes of the chunk to be applied in the current step. */
+    uint32_t n;
+    /** <b>Local variable old_address:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address of the current position within the old image. */
+    uint32_t old_address;
+
+    if (is_patch_in_progress == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    while (size > 0)
+    {
+        switch (patch.phase)
+        {
+            case W25Q128FV_SLOTS_PHASE_HEADER:
+            case W25Q128FV_SLOTS_PHASE_CONTROL:
+                /* Gather the header or the control fields of the next record. */
+                n = ((patch.phase == W25Q128FV_SLOTS_PHASE_HEADER) ? W25Q128FV_SLOTS_PATCH_HEADER_SIZE_IN_BYTES : W25Q128FV_SLOTS_CONTROL_SIZE_IN_BYTES) - control_bytes;
+                n = (size < n) ? size : n;
+                memcpy(&control_buffer[control_bytes], data, n);
+                control_bytes += n;
+                patch.patch_offset += n;
+                data += n;
+                size -= n;
+                ret = parse_control_buffer();
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    is_patch_in_progress = 0;
+                    if (ret == W25Q128FV_EC_ERR)
+                    {
+                        commit_active_slot();
+                    }
+                    return ret;
+                }
+                break;
+
+            case W25Q128FV_SLOTS_PHASE_DIFF:
+                /* Add the diff bytes to the bytes of the old image. */
+                n = W25Q128FV_SLOTS_CHECKPOINT_INTERVAL - (patch.new_offset % W25Q128FV_SLOTS_CHECKPOINT_INTERVAL);
+                n = (patch.diff_remaining < n) ? patch.diff_remaining : n;
+                n = (size < n) ? size : n;
+                n = (W25Q128FV_SLOTS_OLD_BUFFER_SIZE_IN_BYTES < n) ? W25Q128FV_SLOTS_OLD_BUFFER_SIZE_IN_BYTES : n;
+                old_address = slots.slot_first_sector[active_slot]*W25Q128FV_SECTOR_SIZE_IN_BYTES + patch.old_offset;
+                ret = w25q128fv_fast_read_flash_memory(old_address/W25Q128FV_PAGE_SIZE_IN_BYTES, old_address%W25Q128FV_PAGE_SIZE_IN_BYTES, n, old_buffer);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    is_patch_in_progress = 0;
+                    return ret;
+                }
+                for (uint32_t i=0; i<n; i++)
+                {
+                    old_buffer[i] += data[i];
+                }
+                patch.patch_offset += n;
+                patch.old_offset += n;
+                patch.diff_remaining -= n;
+                data += n;
+                size -= n;
+                if (patch.diff_remaining == 0)
+                {
+                    if (patch.extra_remaining > 0)
+                    {
+                        patch.phase = W25Q128FV_SLOTS_PHASE_EXTRA;
+                    }
+                    else
+                    {
+                        patch.new_offset += n;
+                        finish_patch_record();
+                        patch.new_offset -= n;
+                    }
+                }
+                ret = write_new_image(old_buffer, n);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    is_patch_in_progress = 0;
+                    return ret;
+                }
+                break;
+
+            case W25Q128FV_SLOTS_PHASE_EXTRA:
+                /* Copy the extra bytes as they are. */
+                n = W25Q128FV_SLOTS_CHECKPOINT_INTERVAL - (patch.new_offset % W25Q128FV_SLOTS_CHECKPOINT_INTERVAL);
+                n = (patch.extra_remaining < n) ? patch.extra_remaining : n;
+                n = (size < n) ? size : n;
+                patch.patch_offset += n;
+                patch.extra_remaining -= n;
+                if (patch.extra_remaining == 0)
+                {
+                    patch.new_offset += n;
+                    finish_patch_record();
+                    patch.new_offset -= n;
+                }
+                ret = write_new_image(data, n);
+                if (ret != W25Q128FV_EC_OK)
+                {
+                    is_patch_in_progress = 0;
+                    return ret;
+                }
+                data += n;
+                size -= n;
+                break;
+
+            default:
+                /* Any byte after the records that produced the whole new image means that the patch is malformed. */
+                is_patch_in_progress = 0;
+                commit_active_slot();
+                return W25Q128FV_EC_ERR;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_slots_patch_end(void)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable digest:</b> @ref uint8_t array Type variable used to hold the SHA-256 digest of the new image as read back from its slot. */
+    uint8_t digest[W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES];
+
+    if ((is_patch_in_progress==0) || (patch.phase!=W25Q128FV_SLOTS_PHASE_DONE))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    ret = w25q128fv_writer_close(&new_slot_writer);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    is_patch_in_progress = 0;
+
+    /* Check the new image as it was stored, and only then make it the active one. */
+    w25q128fv_sha256_init(&new_slot_sha256);
+    ret = w25q128fv_stream_read(slots.slot_first_sector[patch.slot]*W25Q128FV_SECTOR_SIZE_IN_BYTES, patch.new_image_size, hash_new_slot_chunk);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    w25q128fv_sha256_final(&new_slot_sha256, digest);
+    if (memcmp(digest, patch.digest, W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES) != 0)
+    {
+        commit_active_slot();
+        return W25Q128FV_EC_ERR;
+    }
+    active_slot = patch.slot;
+    active_image_size = patch.new_image_size;
+
+    return commit_active_slot();
+}
+
+static W25Q128FV_Status append_record(W25Q128FV_slots_record_t *record)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable address:</b> @ref uint32_t Type variable used to hold the W25Q128FV Device 24-bit Flash Memory Address of the record. */
+    uint32_t address = slots.journal_first_sector*W25Q128FV_SECTOR_SIZE_IN_BYTES + journal_next_position*W25Q128FV_SLOTS_RECORD_SIZE_IN_BYTES;
+
+    if ((journal_next_position % W25Q128FV_SLOTS_RECORDS_PER_SECTOR) == 0)
+    {
+        ret = w25q128fv_erase_sector(address / W25Q128FV_SECTOR_SIZE_IN_BYTES);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+    }
+
+    record->magic = W25Q128FV_SLOTS_RECORD_MAGIC;
+    record->sequence = journal_sequence + 1;
+    record->crc32 = w25q128fv_crc32_update(0, (uint8_t *) &record->sequence, sizeof(*record)-offsetof(W25Q128FV_slots_record_t, sequence));
+    ret = w25q128fv_write_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, (address%W25Q128FV_PAGE_SIZE_IN_BYTES)+offsetof(W25Q128FV_slots_record_t, crc32),
+                                       sizeof(*record)-offsetof(W25Q128FV_slots_record_t, crc32), (uint8_t *) &record->crc32);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    ret = w25q128fv_write_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, address%W25Q128FV_PAGE_SIZE_IN_BYTES, sizeof(record->magic), (uint8_t *) &record->magic);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    journal_sequence++;
+    journal_next_position = (journal_next_position + 1) % W25Q128FV_SLOTS_TOTAL_RECORDS;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status commit_active_slot(void)
+{
+    /** <b>Local variable record:</b> @ref W25Q128FV_slots_record_t Type variable used to hold the commit record. */
+    W25Q128FV_slots_record_t record;
+
+    memset(&record, 0, sizeof(record));
+    record.type = W25Q128FV_SLOTS_RECORD_TYPE_COMMIT;
+    record.slot = active_slot;
+    record.active_image_size = active_image_size;
+
+    return append_record(&record);
+}
+
+static W25Q128FV_Status write_new_image(uint8_t *data, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    ret = w25q128fv_writer_write(&new_slot_writer, data, size);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    patch.new_offset += size;
+
+    /* Record the progress of the patch once the new image reaches a checkpoint interval, since the writer has programmed all of it by then. */
+    if (((patch.new_offset % W25Q128FV_SLOTS_CHECKPOINT_INTERVAL) == 0) && (patch.phase != W25Q128FV_SLOTS_PHASE_DONE))
+    {
+        return append_record(&patch);
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static void finish_patch_record(void)
+{
+    patch.old_offset += patch.seek;
+    patch.phase = (patch.new_offset == patch.new_image_size) ? W25Q128FV_SLOTS_PHASE_DONE : W25Q128FV_SLOTS_PHASE_CONTROL;
+}
+
+static W25Q128FV_Status parse_control_buffer(void)
+{
+    if (patch.phase == W25Q128FV_SLOTS_PHASE_HEADER)
+    {
+        if (control_bytes < W25Q128FV_SLOTS_PATCH_HEADER_SIZE_IN_BYTES)
+        {
+            return W25Q128FV_EC_OK;
+        }
+        control_bytes = 0;
+
+        /* Validate that the patch applies to the active image and that the new image fits into a slot. */
+        if ((get_le32(&control_buffer[0]) != W25Q128FV_SLOTS_PATCH_MAGIC) || (get_le32(&control_buffer[4]) != active_image_size)
+            || (get_le32(&control_buffer[8]) > (slots.slot_total_sectors*W25Q128FV_SECTOR_SIZE_IN_BYTES)))
+        {
+            return W25Q128FV_EC_ERR;
+        }
+        patch.new_image_size = get_le32(&control_buffer[8]);
+        memcpy(patch.digest, &control_buffer[12], W25Q128FV_SHA256_DIGEST_SIZE_IN_BYTES);
+        patch.phase = (patch.new_image_size == 0) ? W25Q128FV_SLOTS_PHASE_DONE : W25Q128FV_SLOTS_PHASE_CONTROL;
+
+        /* Record that this patch is in progress. */
+        return append_record(&patch);
+    }
+
+    if (control_bytes < W25Q128FV_SLOTS_CONTROL_SIZE_IN_BYTES)
+    {
+        return W25Q128FV_EC_OK;
+    }
+    control_bytes = 0;
+    patch.diff_remaining = get_le32(&control_buffer[0]);
+    patch.extra_remaining = get_le32(&control_buffer[4]);
+    patch.seek = (int32_t) get_le32(&control_buffer[8]);
+
+    /* Validate that the record stays within both the old and the new image. */
+    if ((patch.old_offset > active_image_size) || (patch.diff_remaining > (active_image_size-patch.old_offset))
+        || (patch.diff_remaining > (patch.new_image_size-patch.new_offset))
+        || (patch.extra_remaining > (patch.new_image_size-patch.new_offset-patch.diff_remaining)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+    if (patch.diff_remaining > 0)
+    {
+        patch.phase = W25Q128FV_SLOTS_PHASE_DIFF;
+    }
+    else if (patch.extra_remaining > 0)
+    {
+        patch.phase = W25Q128FV_SLOTS_PHASE_EXTRA;
+    }
+    else
+    {
+        finish_patch_record();
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status hash_new_slot_chunk(uint8_t *chunk, uint16_t size)
+{
+    w25q128fv_sha256_update(&new_slot_sha256, chunk, size);
+
+    return W25Q128FV_EC_OK;
+}
+
+static uint32_t get_le32(const uint8_t *data)
+{
+    return ((uint32_t) data[0]) | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static uint8_t are_sectors_overlapping(uint32_t first_sector_a, uint32_t total_sectors_a, uint32_t first_sector_b, uint32_t total_sectors_b)
+{
+    return (first_sector_a < (first_sector_b+total_sectors_b)) && (first_sector_b < (first_sector_a+total_sectors_a));
+}
+
+/** @} */
@@ -0,0 +1,178 @@
+#include "w25q128fv_writer.h"
+#include <string.h>	// Library from which "memset()" and "memcpy()" are located at.
+
+/**@brief   Programs a Page of the region of a writer, after making sure that its Sector is erased.
+ *
+ * @details If the Page is the first one of a Sector that is not ready yet, then this function will first wait for the
+ *          erase of that Sector that was started in the background or, if there is none, erase it. After that, the
+ *          erase of the Sector that follows it is started in the background.
+ *
+ * @param writer    Pointer to the Memory Location Address of the writer.
+ * @param offset    Offset in bytes, relative to the start of the region of the writer, of the Page to be programmed.
+ * @param[in] data  Pointer to the Memory Location Address where the data to be programmed is located at.
+ * @param size      Size in bytes of the data to be programmed, which may be any from 1 up to
+ *                  @ref W25Q128FV_PAGE_SIZE_IN_BYTES .
+ *
+ * @retval	W25Q128FV_EC_OK     if the Page was successfully programmed.
+ * @retval  W25Q128FV_EC_NR     if there was no response from the W25Q128FV Flash Memory Device.
+ * @retval  W25Q128FV_EC_ERR    if anything else went wrong.
+ *
+ * @author	César Miranda Meza (cmirandameza3@hotmail.com)
+ * @date	October 17, 2026.
+ */
+static W25Q128FV_Status program_page(W25Q128FV_writer_t *writer, uint32_t offset, uint8_t *data, uint16_t size);
+
+W25Q128FV_Status w25q128fv_writer_open(W25Q128FV_writer_t *writer, uint32_t first_sector, uint32_t total_sectors)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    /* Validate the given region. */
+    if ((total_sectors==0) || (first_sector>=W25Q128FV_TOTAL_SECTORS) || (total_sectors>(W25Q128FV_TOTAL_SECTORS-first_sector)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    writer->first_sector = first_sector;
+    writer->total_sectors = total_sectors;
+    writer->size_in_bytes = 0;
+    writer->ready_sectors = 0;
+    writer->is_erase_in_progress = 0;
+    writer->staged_bytes = 0;
+    writer->is_open = 0;
+
+    /* Erase the first Sector right away and start erasing the second one in the background. */
+    ret = w25q128fv_erase_sector(first_sector);
+    if (ret != W25Q128FV_EC_OK)
+    {
+        return ret;
+    }
+    writer->ready_sectors = 1;
+    if (total_sectors > 1)
+    {
+        ret = w25q128fv_start_erase_sector(first_sector + 1);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        writer->is_erase_in_progress = 1;
+    }
+    writer->is_open = 1;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_writer_write(W25Q128FV_writer_t *writer, uint8_t *src, uint32_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+    /** <b>Local variable staged_size:</b> @ref uint32_t Type variable used to hold the number of bytes of the chunk to be copied into the staging buffer. */
+    uint32_t staged_size;
+
+    /* Validate that the writer is open and that the chunk fits into the rest of its region. */
+    if ((writer->is_open==0) || (size > (writer->total_sectors*W25Q128FV_SECTOR_SIZE_IN_BYTES - writer->size_in_bytes)))
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    while (size > 0)
+    {
+        /* Program the whole Pages of the chunk directly from it whenever nothing is staged. */
+        if ((writer->staged_bytes==0) && (size>=W25Q128FV_PAGE_SIZE_IN_BYTES))
+        {
+            ret = program_page(writer, writer->size_in_bytes, src, W25Q128FV_PAGE_SIZE_IN_BYTES);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            writer->size_in_bytes += W25Q128FV_PAGE_SIZE_IN_BYTES;
+            src += W25Q128FV_PAGE_SIZE_IN_BYTES;
+            size -= W25Q128FV_PAGE_SIZE_IN_BYTES;
+            continue;
+        }
+
+        /* Otherwise, stage the data and program the staging buffer once it holds a whole Page. */
+        staged_size = W25Q128FV_PAGE_SIZE_IN_BYTES - writer->staged_bytes;
+        staged_size = (size < staged_size) ? size : staged_size;
+        memcpy(&writer->staging[writer->staged_bytes], src, staged_size);
+        writer->staged_bytes += staged_size;
+        writer->size_in_bytes += staged_size;
+        src += staged_size;
+        size -= staged_size;
+        if (writer->staged_bytes == W25Q128FV_PAGE_SIZE_IN_BYTES)
+        {
+            ret = program_page(writer, writer->size_in_bytes-W25Q128FV_PAGE_SIZE_IN_BYTES, writer->staging, W25Q128FV_PAGE_SIZE_IN_BYTES);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            writer->staged_bytes = 0;
+        }
+    }
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_writer_close(W25Q128FV_writer_t *writer)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    if (writer->is_open == 0)
+    {
+        return W25Q128FV_EC_ERR;
+    }
+
+    /* Program the partial Page that is still staged, if any. */
+    if (writer->staged_bytes > 0)
+    {
+        ret = program_page(writer, writer->size_in_bytes-writer->staged_bytes, writer->staging, writer->staged_bytes);
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        writer->staged_bytes = 0;
+    }
+    writer->is_open = 0;
+
+    return W25Q128FV_EC_OK;
+}
+
+static W25Q128FV_Status program_page(W25Q128FV_writer_t *writer, uint32_t offset, uint8_t *data, uint16_t size)
+{
+    /** <b>Local variable ret:</b> @ref uint8_t Type variable used to hold the Return value of a @ref W25Q128FV_Status function type. */
+    uint8_t ret;
+
+    /* Make sure that the Sector of the Page is erased and start erasing the one that follows it in the background. */
+    if ((offset/W25Q128FV_SECTOR_SIZE_IN_BYTES) >= writer->ready_sectors)
+    {
+        if (writer->is_erase_in_progress == 1)
+        {
+            ret = w25q128fv_wait_for_background_erase();
+        }
+        else
+        {
+            ret = w25q128fv_erase_sector(writer->first_sector + writer->ready_sectors);
+        }
+        if (ret != W25Q128FV_EC_OK)
+        {
+            return ret;
+        }
+        writer->is_erase_in_progress = 0;
+        writer->ready_sectors++;
+
+        if (writer->ready_sectors < writer->total_sectors)
+        {
+            ret = w25q128fv_start_erase_sector(writer->first_sector + writer->ready_sectors);
+            if (ret != W25Q128FV_EC_OK)
+            {
+                return ret;
+            }
+            writer->is_erase_in_progress = 1;
+        }
+    }
+
+    return w25q128fv_write_flash_memory((writer->first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES) + (offset/W25Q128FV_PAGE_SIZE_IN_BYTES), 0, size, data);
+}
+
+/** @} */
@@ -0,0 +1,166 @@
+/**@file
+ * @brief	Host model of the Cortex-M7 data cache as seen by DMA receptions (see dcache_model.h ).
+ */
+
+#include "dcache_model.h"
+#include "flash_model.h"
+#include <string.h>
+
+#define TOTAL_LINES (8192)
+
+typedef struct
+{
+    uintptr_t base;
+    uint8_t is_used;
+    uint8_t is_resident;
+    uint8_t is_dirty;
+    uint8_t is_eviction_pending;
+    uint8_t ram[DCACHE_MODEL_LINE_SIZE_IN_BYTES];
+} line_t;
+
+static line_t lines[TOTAL_LINES];
+static unsigned long misaligned_operations;
+static unsigned long invalidations;
+static unsigned int random_state = 1;
+
+static line_t *get_line(uintptr_t address)
+{
+    uintptr_t base = address & ~(uintptr_t) (DCACHE_MODEL_LINE_SIZE_IN_BYTES-1);
+    uint32_t index = (uint32_t) ((base / DCACHE_MODEL_LINE_SIZE_IN_BYTES) * 2654435761u) % TOTAL_LINES;
+
+    while (lines[index].is_used && (lines[index].base!=base))
+    {
+        index = (index + 1) % TOTAL_LINES;
+    }
+    if (!lines[index].is_used)
+    {
+        lines[index].is_used = 1;
+        lines[index].base = base;
+    }
+    return &lines[index];
+}
+
+/* Brings a line into the cache, which then holds the same data as the RAM. */
+static void make_resident(line_t *line)
+{
+    if (!line->is_resident)
+    {
+        memcpy(line->ram, (void *) line->base, DCACHE_MODEL_LINE_SIZE_IN_BYTES);
+        line->is_resident = 1;
+        line->is_dirty = 0;
+        line->is_eviction_pending = 0;
+    }
+}
+
+static void on_dma_start(uint8_t *dst, uint16_t size)
+{
+    uintptr_t end = (uintptr_t) dst + size;
+
+    if (size == 0)
+    {
+        return;
+    }
+    for (uintptr_t address=(uintptr_t) dst & ~(uintptr_t) (DCACHE_MODEL_LINE_SIZE_IN_BYTES-1); address<end; address+=DCACHE_MODEL_LINE_SIZE_IN_BYTES)
+    {
+        line_t *line = get_line(address);
+
+        if (line->is_resident && line->is_dirty)
+        {
+            line->is_eviction_pending = 1;
+        }
+    }
+    make_resident(get_line((uintptr_t) dst + (uint32_t) rand_r(&random_state) % size));
+}
+
+static void on_dma_write(uint8_t *dst, uint8_t value)
+{
+    line_t *line = get_line((uintptr_t) dst);
+
+    if (line->is_resident)
+    {
+        line->ram[(uintptr_t) dst % DCACHE_MODEL_LINE_SIZE_IN_BYTES] = value;
+    }
+    else
+    {
+        *dst = value;
+    }
+}
+
+void dcache_model_enable(void)
+{
+    memset(lines, 0, sizeof(lines));
+    flash_model_set_dma_hooks(on_dma_start, on_dma_write);
+}
+
+void dcache_model_cpu_write(void *dst, uint8_t value, size_t size)
+{
+    uintptr_t end = (uintptr_t) dst + size;
+
+    for (uintptr_t address=(uintptr_t) dst & ~(uintptr_t) (DCACHE_MODEL_LINE_SIZE_IN_BYTES-1); address<end; address+=DCACHE_MODEL_LINE_SIZE_IN_BYTES)
+    {
+        line_t *line = get_line(address);
+
+        make_resident(line);
+        line->is_dirty = 1;
+    }
+    memset(dst, value, size);
+}
+
+unsigned long dcache_model_get_misaligned_operations(void)
+{
+    return misaligned_operations;
+}
+
+unsigned long dcache_model_get_invalidations(void)
+{
+    return invalidations;
+}
+
+void SCB_CleanDCache_by_Addr(void *addr, int32_t dsize)
+{
+    uintptr_t end = (uintptr_t) addr + (uint32_t) dsize;
+
+    if ((((uintptr_t) addr % DCACHE_MODEL_LINE_SIZE_IN_BYTES) != 0) || ((dsize % DCACHE_MODEL_LINE_SIZE_IN_BYTES) != 0))
+    {
+        misaligned_operations++;
+    }
+    for (uintptr_t address=(uintptr_t) addr & ~(uintptr_t) (DCACHE_MODEL_LINE_SIZE_IN_BYTES-1); address<end; address+=DCACHE_MODEL_LINE_SIZE_IN_BYTES)
+    {
+        line_t *line = get_line(address);
+
+        if (line->is_resident && line->is_dirty)
+        {
+            memcpy(line->ram, (void *) address, DCACHE_MODEL_LINE_SIZE_IN_BYTES);
+            line->is_dirty = 0;
+            line->is_eviction_pending = 0;
+        }
+    }
+}
+
+void SCB_InvalidateDCache_by_Addr(void *addr, int32_t dsize)
+{
+    uintptr_t end = (uintptr_t) addr + (uint32_t) dsize;
+
+    invalidations++;
+    if ((((uintptr_t) addr % DCACHE_MODEL_LINE_SIZE_IN_BYTES) != 0) || ((dsize % DCACHE_MODEL_LINE_SIZE_IN_BYTES) != 0))
+    {
+        misaligned_operations++;
+    }
+    for (uintptr_t address=(uintptr_t) addr & ~(uintptr_t) (DCACHE_MODEL_LINE_SIZE_IN_BYTES-1); address<end; address+=DCACHE_MODEL_LINE_SIZE_IN_BYTES)
+    {
+        line_t *line = get_line(address);
+
+        if (!line->is_resident)
+        {
+            continue;
+        }
+        // NOTE: A dirty line that was evicted while the DMA was writing its RAM has overwritten the data of the DMA.
+        if (!line->is_eviction_pending)
+        {
+            memcpy((void *) address, line->ram, DCACHE_MODEL_LINE_SIZE_IN_BYTES);
+        }
+        line->is_resident = 0;
+        line->is_dirty = 0;
+        line->is_eviction_pending = 0;
+    }
+}
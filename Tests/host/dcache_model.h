@@ -0,0 +1,35 @@
+/**@file
+ * @brief	Host model of the Cortex-M7 data cache as seen by DMA receptions, for the host tests.
+ *
+ * @details The memory of the host plays the role of the view of the CPU, whereas the model keeps, for each 32-byte line
+ *          that is resident in the cache, the contents of the RAM behind it. Thus:
+ *          <ul>
+ *              <li>The DMA writes into a resident line only reach the RAM, so the CPU keeps reading stale data.</li>
+ *              <li>The CPU writes made via @ref dcache_model_cpu_write leave their lines resident and dirty.</li>
+ *              <li>
+ *                  Whenever a DMA reception starts, one line of its buffer is speculatively fetched, and every dirty
+ *                  line of its buffer is written back to the RAM after the DMA has written it, as an eviction would.
+ *              </li>
+ *              <li>
+ *                  @ref SCB_InvalidateDCache_by_Addr makes the CPU see the RAM, losing any dirty data, and
+ *                  @ref SCB_CleanDCache_by_Addr writes the dirty data back. Both count as misaligned any range that
+ *                  does not cover whole lines.
+ *              </li>
+ *          </ul>
+ */
+
+#ifndef DCACHE_MODEL_H
+#define DCACHE_MODEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DCACHE_MODEL_LINE_SIZE_IN_BYTES (32)
+
+/* Makes every line non-resident, without writing anything back, and routes the DMA receptions through the model. */
+void dcache_model_enable(void);
+void dcache_model_cpu_write(void *dst, uint8_t value, size_t size);
+unsigned long dcache_model_get_misaligned_operations(void);
+unsigned long dcache_model_get_invalidations(void);
+
+#endif /* DCACHE_MODEL_H */
@@ -0,0 +1,552 @@
+/**@file
+ * @brief	Host model of a W25Q128FV Flash Memory Device behind the STM32 HAL SPI (see flash_model.h ).
+ */
+
+#define _GNU_SOURCE
+#include "flash_model.h"
+#include <pthread.h>
+#include <string.h>
+
+#define MAX_INSTRUCTION_SIZE_IN_BYTES   (300)
+#define SECTOR_ERASE_TIME_IN_MS         (45)
+#define BLOCK_64KB_ERASE_TIME_IN_MS     (150)
+#define CHIP_ERASE_TIME_IN_MS           (1000)
+
+typedef enum
+{
+    RESPONSE_NONE = 0,
+    RESPONSE_DATA,
+    RESPONSE_JEDEC_ID,
+    RESPONSE_STATUS_REGISTER_1,
+    RESPONSE_STATUS_REGISTER_2
+} response_t;
+
+typedef enum
+{
+    PENDING_NONE = 0,
+    PENDING_DMA_RECEIVE,
+    PENDING_IT_TRANSMIT,
+    PENDING_IT_TRANSMIT_RECEIVE
+} pending_t;
+
+uint8_t flash_model_memory[FLASH_MODEL_SIZE_IN_BYTES];
+SPI_HandleTypeDef flash_model_hspi;
+
+static pthread_mutex_t model_lock;
+static pthread_once_t model_lock_once = PTHREAD_ONCE_INIT;
+static GPIO_TypeDef cs_port;
+static W25Q128FV_peripherals_def_t peripherals;
+static uint32_t tick;
+static unsigned long violations;
+static int is_cs_low, is_nss_enabled, is_write_enabled, is_busy, is_suspended;
+static uint32_t busy_until_tick, erase_address, erase_size;
+static uint8_t instruction[MAX_INSTRUCTION_SIZE_IN_BYTES];
+static uint32_t instruction_size;
+static response_t response;
+static uint32_t read_address, jedec_id_index;
+static int is_dma_deferred;
+static pending_t pending;
+static uint8_t *pending_tx, *pending_rx;
+static uint16_t pending_size;
+static flash_model_dma_start_hook_t dma_start_hook;
+static flash_model_dma_write_hook_t dma_write_hook;
+
+static void init_model_lock(void)
+{
+    pthread_mutexattr_t attr;
+
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&model_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+static void lock_model(void)
+{
+    pthread_once(&model_lock_once, init_model_lock);
+    pthread_mutex_lock(&model_lock);
+}
+
+static void unlock_model(void)
+{
+    pthread_mutex_unlock(&model_lock);
+}
+
+static void report_violation(const char *what)
+{
+    violations++;
+    fprintf(stderr, "flash model violation: %s (instruction 0x%02X)\n", what, (instruction_size>0) ? instruction[0] : 0);
+}
+
+static void update_busy(void)
+{
+    if (is_busy && !is_suspended && ((int32_t) (tick-busy_until_tick) >= 0))
+    {
+        memset(&flash_model_memory[erase_address], 0xFF, erase_size);
+        is_busy = 0;
+        is_write_enabled = 0;
+    }
+}
+
+static uint32_t get_instruction_address(void)
+{
+    return ((uint32_t) instruction[1] << 16) | ((uint32_t) instruction[2] << 8) | instruction[3];
+}
+
+static void start_erase(uint32_t size, uint32_t time_in_ms)
+{
+    if (!is_write_enabled)
+    {
+        report_violation("erase without Write Enable");
+        return;
+    }
+    is_busy = 1;
+    busy_until_tick = tick + time_in_ms;
+    erase_size = size;
+    erase_address = (size == FLASH_MODEL_SIZE_IN_BYTES) ? 0 : (get_instruction_address() & ~(size-1));
+}
+
+static void page_program(void)
+{
+    uint32_t address = get_instruction_address();
+    uint32_t size = instruction_size - 4;
+
+    if (!is_write_enabled)
+    {
+        report_violation("Page Program without Write Enable");
+        return;
+    }
+    if (size > W25Q128FV_PAGE_SIZE_IN_BYTES)
+    {
+        report_violation("Page Program of more than a page");
+    }
+    if (is_busy && (address>=erase_address) && (address<erase_address+erase_size))
+    {
+        report_violation("Page Program into the region being erased");
+    }
+    // NOTE: Like in the real Device, the address wraps around within the page and programming only clears bits.
+    for (uint32_t i=0; i<size; i++)
+    {
+        flash_model_memory[(address & ~0xFFu) | ((address+i) & 0xFFu)] &= instruction[4+i];
+    }
+    is_write_enabled = 0;
+}
+
+/* Executes the Instruction that has just been framed by the CS Pin. */
+static void execute_instruction(void)
+{
+    if (instruction_size == 0)
+    {
+        return;
+    }
+    if (is_busy && !is_suspended && (instruction[0]!=0x05) && (instruction[0]!=0x35) && (instruction[0]!=0x75))
+    {
+        report_violation("Instruction while busy");
+        return;
+    }
+    if (is_busy && is_suspended && ((instruction[0]==0x20) || (instruction[0]==0xD8) || (instruction[0]==0xC7)))
+    {
+        report_violation("erase while another one is suspended");
+        return;
+    }
+    switch (instruction[0])
+    {
+        case 0x06:
+            is_write_enabled = 1;
+            break;
+        case 0x04:
+            is_write_enabled = 0;
+            break;
+        case 0x02:
+            page_program();
+            break;
+        case 0x20:
+            start_erase(W25Q128FV_SECTOR_SIZE_IN_BYTES, SECTOR_ERASE_TIME_IN_MS);
+            break;
+        case 0xD8:
+            start_erase(16*W25Q128FV_SECTOR_SIZE_IN_BYTES, BLOCK_64KB_ERASE_TIME_IN_MS);
+            break;
+        case 0xC7:
+            start_erase(FLASH_MODEL_SIZE_IN_BYTES, CHIP_ERASE_TIME_IN_MS);
+            break;
+        case 0x75:
+            is_suspended = is_busy;
+            break;
+        case 0x7A:
+            is_suspended = 0;
+            break;
+        default:
+            break;
+    }
+}
+
+static void set_cs(GPIO_PinState state)
+{
+    if (state == GPIO_PIN_RESET)
+    {
+        if (is_cs_low)
+        {
+            report_violation("CS set low twice");
+        }
+        is_cs_low = 1;
+        instruction_size = 0;
+        response = RESPONSE_NONE;
+        update_busy();
+    }
+    else
+    {
+        if (!is_cs_low)
+        {
+            report_violation("CS set high twice");
+        }
+        is_cs_low = 0;
+        execute_instruction();
+    }
+}
+
+static void transmit_byte(uint8_t value)
+{
+    if (!is_cs_low)
+    {
+        report_violation("byte sent with CS high");
+    }
+    if (instruction_size >= MAX_INSTRUCTION_SIZE_IN_BYTES)
+    {
+        report_violation("Instruction too long");
+        return;
+    }
+    instruction[instruction_size++] = value;
+    if ((instruction_size==4) && (instruction[0]==0x03))
+    {
+        response = RESPONSE_DATA;
+        read_address = get_instruction_address();
+    }
+    else if ((instruction_size==5) && (instruction[0]==0x0B))
+    {
+        response = RESPONSE_DATA;
+        read_address = get_instruction_address();
+    }
+    else if (instruction_size == 1)
+    {
+        response = (value == 0x9F) ? RESPONSE_JEDEC_ID : (value == 0x05) ? RESPONSE_STATUS_REGISTER_1 : (value == 0x35) ? RESPONSE_STATUS_REGISTER_2 : RESPONSE_NONE;
+        jedec_id_index = 0;
+    }
+}
+
+static uint8_t receive_byte(void)
+{
+    static const uint8_t jedec_id[3] = {0xEF, 0x40, 0x18};
+    uint8_t value;
+
+    if (!is_cs_low)
+    {
+        report_violation("byte received with CS high");
+    }
+    switch (response)
+    {
+        case RESPONSE_DATA:
+            if (is_busy && !is_suspended)
+            {
+                report_violation("read while busy");
+            }
+            if (is_busy && is_suspended && (read_address>=erase_address) && (read_address<erase_address+erase_size))
+            {
+                report_violation("read of the region being erased");
+            }
+            value = flash_model_memory[read_address % FLASH_MODEL_SIZE_IN_BYTES];
+            read_address++;
+            return value;
+        case RESPONSE_JEDEC_ID:
+            return jedec_id[jedec_id_index++ % 3];
+        case RESPONSE_STATUS_REGISTER_1:
+            update_busy();
+            return (uint8_t) ((is_busy && !is_suspended) ? 0x01 : 0x00) | (is_write_enabled ? 0x02 : 0x00);
+        case RESPONSE_STATUS_REGISTER_2:
+            return is_suspended ? 0x80 : 0x00;
+        default:
+            report_violation("byte received without a read Instruction");
+            return 0xAA;
+    }
+}
+
+/* Exchanges one byte, where the Device only listens until the Instruction asks it to answer. */
+static uint8_t exchange_byte(uint8_t value)
+{
+    if (response == RESPONSE_NONE)
+    {
+        transmit_byte(value);
+        return 0xFF;
+    }
+    return receive_byte();
+}
+
+static void complete_pending_transfer(void)
+{
+    pending_t completed = pending;
+
+    switch (pending)
+    {
+        case PENDING_DMA_RECEIVE:
+            for (uint16_t i=0; i<pending_size; i++)
+            {
+                if (dma_write_hook != NULL)
+                {
+                    dma_write_hook(&pending_rx[i], receive_byte());
+                }
+                else
+                {
+                    pending_rx[i] = receive_byte();
+                }
+            }
+            break;
+        case PENDING_IT_TRANSMIT:
+            for (uint16_t i=0; i<pending_size; i++)
+            {
+                transmit_byte(pending_tx[i]);
+            }
+            break;
+        case PENDING_IT_TRANSMIT_RECEIVE:
+            for (uint16_t i=0; i<pending_size; i++)
+            {
+                pending_rx[i] = exchange_byte(pending_tx[i]);
+            }
+            break;
+        default:
+            return;
+    }
+    pending = PENDING_NONE;
+
+    /* Play the role of the SPI interrupt, whose callback runs once the peripheral is ready again. */
+    if (completed == PENDING_DMA_RECEIVE)
+    {
+        HAL_SPI_RxCpltCallback(&flash_model_hspi);
+    }
+    else if (completed == PENDING_IT_TRANSMIT)
+    {
+        HAL_SPI_TxCpltCallback(&flash_model_hspi);
+    }
+    else
+    {
+        HAL_SPI_TxRxCpltCallback(&flash_model_hspi);
+    }
+}
+
+static HAL_StatusTypeDef start_transfer(pending_t kind, uint8_t *tx, uint8_t *rx, uint16_t size)
+{
+    lock_model();
+    if (pending != PENDING_NONE)
+    {
+        unlock_model();
+        return HAL_BUSY;
+    }
+    pending = kind;
+    pending_tx = tx;
+    pending_rx = rx;
+    pending_size = size;
+    if ((kind==PENDING_DMA_RECEIVE) && (dma_start_hook!=NULL))
+    {
+        dma_start_hook(rx, size);
+    }
+    if (!is_dma_deferred)
+    {
+        complete_pending_transfer();
+    }
+    unlock_model();
+    return HAL_OK;
+}
+
+void flash_model_init(void)
+{
+    lock_model();
+    memset(flash_model_memory, 0xFF, sizeof(flash_model_memory));
+    tick = 0;
+    violations = 0;
+    is_cs_low = 0;
+    is_nss_enabled = 0;
+    is_write_enabled = 0;
+    is_busy = 0;
+    is_suspended = 0;
+    instruction_size = 0;
+    response = RESPONSE_NONE;
+    pending = PENDING_NONE;
+    unlock_model();
+
+    peripherals.CS.GPIO_Port = &cs_port;
+    peripherals.CS.GPIO_Pin = GPIO_PIN_6;
+    init_w25q128fv_module(&flash_model_hspi, &peripherals);
+}
+
+unsigned long flash_model_get_violations(void)
+{
+    unsigned long total;
+
+    lock_model();
+    total = violations;
+    unlock_model();
+    return total;
+}
+
+void flash_model_set_deferred_dma(int is_deferred)
+{
+    lock_model();
+    is_dma_deferred = is_deferred;
+    unlock_model();
+}
+
+void flash_model_complete_dma(void)
+{
+    lock_model();
+    complete_pending_transfer();
+    unlock_model();
+}
+
+void flash_model_set_dma_hooks(flash_model_dma_start_hook_t start_hook, flash_model_dma_write_hook_t write_hook)
+{
+    lock_model();
+    dma_start_hook = start_hook;
+    dma_write_hook = write_hook;
+    unlock_model();
+}
+
+void flash_model_set_nss(SPI_HandleTypeDef *hspi, GPIO_PinState state)
+{
+    (void) hspi;
+    lock_model();
+    // NOTE: Setting the SPI enable bit that is already set (or cleared) leaves the NSS output as it is.
+    if ((state==GPIO_PIN_RESET) != is_nss_enabled)
+    {
+        is_nss_enabled = (state == GPIO_PIN_RESET);
+        set_cs(state);
+    }
+    unlock_model();
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    (void) GPIOx;
+    (void) GPIO_Pin;
+    lock_model();
+    set_cs(PinState);
+    unlock_model();
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    lock_model();
+    tick += Delay;
+    update_busy();
+    unlock_model();
+}
+
+uint32_t HAL_GetTick(void)
+{
+    uint32_t current_tick;
+
+    lock_model();
+    current_tick = tick;
+    unlock_model();
+    return current_tick;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) hspi;
+    (void) Timeout;
+    lock_model();
+    for (uint16_t i=0; i<Size; i++)
+    {
+        transmit_byte(pData[i]);
+    }
+    unlock_model();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    (void) hspi;
+    (void) Timeout;
+    lock_model();
+    for (uint16_t i=0; i<Size; i++)
+    {
+        pData[i] = receive_byte();
+    }
+    unlock_model();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout)
+{
+    (void) hspi;
+    (void) Timeout;
+    lock_model();
+    for (uint16_t i=0; i<Size; i++)
+    {
+        pRxData[i] = exchange_byte(pTxData[i]);
+    }
+    unlock_model();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    (void) hspi;
+    return start_transfer(PENDING_IT_TRANSMIT, pData, NULL, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size)
+{
+    (void) hspi;
+    return start_transfer(PENDING_IT_TRANSMIT_RECEIVE, pTxData, pRxData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+    (void) hspi;
+    return start_transfer(PENDING_DMA_RECEIVE, NULL, pData, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+    lock_model();
+    pending = PENDING_NONE;
+    unlock_model();
+    return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi)
+{
+    HAL_SPI_StateTypeDef state = HAL_SPI_STATE_READY;
+
+    (void) hspi;
+    lock_model();
+    // NOTE: Polling a deferred transfer lets it finish, as the real peripheral would do after a while.
+    if (pending != PENDING_NONE)
+    {
+        complete_pending_transfer();
+        state = HAL_SPI_STATE_BUSY;
+    }
+    unlock_model();
+    return state;
+}
+
+uint32_t HAL_SPI_GetError(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+    return HAL_SPI_ERROR_NONE;
+}
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+}
+
+__attribute__((weak)) void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    (void) hspi;
+}
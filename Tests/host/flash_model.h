@@ -0,0 +1,50 @@
+/**@file
+ * @brief	Host model of a W25Q128FV Flash Memory Device behind the STM32 HAL SPI, for the host tests.
+ *
+ * @details The model implements the HAL SPI, GPIO and tick functions declared at stubs/stm32f1xx_hal.h . It decodes
+ *          each Instruction framed by the CS Pin, keeps the 16 MiB array in RAM, only clears bits when programming,
+ *          keeps the Device busy for a number of milliseconds of the HAL tick after each erase, and counts as a
+ *          violation any Instruction that the real Device would reject or misinterpret (e.g., a Page Program without
+ *          Write Enable or a read while an erase is in progress).
+ * @details DMA receptions complete either right away or, with @ref flash_model_set_deferred_dma , only when
+ *          @ref flash_model_complete_dma is called (e.g., from a thread that plays the role of the DMA interrupt), in
+ *          which case @ref HAL_SPI_RxCpltCallback is called from there.
+ */
+
+#ifndef FLASH_MODEL_H
+#define FLASH_MODEL_H
+
+#include "stm32f1xx_hal.h"
+#include "w25q128fv_driver.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FLASH_MODEL_SIZE_IN_BYTES   (16u*1024u*1024u)
+
+/* Fails the current test, from any thread, if a condition does not hold. */
+#define TEST_CHECK(condition)                                                                   \
+    do                                                                                          \
+    {                                                                                           \
+        if (!(condition))                                                                       \
+        {                                                                                       \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);       \
+            exit(1);                                                                            \
+        }                                                                                       \
+    } while (0)
+
+/* Hooks through which a test observes the bytes that the DMA writes into RAM (e.g., to model a data cache). */
+typedef void (*flash_model_dma_start_hook_t)(uint8_t *dst, uint16_t size);
+typedef void (*flash_model_dma_write_hook_t)(uint8_t *dst, uint8_t value);
+
+extern uint8_t flash_model_memory[FLASH_MODEL_SIZE_IN_BYTES];
+extern SPI_HandleTypeDef flash_model_hspi;
+
+/* Erases the whole model, clears its counters and initializes the W25Q128FV Driver module with it. */
+void flash_model_init(void);
+unsigned long flash_model_get_violations(void);
+void flash_model_set_deferred_dma(int is_deferred);
+void flash_model_complete_dma(void);
+void flash_model_set_dma_hooks(flash_model_dma_start_hook_t start_hook, flash_model_dma_write_hook_t write_hook);
+
+#endif /* FLASH_MODEL_H */
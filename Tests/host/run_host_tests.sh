@@ -0,0 +1,73 @@
+#!/bin/sh
+# Builds and runs the host tests of the W25Q128FV modules with gcc (or $CC), which are meant for a Linux or macOS host
+# with POSIX threads. Each test is built from the sources of the modules that it tests, against the HAL and CMSIS-RTOS
+# stand-ins of the stubs folder, and with the sanitizers that it needs.
+#
+# Usage: Tests/host/run_host_tests.sh [test name...]    (e.g., Tests/host/run_host_tests.sh test_dma_cache)
+set -eu
+
+HOST_DIR=$(cd "$(dirname "$0")" && pwd)
+REPO_DIR=$(cd "$HOST_DIR/../.." && pwd)
+BUILD_DIR=${BUILD_DIR:-"$HOST_DIR/build"}
+CC=${CC:-gcc}
+CFLAGS="-std=gnu11 -g -O1 -Wall -Wextra -Wno-unused-parameter -I$HOST_DIR -I$HOST_DIR/stubs -I$REPO_DIR/Inc"
+ASAN="-fsanitize=address,undefined -fno-omit-frame-pointer"
+TSAN="-fsanitize=thread"
+SRC="$REPO_DIR/Src"
+
+mkdir -p "$BUILD_DIR"
+
+build_and_run()
+{
+    name=$1
+    shift
+    echo "== $name"
+    # shellcheck disable=SC2086
+    $CC $CFLAGS "$@" -o "$BUILD_DIR/$name" -lpthread
+    "$BUILD_DIR/$name"
+}
+
+run_test()
+{
+    case $1 in
+        test_dma_cache)
+            build_and_run test_dma_cache $ASAN \
+                -DW25Q128FV_DMA_POLICY=1 -DW25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES=1 \
+                "$HOST_DIR/test_dma_cache.c" "$HOST_DIR/flash_model.c" "$HOST_DIR/dcache_model.c" \
+                "$SRC/w25q128fv_driver.c" "$SRC/w25q128fv_dma.c" "$SRC/w25q128fv_mempool.c"
+            ;;
+        test_extent_churn)
+            build_and_run test_extent_churn $ASAN -DW25Q128FV_EXTENT_MAX_EXTENTS=4 \
+                "$HOST_DIR/test_extent_churn.c" "$HOST_DIR/flash_model.c" "$SRC/w25q128fv_extent.c" "$SRC/w25q128fv_crc32.c" \
+                "$SRC/w25q128fv_driver.c" "$SRC/w25q128fv_dma.c" "$SRC/w25q128fv_mempool.c"
+            ;;
+        test_lsm_remount)
+            build_and_run test_lsm_remount $ASAN \
+                "$HOST_DIR/test_lsm_remount.c" "$HOST_DIR/flash_model.c" "$SRC/w25q128fv_lsm.c" "$SRC/w25q128fv_bloom.c" "$SRC/w25q128fv_scan.c" \
+                "$SRC/w25q128fv_crc32.c" "$SRC/w25q128fv_driver.c" "$SRC/w25q128fv_dma.c" "$SRC/w25q128fv_mempool.c"
+            ;;
+        test_ring_tsan)
+            build_and_run test_ring_tsan $TSAN "$HOST_DIR/test_ring_tsan.c" "$SRC/w25q128fv_ring.c"
+            ;;
+        test_rtos_pthreads)
+            build_and_run test_rtos_pthreads $TSAN \
+                -DW25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES=512 -DW25Q128FV_INTERRUPT_SHORT_COMMANDS=1 \
+                "$HOST_DIR/test_rtos_pthreads.c" "$HOST_DIR/flash_model.c" "$HOST_DIR/stubs/cmsis_os2_pthread.c" \
+                "$SRC/w25q128fv_driver.c" "$SRC/w25q128fv_dma.c" "$SRC/w25q128fv_mempool.c" "$SRC/w25q128fv_ring.c" "$SRC/w25q128fv_rtos.c"
+            ;;
+        *)
+            echo "Unknown test: $1" >&2
+            exit 1
+            ;;
+    esac
+}
+
+if [ $# -eq 0 ]
+then
+    set -- test_dma_cache test_extent_churn test_lsm_remount test_ring_tsan test_rtos_pthreads
+fi
+for test_name in "$@"
+do
+    run_test "$test_name"
+done
+echo "All host tests passed."
@@ -0,0 +1,73 @@
+/**@file
+ * @brief	Host stand-in for the CMSIS-RTOS v2 API, which declares only what the W25Q128FV RTOS Port Layer module and
+ *          its tests use and which is implemented on top of POSIX threads (see cmsis_os2_pthread.c ).
+ */
+
+#ifndef CMSIS_OS2_H_
+#define CMSIS_OS2_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+    osOK                = 0,
+    osError             = -1,
+    osErrorTimeout      = -2,
+    osErrorResource     = -3,
+    osErrorParameter    = -4
+} osStatus_t;
+
+typedef enum
+{
+    osPriorityNormal        = 24,
+    osPriorityAboveNormal   = 32
+} osPriority_t;
+
+typedef void *osThreadId_t;
+typedef void *osMutexId_t;
+typedef void *osSemaphoreId_t;
+typedef void *osMessageQueueId_t;
+typedef void (*osThreadFunc_t)(void *argument);
+
+#define osWaitForever       (0xFFFFFFFFU)
+#define osFlagsWaitAny      (0x00000000U)
+#define osMutexRecursive    (0x00000001U)
+#define osMutexPrioInherit  (0x00000002U)
+
+typedef struct
+{
+    const char *name;
+    uint32_t attr_bits;
+    void *cb_mem;
+    uint32_t cb_size;
+} osMutexAttr_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t attr_bits;
+    void *cb_mem;
+    uint32_t cb_size;
+    void *stack_mem;
+    uint32_t stack_size;
+    osPriority_t priority;
+} osThreadAttr_t;
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osThreadId_t osThreadGetId(void);
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+osStatus_t osDelay(uint32_t ticks);
+uint32_t osKernelGetTickFreq(void);
+osMutexId_t osMutexNew(const osMutexAttr_t *attr);
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout);
+osStatus_t osMutexRelease(osMutexId_t mutex_id);
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const void *attr);
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout);
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id);
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const void *attr);
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+
+#endif /* CMSIS_OS2_H_ */
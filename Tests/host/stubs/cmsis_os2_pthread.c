@@ -0,0 +1,337 @@
+/**@file
+ * @brief	CMSIS-RTOS v2 API implemented on top of POSIX threads, so that the W25Q128FV RTOS Port Layer module can be
+ *          tested on the host.
+ *
+ * @details Every kernel object is guarded by the single @ref kernel_lock , which is enough for tests and keeps each
+ *          function trivially correct. The kernel tick is 1 ms of the host monotonic clock, whereas @ref osDelay also
+ *          advances the tick of the W25Q128FV Flash Memory model via @ref HAL_Delay , so that the Instructions of the
+ *          model progress while the tasks sleep.
+ */
+
+#define _GNU_SOURCE
+#include "cmsis_os2.h"
+#include "stm32f1xx_hal.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+typedef struct
+{
+    pthread_t thread;
+    pthread_cond_t flags_changed;
+    uint32_t flags;
+    osThreadFunc_t func;
+    void *argument;
+} os_thread_t;
+
+typedef struct
+{
+    pthread_cond_t count_changed;
+    uint32_t count;
+    uint32_t max_count;
+} os_semaphore_t;
+
+typedef struct
+{
+    pthread_cond_t changed;
+    uint8_t *messages;
+    uint32_t msg_count;
+    uint32_t msg_size;
+    uint32_t first;
+    uint32_t used;
+} os_message_queue_t;
+
+static pthread_mutex_t kernel_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread os_thread_t *current_thread = NULL;
+
+static void init_cond(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/* Waits on a condition of the kernel lock up to a deadline, where NULL stands for osWaitForever. */
+static int wait_cond(pthread_cond_t *cond, const struct timespec *deadline)
+{
+    if (deadline == NULL)
+    {
+        return pthread_cond_wait(cond, &kernel_lock);
+    }
+    return pthread_cond_timedwait(cond, &kernel_lock, deadline);
+}
+
+static struct timespec *get_deadline(uint32_t timeout, struct timespec *deadline)
+{
+    if (timeout == osWaitForever)
+    {
+        return NULL;
+    }
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += timeout / 1000;
+    deadline->tv_nsec += (long) (timeout % 1000) * 1000000L;
+    if (deadline->tv_nsec >= 1000000000L)
+    {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+    return deadline;
+}
+
+static void *thread_entry(void *argument)
+{
+    os_thread_t *thread = argument;
+
+    current_thread = thread;
+    thread->func(thread->argument);
+    return NULL;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+    os_thread_t *thread = calloc(1, sizeof(*thread));
+
+    (void) attr;
+    if (thread == NULL)
+    {
+        return NULL;
+    }
+    init_cond(&thread->flags_changed);
+    thread->func = func;
+    thread->argument = argument;
+    if (pthread_create(&thread->thread, NULL, thread_entry, thread) != 0)
+    {
+        free(thread);
+        return NULL;
+    }
+    pthread_detach(thread->thread);
+    return thread;
+}
+
+osThreadId_t osThreadGetId(void)
+{
+    // NOTE: Threads that were not created via osThreadNew (e.g., the one of main) get their control block lazily.
+    if (current_thread == NULL)
+    {
+        current_thread = calloc(1, sizeof(*current_thread));
+        init_cond(&current_thread->flags_changed);
+    }
+    return current_thread;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+    os_thread_t *thread = thread_id;
+    uint32_t thread_flags;
+
+    if (thread == NULL)
+    {
+        return (uint32_t) osErrorParameter;
+    }
+    pthread_mutex_lock(&kernel_lock);
+    thread->flags |= flags;
+    thread_flags = thread->flags;
+    pthread_cond_broadcast(&thread->flags_changed);
+    pthread_mutex_unlock(&kernel_lock);
+    return thread_flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    os_thread_t *thread = osThreadGetId();
+    struct timespec deadline_storage;
+    struct timespec *deadline = get_deadline(timeout, &deadline_storage);
+    uint32_t thread_flags;
+
+    (void) options;
+    pthread_mutex_lock(&kernel_lock);
+    while ((thread->flags & flags) == 0)
+    {
+        if (wait_cond(&thread->flags_changed, deadline) == ETIMEDOUT)
+        {
+            pthread_mutex_unlock(&kernel_lock);
+            return (uint32_t) osErrorTimeout;
+        }
+    }
+    thread_flags = thread->flags;
+    thread->flags &= ~flags;
+    pthread_mutex_unlock(&kernel_lock);
+    return thread_flags;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+    HAL_Delay(ticks);
+    sched_yield();
+    return osOK;
+}
+
+uint32_t osKernelGetTickFreq(void)
+{
+    return 1000;
+}
+
+osMutexId_t osMutexNew(const osMutexAttr_t *attr)
+{
+    pthread_mutex_t *mutex = malloc(sizeof(*mutex));
+    pthread_mutexattr_t mutex_attr;
+
+    if (mutex == NULL)
+    {
+        return NULL;
+    }
+    pthread_mutexattr_init(&mutex_attr);
+    if ((attr!=NULL) && (attr->attr_bits&osMutexRecursive))
+    {
+        pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    }
+    else
+    {
+        pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_ERRORCHECK);
+    }
+    pthread_mutex_init(mutex, &mutex_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+    return mutex;
+}
+
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout)
+{
+    (void) timeout;
+    return (pthread_mutex_lock(mutex_id) == 0) ? osOK : osErrorResource;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutex_id)
+{
+    return (pthread_mutex_unlock(mutex_id) == 0) ? osOK : osErrorResource;
+}
+
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const void *attr)
+{
+    os_semaphore_t *semaphore = calloc(1, sizeof(*semaphore));
+
+    (void) attr;
+    if (semaphore == NULL)
+    {
+        return NULL;
+    }
+    init_cond(&semaphore->count_changed);
+    semaphore->count = initial_count;
+    semaphore->max_count = max_count;
+    return semaphore;
+}
+
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout)
+{
+    os_semaphore_t *semaphore = semaphore_id;
+    struct timespec deadline_storage;
+    struct timespec *deadline = get_deadline(timeout, &deadline_storage);
+
+    pthread_mutex_lock(&kernel_lock);
+    while (semaphore->count == 0)
+    {
+        if ((timeout==0) || (wait_cond(&semaphore->count_changed, deadline)==ETIMEDOUT))
+        {
+            pthread_mutex_unlock(&kernel_lock);
+            return (timeout == 0) ? osErrorResource : osErrorTimeout;
+        }
+    }
+    semaphore->count--;
+    pthread_mutex_unlock(&kernel_lock);
+    return osOK;
+}
+
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id)
+{
+    os_semaphore_t *semaphore = semaphore_id;
+    osStatus_t status = osOK;
+
+    pthread_mutex_lock(&kernel_lock);
+    if (semaphore->count < semaphore->max_count)
+    {
+        semaphore->count++;
+        pthread_cond_broadcast(&semaphore->count_changed);
+    }
+    else
+    {
+        status = osErrorResource;
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return status;
+}
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const void *attr)
+{
+    os_message_queue_t *queue = calloc(1, sizeof(*queue));
+
+    (void) attr;
+    if (queue == NULL)
+    {
+        return NULL;
+    }
+    queue->messages = malloc(msg_count * msg_size);
+    if (queue->messages == NULL)
+    {
+        free(queue);
+        return NULL;
+    }
+    init_cond(&queue->changed);
+    queue->msg_count = msg_count;
+    queue->msg_size = msg_size;
+    return queue;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+    os_message_queue_t *queue = mq_id;
+    struct timespec deadline_storage;
+    struct timespec *deadline = get_deadline(timeout, &deadline_storage);
+
+    (void) msg_prio;
+    pthread_mutex_lock(&kernel_lock);
+    while (queue->used == queue->msg_count)
+    {
+        if ((timeout==0) || (wait_cond(&queue->changed, deadline)==ETIMEDOUT))
+        {
+            pthread_mutex_unlock(&kernel_lock);
+            return (timeout == 0) ? osErrorResource : osErrorTimeout;
+        }
+    }
+    memcpy(&queue->messages[((queue->first+queue->used) % queue->msg_count) * queue->msg_size], msg_ptr, queue->msg_size);
+    queue->used++;
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&kernel_lock);
+    return osOK;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+    os_message_queue_t *queue = mq_id;
+    struct timespec deadline_storage;
+    struct timespec *deadline = get_deadline(timeout, &deadline_storage);
+
+    pthread_mutex_lock(&kernel_lock);
+    while (queue->used == 0)
+    {
+        if ((timeout==0) || (wait_cond(&queue->changed, deadline)==ETIMEDOUT))
+        {
+            pthread_mutex_unlock(&kernel_lock);
+            return (timeout == 0) ? osErrorResource : osErrorTimeout;
+        }
+    }
+    memcpy(msg_ptr, &queue->messages[queue->first * queue->msg_size], queue->msg_size);
+    queue->first = (queue->first + 1) % queue->msg_count;
+    queue->used--;
+    if (msg_prio != NULL)
+    {
+        *msg_prio = 0;
+    }
+    pthread_cond_broadcast(&queue->changed);
+    pthread_mutex_unlock(&kernel_lock);
+    return osOK;
+}
@@ -0,0 +1,90 @@
+/**@file
+ * @brief	Host stand-in for the STM32F1 HAL, which declares only what the W25Q128FV modules use.
+ *
+ * @details The SPI, GPIO and tick functions are implemented by the W25Q128FV Flash Memory model (see
+ *          flash_model.c ), whereas the cache maintenance functions of the Cortex-M7 are implemented by the data cache
+ *          model (see dcache_model.c ) of the tests that need it.
+ */
+
+#ifndef STM32F1XX_HAL_H
+#define STM32F1XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+    HAL_SPI_STATE_RESET     = 0x00U,
+    HAL_SPI_STATE_READY     = 0x01U,
+    HAL_SPI_STATE_BUSY      = 0x02U,
+    HAL_SPI_STATE_BUSY_TX   = 0x03U,
+    HAL_SPI_STATE_BUSY_RX   = 0x04U,
+    HAL_SPI_STATE_BUSY_TX_RX= 0x05U
+} HAL_SPI_StateTypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct
+{
+    uint32_t CR1;
+} SPI_TypeDef;
+
+typedef struct
+{
+    SPI_TypeDef *Instance;
+} SPI_HandleTypeDef;
+
+typedef struct
+{
+    uint32_t ODR;
+} GPIO_TypeDef;
+
+#define GPIO_PIN_6          ((uint16_t) 0x0040)
+#define HAL_MAX_DELAY       (0xFFFFFFFFU)
+#define HAL_SPI_ERROR_NONE  (0x00000000U)
+#define SPI_CR1_SPE         (0x00000040U)
+
+/* The SPI enable bit drives the NSS output when the W25Q128FV_HARDWARE_NSS option is used. */
+void flash_model_set_nss(SPI_HandleTypeDef *hspi, GPIO_PinState state);
+#define __HAL_SPI_ENABLE(__HANDLE__)    flash_model_set_nss((__HANDLE__), GPIO_PIN_RESET)
+#define __HAL_SPI_DISABLE(__HANDLE__)   flash_model_set_nss((__HANDLE__), GPIO_PIN_SET)
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_IT(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_IT(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi);
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi);
+uint32_t HAL_SPI_GetError(SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+/* Interrupt masking, which the tests do not need since they never run code from a real interrupt. */
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t priMask) { (void) priMask; }
+static inline void __disable_irq(void) { }
+static inline void __enable_irq(void) { }
+
+/* Cortex-M7 data cache maintenance by address, which only the tests of the DMA buffer policy implement. */
+void SCB_CleanDCache_by_Addr(void *addr, int32_t dsize);
+void SCB_InvalidateDCache_by_Addr(void *addr, int32_t dsize);
+
+#endif /* STM32F1XX_HAL_H */
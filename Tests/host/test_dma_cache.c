@@ -0,0 +1,185 @@
+/**@file
+ * @brief	Host test of the cache-coherent DMA buffer policy of the W25Q128FV DMA Buffer Policy module.
+ *
+ * @details Every read of the W25Q128FV Driver module is received via DMA (i.e., W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES
+ *          is 1) through the data cache model (see dcache_model.h ), with the W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE
+ *          policy, into buffers of random alignments and sizes whose surrounding bytes are dirty canaries of the CPU.
+ *          The test checks that the CPU sees the data of the W25Q128FV Device rather than stale lines, that no canary
+ *          is lost by invalidating a line that the buffer only partially covers, that every cache operation covers
+ *          whole lines and that every bounce buffer is given back to the memory pool. Every fifth read, and a write,
+ *          are made while the memory pool is exhausted, which the W25Q128FV Driver module must survive.
+ *
+ * @details It first checks that the model does catch a DMA reception made without any cache maintenance, since
+ *          otherwise the rest of the test would prove nothing.
+ */
+
+#include "flash_model.h"
+#include "dcache_model.h"
+#include "w25q128fv_dma.h"
+#include "w25q128fv_mempool.h"
+#include <string.h>
+
+#if W25Q128FV_DMA_POLICY != W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE
+#error "This test must be built with W25Q128FV_DMA_POLICY set to W25Q128FV_DMA_POLICY_CACHE_MAINTENANCE."
+#endif
+#if W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES != 1
+#error "This test must be built with W25Q128FV_DMA_READ_MIN_SIZE_IN_BYTES set to 1."
+#endif
+
+#define CANARY              (0x5A)
+#define AREA_SIZE_IN_BYTES  (8192)
+#define TOTAL_ITERATIONS    (400)
+
+static uint8_t area[AREA_SIZE_IN_BYTES] __attribute__ ((aligned (DCACHE_MODEL_LINE_SIZE_IN_BYTES)));
+static uint32_t stream_address;
+static uint32_t stream_received;
+static unsigned long stream_mismatches;
+static void *held_blocks[W25Q128FV_MEMPOOL_TOTAL_BLOCKS];
+
+static W25Q128FV_Status check_stream_chunk(uint8_t *chunk, uint16_t size)
+{
+    if (memcmp(chunk, &flash_model_memory[stream_address+stream_received], size) != 0)
+    {
+        stream_mismatches++;
+    }
+    stream_received += size;
+    return W25Q128FV_EC_OK;
+}
+
+/* Leaves the area in RAM with a pattern other than the canary, and then has the CPU write the canary into its cache. */
+static void prepare_area(void)
+{
+    dcache_model_enable();
+    memset(area, 0x00, sizeof(area));
+    dcache_model_cpu_write(area, CANARY, sizeof(area));
+}
+
+/* Takes every block of the memory pool (i.e., 1) or gives all of them back (i.e., 0). */
+static void set_pool_exhausted(int is_exhausted)
+{
+    for (int i=0; i<W25Q128FV_MEMPOOL_TOTAL_BLOCKS; i++)
+    {
+        if (is_exhausted)
+        {
+            held_blocks[i] = w25q128fv_mempool_alloc();
+            TEST_CHECK(held_blocks[i] != NULL);
+        }
+        else
+        {
+            w25q128fv_mempool_free(held_blocks[i]);
+        }
+    }
+    if (is_exhausted)
+    {
+        TEST_CHECK(w25q128fv_mempool_alloc() == NULL);
+    }
+}
+
+static void check_model_catches_missing_maintenance(void)
+{
+    uint8_t read_data_instruction[4] = {0x03, 0x00, 0x00, 0x00};
+
+    prepare_area();
+    HAL_GPIO_WritePin(NULL, GPIO_PIN_6, GPIO_PIN_RESET);
+    HAL_SPI_Transmit(&flash_model_hspi, read_data_instruction, 4, HAL_MAX_DELAY);
+    TEST_CHECK(HAL_SPI_Receive_DMA(&flash_model_hspi, area, 256) == HAL_OK);
+    HAL_GPIO_WritePin(NULL, GPIO_PIN_6, GPIO_PIN_SET);
+    TEST_CHECK(memcmp(area, flash_model_memory, 256) != 0);
+}
+
+int main(void)
+{
+    unsigned int seed = 3;
+    unsigned long stale_reads = 0;
+    unsigned long lost_canaries = 0;
+    W25Q128FV_mempool_stats_t mempool_stats;
+
+    flash_model_init();
+    for (uint32_t i=0; i<65536; i++)
+    {
+        flash_model_memory[i] = (uint8_t) rand_r(&seed);
+    }
+    check_model_catches_missing_maintenance();
+
+    for (int iteration=0; iteration<TOTAL_ITERATIONS; iteration++)
+    {
+        uint32_t offset = (uint32_t) rand_r(&seed) % 64;
+        uint32_t size = 1 + (uint32_t) rand_r(&seed) % (((iteration%4) == 0) ? 40 : 3000);
+        uint32_t address = (uint32_t) rand_r(&seed) % 60000;
+        uint8_t expected[3000];
+        W25Q128FV_Status status;
+
+        prepare_area();
+        memcpy(expected, &flash_model_memory[address], size);
+        if ((iteration % 5) == 4)
+        {
+            set_pool_exhausted(1);
+        }
+        switch (iteration % 3)
+        {
+            case 0:
+                status = w25q128fv_read_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, address%W25Q128FV_PAGE_SIZE_IN_BYTES, size, &area[offset]);
+                break;
+            case 1:
+                status = w25q128fv_fast_read_flash_memory(address/W25Q128FV_PAGE_SIZE_IN_BYTES, address%W25Q128FV_PAGE_SIZE_IN_BYTES, size, &area[offset]);
+                break;
+            default:
+            {
+                /* Two ranges with a gap between them on the W25Q128FV Device, but next to each other in RAM. */
+                W25Q128FV_read_entry_t entries[2] = {{address, size/2, &area[offset]}, {address+size/2+20, size-size/2, &area[offset+size/2]}};
+
+                memcpy(&expected[size/2], &flash_model_memory[address+size/2+20], size-size/2);
+                status = w25q128fv_readv(entries, 2);
+                break;
+            }
+        }
+        if ((iteration % 5) == 4)
+        {
+            set_pool_exhausted(0);
+        }
+        TEST_CHECK(status == W25Q128FV_EC_OK);
+        if (memcmp(&area[offset], expected, size) != 0)
+        {
+            stale_reads++;
+        }
+        for (uint32_t i=0; i<offset; i++)
+        {
+            lost_canaries += (area[i] != CANARY);
+        }
+        for (uint32_t i=offset+size; i<offset+size+64; i++)
+        {
+            lost_canaries += (area[i] != CANARY);
+        }
+    }
+
+    for (int iteration=0; iteration<50; iteration++)
+    {
+        stream_address = (uint32_t) rand_r(&seed) % 60000;
+        stream_received = 0;
+        prepare_area();
+        uint32_t size = 1 + (uint32_t) rand_r(&seed) % 3000;
+        TEST_CHECK(w25q128fv_stream_read(stream_address, size, check_stream_chunk) == W25Q128FV_EC_OK);
+        TEST_CHECK(stream_received == size);
+    }
+
+    /* A Page Program Instruction is formulated in the own buffer of the driver while the memory pool is exhausted. */
+    memset(&flash_model_memory[65536], 0xFF, W25Q128FV_PAGE_SIZE_IN_BYTES);
+    memset(area, 0xA5, W25Q128FV_PAGE_SIZE_IN_BYTES);
+    set_pool_exhausted(1);
+    TEST_CHECK(w25q128fv_write_flash_memory(65536/W25Q128FV_PAGE_SIZE_IN_BYTES, 0, W25Q128FV_PAGE_SIZE_IN_BYTES, area) == W25Q128FV_EC_OK);
+    set_pool_exhausted(0);
+    TEST_CHECK(memcmp(&flash_model_memory[65536], area, W25Q128FV_PAGE_SIZE_IN_BYTES) == 0);
+
+    w25q128fv_mempool_get_stats(&mempool_stats);
+    printf("stale reads=%lu, lost canaries=%lu, stream mismatches=%lu, invalidations=%lu, misaligned operations=%lu, pool blocks in use=%lu\n",
+           stale_reads, lost_canaries, stream_mismatches, dcache_model_get_invalidations(), dcache_model_get_misaligned_operations(), (unsigned long) mempool_stats.used_blocks);
+    TEST_CHECK(stale_reads == 0);
+    TEST_CHECK(lost_canaries == 0);
+    TEST_CHECK(stream_mismatches == 0);
+    TEST_CHECK(dcache_model_get_misaligned_operations() == 0);
+    TEST_CHECK(mempool_stats.used_blocks == 0);
+    TEST_CHECK(flash_model_get_violations() == 0);
+    printf("test_dma_cache: OK\n");
+
+    return 0;
+}
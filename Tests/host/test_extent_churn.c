@@ -0,0 +1,229 @@
+/**@file
+ * @brief	Host test that churns the allocations, frees, commits, defragmentation slices and remounts of the W25Q128FV
+ *          Extent Allocator module.
+ *
+ * @details The test is built with a small W25Q128FV_EXTENT_MAX_EXTENTS so that the blobs that are freed after a commit,
+ *          whose Sectors stay allocated until the next commit, make the runs of allocated Sectors outnumber the extents
+ *          of the allocation table, which is where the free extents used to outnumber their pool of nodes. Every blob
+ *          holds its ID at the beginning of its first Page, and the test keeps its own model of the blobs that were
+ *          allocated and of those that were committed, so that each remount checks that exactly the committed blobs
+ *          came back with their data and that no Sector was lost or counted twice.
+ *
+ * @details Before the random churn, the test builds a layout with more free extents than the allocation table has
+ *          entries: all the committed blobs are freed and, behind them, new blobs are alternated with the holes left
+ *          by freeing uncommitted ones.
+ *
+ * @details Some of the defragmentation slices are run while the test holds every block of the memory pool, which the
+ *          page copies of the defragmentation must survive.
+ */
+
+#include "flash_model.h"
+#include "w25q128fv_extent.h"
+#include "w25q128fv_mempool.h"
+#include <string.h>
+
+#if W25Q128FV_EXTENT_MAX_EXTENTS != 4
+#error "This test must be built with W25Q128FV_EXTENT_MAX_EXTENTS set to 4."
+#endif
+
+#define FIRST_SECTOR        (64)
+#define TOTAL_SECTORS       (2 + 48)
+#define TOTAL_BLOB_IDS      (2*W25Q128FV_EXTENT_MAX_EXTENTS)
+#define TOTAL_ITERATIONS    (20000)
+
+typedef struct {
+    uint8_t is_live;
+    uint32_t size;
+} blob_model_t;
+
+static W25Q128FV_extent_def_t extent_def = {FIRST_SECTOR, TOTAL_SECTORS};
+static blob_model_t live_blobs[TOTAL_BLOB_IDS];
+static blob_model_t committed_blobs[TOTAL_BLOB_IDS];
+static void *held_blocks[W25Q128FV_MEMPOOL_TOTAL_BLOCKS];
+
+/* Allocates a blob and writes its ID at the beginning of its first Page. */
+static W25Q128FV_Status allocate_blob(uint32_t blob_id, uint32_t size)
+{
+    W25Q128FV_extent_t extent;
+    W25Q128FV_Status status = w25q128fv_extent_allocate(blob_id, size, &extent);
+
+    if (status == W25Q128FV_EC_OK)
+    {
+        TEST_CHECK(extent.total_sectors == ((size + W25Q128FV_SECTOR_SIZE_IN_BYTES - 1) / W25Q128FV_SECTOR_SIZE_IN_BYTES));
+        TEST_CHECK(w25q128fv_extent_erase(&extent) == W25Q128FV_EC_OK);
+        TEST_CHECK(w25q128fv_write_flash_memory(extent.first_sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, sizeof(blob_id), (uint8_t *) &blob_id) == W25Q128FV_EC_OK);
+        live_blobs[blob_id].is_live = 1;
+        live_blobs[blob_id].size = size;
+    }
+
+    return status;
+}
+
+static void free_blob(uint32_t blob_id)
+{
+    TEST_CHECK(w25q128fv_extent_free(blob_id) == W25Q128FV_EC_OK);
+    live_blobs[blob_id].is_live = 0;
+}
+
+static void commit(void)
+{
+    TEST_CHECK(w25q128fv_extent_commit() == W25Q128FV_EC_OK);
+    memcpy(committed_blobs, live_blobs, sizeof(committed_blobs));
+}
+
+/* Takes every block of the memory pool (i.e., 1) or gives all of them back (i.e., 0). */
+static void set_pool_exhausted(int is_exhausted)
+{
+    for (int i=0; i<W25Q128FV_MEMPOOL_TOTAL_BLOCKS; i++)
+    {
+        if (is_exhausted)
+        {
+            held_blocks[i] = w25q128fv_mempool_alloc();
+            TEST_CHECK(held_blocks[i] != NULL);
+        }
+        else
+        {
+            w25q128fv_mempool_free(held_blocks[i]);
+        }
+    }
+    if (is_exhausted)
+    {
+        TEST_CHECK(w25q128fv_mempool_alloc() == NULL);
+    }
+}
+
+/* Mounts the region again and checks that it holds exactly the committed blobs, each with its ID in its first Page. */
+static void remount_and_check(void)
+{
+    uint32_t used_sectors = 0;
+    uint32_t free_sectors;
+    uint32_t largest_free_extent;
+
+    TEST_CHECK(init_w25q128fv_extent_module(&extent_def) == W25Q128FV_EC_OK);
+    TEST_CHECK(w25q128fv_extent_mount() == W25Q128FV_EC_OK);
+    for (uint32_t blob_id=0; blob_id<TOTAL_BLOB_IDS; blob_id++)
+    {
+        W25Q128FV_extent_t extent;
+        W25Q128FV_Status status = w25q128fv_extent_find(blob_id, &extent);
+
+        live_blobs[blob_id] = committed_blobs[blob_id];
+        if (!committed_blobs[blob_id].is_live)
+        {
+            TEST_CHECK(status == W25Q128FV_EC_NA);
+            continue;
+        }
+        TEST_CHECK(status == W25Q128FV_EC_OK);
+        TEST_CHECK(extent.size == committed_blobs[blob_id].size);
+        TEST_CHECK(memcmp(&flash_model_memory[extent.first_sector*W25Q128FV_SECTOR_SIZE_IN_BYTES], &blob_id, sizeof(blob_id)) == 0);
+        used_sectors += extent.total_sectors;
+    }
+    w25q128fv_extent_get_free_space(&free_sectors, &largest_free_extent);
+    TEST_CHECK(free_sectors == (TOTAL_SECTORS - 2 - used_sectors));
+    TEST_CHECK(largest_free_extent <= free_sectors);
+}
+
+/* Leaves 6 free extents, which is 2 more than the allocation table has entries, while the 4 committed blobs are freed. */
+static void fragment_behind_pending_frees(void)
+{
+    /* Commit blobs of 1, 2, 3 and 4 Sectors, the first three after a hole left by freeing an uncommitted blob of their own size. */
+    for (uint32_t blob_id=0; blob_id<4; blob_id++)
+    {
+        if (blob_id != 3)
+        {
+            TEST_CHECK(allocate_blob(4, (blob_id+1)*W25Q128FV_SECTOR_SIZE_IN_BYTES) == W25Q128FV_EC_OK);
+        }
+        TEST_CHECK(allocate_blob(blob_id, (blob_id+1)*W25Q128FV_SECTOR_SIZE_IN_BYTES) == W25Q128FV_EC_OK);
+        if (blob_id != 3)
+        {
+            free_blob(4);
+        }
+    }
+    commit();
+
+    /* Free them all, which keeps their Sectors until the next commit, and alternate new blobs with holes larger than the previous ones. */
+    for (uint32_t blob_id=0; blob_id<4; blob_id++)
+    {
+        free_blob(blob_id);
+    }
+    for (uint32_t blob_id=4; blob_id<8; blob_id+=2)
+    {
+        TEST_CHECK(allocate_blob(blob_id, (blob_id+1)*W25Q128FV_SECTOR_SIZE_IN_BYTES) == W25Q128FV_EC_OK);
+        TEST_CHECK(allocate_blob(blob_id+1, (blob_id+1)*W25Q128FV_SECTOR_SIZE_IN_BYTES) == W25Q128FV_EC_OK);
+        free_blob(blob_id);
+    }
+    commit();
+    remount_and_check();
+}
+
+int main(void)
+{
+    unsigned int seed = 5;
+    unsigned long allocations = 0;
+    unsigned long commits = 0;
+    unsigned long remounts = 0;
+    unsigned long exhausted_slices = 0;
+
+    flash_model_init();
+    TEST_CHECK(init_w25q128fv_extent_module(&extent_def) == W25Q128FV_EC_OK);
+    TEST_CHECK(w25q128fv_extent_format() == W25Q128FV_EC_OK);
+    fragment_behind_pending_frees();
+
+    for (int iteration=0; iteration<TOTAL_ITERATIONS; iteration++)
+    {
+        uint32_t blob_id = (uint32_t) rand_r(&seed) % TOTAL_BLOB_IDS;
+        uint32_t operation = (uint32_t) rand_r(&seed) % 100;
+
+        if (operation < 45)
+        {
+            /* Allocate a blob of up to 3 Sectors, or free it if it already exists. */
+            if (live_blobs[blob_id].is_live)
+            {
+                free_blob(blob_id);
+            }
+            else if (allocate_blob(blob_id, 1 + (uint32_t) rand_r(&seed) % (3*W25Q128FV_SECTOR_SIZE_IN_BYTES)) == W25Q128FV_EC_OK)
+            {
+                allocations++;
+            }
+        }
+        else if (operation < 60)
+        {
+            /* Free a blob, which postpones the reuse of its Sectors until the next commit if it was committed. */
+            if (live_blobs[blob_id].is_live)
+            {
+                free_blob(blob_id);
+            }
+        }
+        else if (operation < 75)
+        {
+            commit();
+            commits++;
+        }
+        else if (operation < 97)
+        {
+            uint8_t is_compacted;
+            int is_pool_exhausted = (operation >= 90);
+
+            if (is_pool_exhausted)
+            {
+                set_pool_exhausted(1);
+                exhausted_slices++;
+            }
+            TEST_CHECK(w25q128fv_extent_defrag_run_slice(50, &is_compacted) == W25Q128FV_EC_OK);
+            if (is_pool_exhausted)
+            {
+                set_pool_exhausted(0);
+            }
+        }
+        else
+        {
+            remount_and_check();
+            remounts++;
+        }
+    }
+    commit();
+    remount_and_check();
+    TEST_CHECK(flash_model_get_violations() == 0);
+
+    printf("test_extent_churn: OK (%lu allocations, %lu commits, %lu remounts, %lu slices with the pool exhausted)\n", allocations, commits, remounts, exhausted_slices);
+    return 0;
+}
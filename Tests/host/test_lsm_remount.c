@@ -0,0 +1,159 @@
+/**@file
+ * @brief	Host test that remounts the W25Q128FV LSM Sorted Runs module between flushes and merge compaction slices.
+ *
+ * @details Every round puts and deletes random keys, flushes them as a new sorted run and then runs a random number of
+ *          merge compaction slices, which leaves merges interrupted at any of their steps. Every few rounds the store is
+ *          mounted again, and every key is checked against the test's own model of the flushed values.
+ *
+ * @details The test also plays a power loss right after a merged run is committed: when a slice invalidates the
+ *          headers of the two merged runs, the test sometimes writes their magic back into the flash model and mounts
+ *          the store at once, which must drop those stale runs again and leave no valid header behind.
+ */
+
+#include "flash_model.h"
+#include "w25q128fv_lsm.h"
+#include <string.h>
+
+#define FIRST_SECTOR        (256)
+#define TOTAL_SECTORS       (96)
+#define TOTAL_KEYS          (1000)
+#define TOTAL_ROUNDS        (400)
+#define RUN_MAGIC           (0x4D534C57)
+#define NO_VALUE            (W25Q128FV_LSM_TOMBSTONE)
+
+static W25Q128FV_lsm_def_t lsm_def = {FIRST_SECTOR, TOTAL_SECTORS};
+static uint32_t pending_values[TOTAL_KEYS];
+static uint32_t flushed_values[TOTAL_KEYS];
+
+static uint32_t read_magic(uint32_t sector)
+{
+    uint32_t magic;
+
+    memcpy(&magic, &flash_model_memory[(FIRST_SECTOR+sector)*W25Q128FV_SECTOR_SIZE_IN_BYTES], sizeof(magic));
+    return magic;
+}
+
+/* Mounts the store again, which loses the memtable, and checks every key against the flushed values. */
+static void remount_and_check(void)
+{
+    TEST_CHECK(init_w25q128fv_lsm_module(&lsm_def) == W25Q128FV_EC_OK);
+    TEST_CHECK(w25q128fv_lsm_mount() == W25Q128FV_EC_OK);
+    memcpy(pending_values, flushed_values, sizeof(pending_values));
+    for (uint32_t key=0; key<TOTAL_KEYS; key++)
+    {
+        uint32_t value = NO_VALUE;
+        W25Q128FV_Status status = w25q128fv_lsm_get(key, &value);
+
+        if (flushed_values[key] == NO_VALUE)
+        {
+            TEST_CHECK(status == W25Q128FV_EC_NA);
+        }
+        else
+        {
+            TEST_CHECK(status == W25Q128FV_EC_OK);
+            TEST_CHECK(value == flushed_values[key]);
+        }
+    }
+}
+
+/* Runs one merge compaction slice, lets some time pass as other tasks would and, if the slice invalidated run headers, sometimes restores them and mounts at once. */
+static void run_slice(unsigned int *seed, unsigned long *restored_headers)
+{
+    uint32_t magics[TOTAL_SECTORS];
+    uint8_t is_restored[TOTAL_SECTORS] = {0};
+    uint32_t restored = 0;
+    uint8_t is_compacted;
+
+    for (uint32_t sector=0; sector<TOTAL_SECTORS; sector++)
+    {
+        magics[sector] = read_magic(sector);
+    }
+    TEST_CHECK(w25q128fv_lsm_compact_run_slice(1 + (uint32_t) rand_r(seed)%40, &is_compacted) == W25Q128FV_EC_OK);
+    HAL_Delay((uint32_t) rand_r(seed) % 100);
+    if ((rand_r(seed) % 2) == 0)
+    {
+        return;
+    }
+    for (uint32_t sector=0; sector<TOTAL_SECTORS; sector++)
+    {
+        if ((magics[sector]==RUN_MAGIC) && (read_magic(sector)==0))
+        {
+            memcpy(&flash_model_memory[(FIRST_SECTOR+sector)*W25Q128FV_SECTOR_SIZE_IN_BYTES], &magics[sector], sizeof(magics[sector]));
+            is_restored[sector] = 1;
+            restored++;
+        }
+    }
+    if (restored != 0)
+    {
+        *restored_headers += restored;
+        remount_and_check();
+        for (uint32_t sector=0; sector<TOTAL_SECTORS; sector++)
+        {
+            TEST_CHECK((is_restored[sector]==0) || (read_magic(sector)!=RUN_MAGIC));
+        }
+    }
+}
+
+int main(void)
+{
+    unsigned int seed = 7;
+    unsigned long flushes = 0;
+    unsigned long remounts = 0;
+    unsigned long restored_headers = 0;
+
+    flash_model_init();
+    memset(flushed_values, 0xFF, sizeof(flushed_values));
+    memset(pending_values, 0xFF, sizeof(pending_values));
+    TEST_CHECK(init_w25q128fv_lsm_module(&lsm_def) == W25Q128FV_EC_OK);
+    TEST_CHECK(w25q128fv_lsm_format() == W25Q128FV_EC_OK);
+
+    for (int round=0; round<TOTAL_ROUNDS; round++)
+    {
+        uint32_t total_slices = (uint32_t) rand_r(&seed) % 6;
+        uint32_t total_updates = 1 + (uint32_t) rand_r(&seed) % (W25Q128FV_LSM_MEMTABLE_ENTRIES/2);
+        uint32_t flush_attempts = 0;
+        W25Q128FV_Status status;
+
+        /* Put or delete fewer keys than the memtable holds, so that only the explicit flush writes a run. */
+        for (uint32_t i=0; i<total_updates; i++)
+        {
+            uint32_t key = (uint32_t) rand_r(&seed) % TOTAL_KEYS;
+
+            if ((rand_r(&seed) % 4) == 0)
+            {
+                TEST_CHECK(w25q128fv_lsm_delete(key) == W25Q128FV_EC_OK);
+                pending_values[key] = NO_VALUE;
+            }
+            else
+            {
+                pending_values[key] = (uint32_t) round*TOTAL_KEYS + key;
+                TEST_CHECK(w25q128fv_lsm_put(key, pending_values[key]) == W25Q128FV_EC_OK);
+            }
+        }
+
+        /* Flush, compacting first for as long as the region has no room for another run. */
+        while ((status = w25q128fv_lsm_flush()) == W25Q128FV_EC_ERR)
+        {
+            TEST_CHECK(++flush_attempts < 1000);
+            run_slice(&seed, &restored_headers);
+        }
+        TEST_CHECK(status == W25Q128FV_EC_OK);
+        memcpy(flushed_values, pending_values, sizeof(flushed_values));
+        flushes++;
+
+        for (uint32_t slice=0; slice<total_slices; slice++)
+        {
+            run_slice(&seed, &restored_headers);
+        }
+        if ((round % 7) == 6)
+        {
+            remount_and_check();
+            remounts++;
+        }
+    }
+    remount_and_check();
+    TEST_CHECK(flash_model_get_violations() == 0);
+
+    printf("test_lsm_remount: OK (%lu flushes, %lu remounts, %lu restored headers)\n", flushes, remounts, restored_headers);
+    return 0;
+}
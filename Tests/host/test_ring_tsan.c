@@ -0,0 +1,157 @@
+/**@file
+ * @brief	Host test, under ThreadSanitizer, of the lock-free request ring of the W25Q128FV Request Ring module.
+ *
+ * @details A producer thread pushes requests of every type, whose data it writes right before pushing them, while a
+ *          consumer thread drains them in batches of random sizes into stand-ins of the functions of the W25Q128FV
+ *          Driver module. The test checks that every request is executed exactly once, in the order in which it was
+ *          pushed, with the type, numbers and data that the producer wrote, and ThreadSanitizer checks that the head
+ *          and tail indexes do publish the descriptors and their data between both threads.
+ */
+
+#include "flash_model.h"
+#include "w25q128fv_ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#define TOTAL_REQUESTS      (200000u)
+#define DATA_SIZE_IN_BYTES  (8u)
+#define TOTAL_TYPES         (5u)
+
+static uint8_t data[TOTAL_REQUESTS][DATA_SIZE_IN_BYTES];
+static W25Q128FV_ring_t ring;
+static uint32_t next_expected;
+static uint32_t total_done;
+static uint32_t total_full;
+
+/* Checks that the request being executed is the next one that the producer pushed. */
+static W25Q128FV_Status check_request(uint8_t type, uint32_t number, uint8_t page_bytes_offset, uint32_t size, uint8_t *request_data)
+{
+    uint32_t sequence = next_expected;
+
+    TEST_CHECK(number == sequence);
+    TEST_CHECK(type == (sequence % TOTAL_TYPES));
+    if (request_data != NULL)
+    {
+        TEST_CHECK(page_bytes_offset == (uint8_t) sequence);
+        TEST_CHECK(size == DATA_SIZE_IN_BYTES);
+        TEST_CHECK(request_data == data[sequence]);
+        for (uint32_t i=0; i<DATA_SIZE_IN_BYTES; i++)
+        {
+            TEST_CHECK(request_data[i] == (uint8_t) (sequence + i));
+        }
+    }
+    next_expected++;
+
+    return W25Q128FV_EC_OK;
+}
+
+W25Q128FV_Status w25q128fv_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst)
+{
+    return check_request(W25Q128FV_RING_REQUEST_READ, start_page, page_bytes_offset, size, dst);
+}
+
+W25Q128FV_Status w25q128fv_fast_read_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *dst)
+{
+    return check_request(W25Q128FV_RING_REQUEST_FAST_READ, start_page, page_bytes_offset, size, dst);
+}
+
+W25Q128FV_Status w25q128fv_write_flash_memory(uint32_t start_page, uint8_t page_bytes_offset, uint32_t size, uint8_t *src)
+{
+    return check_request(W25Q128FV_RING_REQUEST_WRITE, start_page, page_bytes_offset, size, src);
+}
+
+W25Q128FV_Status w25q128fv_erase_sector(uint32_t sector_number)
+{
+    return check_request(W25Q128FV_RING_REQUEST_ERASE_SECTOR, sector_number, 0, 0, NULL);
+}
+
+W25Q128FV_Status w25q128fv_erase_block_64kb(uint32_t block_number)
+{
+    return check_request(W25Q128FV_RING_REQUEST_ERASE_BLOCK_64KB, block_number, 0, 0, NULL);
+}
+
+static void on_done(const W25Q128FV_ring_request_t *request, W25Q128FV_Status status)
+{
+    TEST_CHECK(status == W25Q128FV_EC_OK);
+    TEST_CHECK(request->number == total_done);
+    total_done++;
+}
+
+static void *producer(void *argument)
+{
+    (void) argument;
+    for (uint32_t sequence=0; sequence<TOTAL_REQUESTS; sequence++)
+    {
+        uint8_t type = (uint8_t) (sequence % TOTAL_TYPES);
+        uint8_t is_erase = (type==W25Q128FV_RING_REQUEST_ERASE_SECTOR) || (type==W25Q128FV_RING_REQUEST_ERASE_BLOCK_64KB);
+        W25Q128FV_ring_request_t request = {.type = type, .number = sequence, .done = on_done};
+
+        if (!is_erase)
+        {
+            for (uint32_t i=0; i<DATA_SIZE_IN_BYTES; i++)
+            {
+                data[sequence][i] = (uint8_t) (sequence + i);
+            }
+            request.page_bytes_offset = (uint8_t) sequence;
+            request.size = DATA_SIZE_IN_BYTES;
+            request.data = data[sequence];
+        }
+        while (w25q128fv_ring_push(&ring, &request) != W25Q128FV_EC_OK)
+        {
+            total_full++;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *argument)
+{
+    unsigned int seed = 7;
+    uint32_t total_executed = 0;
+
+    (void) argument;
+    while (total_executed < TOTAL_REQUESTS)
+    {
+        uint32_t executed = w25q128fv_ring_drain(&ring, 1 + (uint32_t) rand_r(&seed) % W25Q128FV_RING_SIZE);
+
+        if (executed == 0)
+        {
+            sched_yield();
+        }
+        total_executed += executed;
+    }
+    TEST_CHECK(w25q128fv_ring_drain(&ring, W25Q128FV_RING_SIZE) == 0);
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_t producer_thread;
+    pthread_t consumer_thread;
+    W25Q128FV_ring_request_t unknown_request = {.type = TOTAL_TYPES, .number = 0, .done = NULL};
+
+    w25q128fv_ring_init(&ring);
+    TEST_CHECK(pthread_create(&consumer_thread, NULL, consumer, NULL) == 0);
+    TEST_CHECK(pthread_create(&producer_thread, NULL, producer, NULL) == 0);
+    TEST_CHECK(pthread_join(producer_thread, NULL) == 0);
+    TEST_CHECK(pthread_join(consumer_thread, NULL) == 0);
+    TEST_CHECK(next_expected == TOTAL_REQUESTS);
+    TEST_CHECK(total_done == TOTAL_REQUESTS);
+
+    /* The ring holds exactly W25Q128FV_RING_SIZE requests, and an unknown type is rejected when it is executed. */
+    for (uint32_t i=0; i<W25Q128FV_RING_SIZE; i++)
+    {
+        TEST_CHECK(w25q128fv_ring_push(&ring, &unknown_request) == W25Q128FV_EC_OK);
+    }
+    TEST_CHECK(w25q128fv_ring_push(&ring, &unknown_request) == W25Q128FV_EC_NA);
+    TEST_CHECK(w25q128fv_ring_drain(&ring, W25Q128FV_RING_SIZE) == W25Q128FV_RING_SIZE);
+    TEST_CHECK(w25q128fv_ring_execute(TOTAL_TYPES, 0, 0, 0, NULL) == W25Q128FV_EC_ERR);
+    TEST_CHECK(next_expected == TOTAL_REQUESTS);
+
+    printf("requests=%u, pushes into a full ring=%u\n", TOTAL_REQUESTS, total_full);
+    printf("test_ring_tsan: OK\n");
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+/**@file
+ * @brief	Host test of the W25Q128FV RTOS Port Layer module on top of the CMSIS-RTOS v2 stand-in of POSIX threads.
+ *
+ * @details Several tasks erase, write and read back their own Sectors through the functions of the module, while the
+ *          worker task also executes requests made without waiting for them and drains two rings into which threads
+ *          that play the role of interrupts push writes and a 64KB Block Erase, the second ring being attached while
+ *          all of them already run. The DMA receptions and the interrupt-driven short commands of the W25Q128FV
+ *          Driver module only complete when another thread, which plays the role of the SPI interrupt, completes
+ *          them. The test checks that every request succeeds, that the W25Q128FV Device model holds the data of every
+ *          write and sees no interleaved Instructions, and it is built with ThreadSanitizer so that any access to the
+ *          state of the module that the mutex does not guard is reported.
+ */
+
+#include "flash_model.h"
+#include "w25q128fv_rtos.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TOTAL_TASKS                 (2)
+#define TOTAL_TASK_ITERATIONS       (20)
+#define TASK_DATA_SIZE_IN_BYTES     (1024)
+#define TOTAL_RING_WRITES           (128)
+#define TOTAL_ASYNC_WRITES          (16)
+#define RING_0_FIRST_SECTOR         (400)
+#define RING_1_BLOCK                (26)
+#define TASK_FIRST_SECTOR           (500)
+#define ASYNC_SECTOR                (600)
+
+static W25Q128FV_ring_t rings[2];
+static uint8_t ring_data[2][TOTAL_RING_WRITES][W25Q128FV_PAGE_SIZE_IN_BYTES];
+static uint8_t async_data[TOTAL_ASYNC_WRITES][W25Q128FV_PAGE_SIZE_IN_BYTES];
+static W25Q128FV_rtos_request_t async_requests[TOTAL_ASYNC_WRITES];
+static atomic_int total_ring_done[2];
+static atomic_int total_ring_failures;
+static atomic_int total_async_done;
+static atomic_int total_async_failures;
+static atomic_int total_tasks_done;
+static atomic_int total_task_failures;
+static atomic_int is_spi_interrupt_stopped;
+
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    w25q128fv_rtos_spi_dma_complete_from_isr();
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    w25q128fv_rtos_spi_dma_complete_from_isr();
+}
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    w25q128fv_rtos_spi_dma_complete_from_isr();
+}
+
+static uint32_t get_ring_page(int ring_id, int n)
+{
+    return ((ring_id == 0) ? RING_0_FIRST_SECTOR*W25Q128FV_SECTOR_SIZE_IN_PAGES : RING_1_BLOCK*(W25Q128FV_BLOCK_64KB_SIZE_IN_SECTORS*W25Q128FV_SECTOR_SIZE_IN_PAGES)) + (uint32_t) n;
+}
+
+static void *spi_interrupt(void *argument)
+{
+    (void) argument;
+    while (!atomic_load(&is_spi_interrupt_stopped))
+    {
+        usleep(20);
+        flash_model_complete_dma();
+    }
+    return NULL;
+}
+
+static void on_ring_done(const W25Q128FV_ring_request_t *request, W25Q128FV_Status status)
+{
+    if (status != W25Q128FV_EC_OK)
+    {
+        atomic_fetch_add(&total_ring_failures, 1);
+    }
+    if (request->type == W25Q128FV_RING_REQUEST_WRITE)
+    {
+        atomic_fetch_add(&total_ring_done[request->data[0]], 1);
+    }
+}
+
+static void push_from_isr(int ring_id, const W25Q128FV_ring_request_t *request)
+{
+    while (w25q128fv_rtos_ring_push_from_isr(&rings[ring_id], request) != W25Q128FV_EC_OK)
+    {
+        usleep(50);
+    }
+}
+
+/* Plays the role of an interrupt that is the single producer of a ring. */
+static void *ring_producer(void *argument)
+{
+    int ring_id = (int) (intptr_t) argument;
+
+    if (ring_id == 1)
+    {
+        W25Q128FV_ring_request_t erase_request = {.type = W25Q128FV_RING_REQUEST_ERASE_BLOCK_64KB, .number = RING_1_BLOCK, .done = on_ring_done};
+
+        push_from_isr(ring_id, &erase_request);
+    }
+    for (int n=0; n<TOTAL_RING_WRITES; n++)
+    {
+        W25Q128FV_ring_request_t request = {.type = W25Q128FV_RING_REQUEST_WRITE, .number = get_ring_page(ring_id, n), .size = W25Q128FV_PAGE_SIZE_IN_BYTES, .data = ring_data[ring_id][n], .done = on_ring_done};
+
+        memset(ring_data[ring_id][n], ring_id*TOTAL_RING_WRITES + n, W25Q128FV_PAGE_SIZE_IN_BYTES);
+        ring_data[ring_id][n][0] = (uint8_t) ring_id;
+        push_from_isr(ring_id, &request);
+    }
+    return NULL;
+}
+
+static void task(void *argument)
+{
+    int id = (int) (intptr_t) argument;
+    uint32_t sector = TASK_FIRST_SECTOR + (uint32_t) id;
+    unsigned int seed = (unsigned int) id + 5;
+    static __thread uint8_t written[TASK_DATA_SIZE_IN_BYTES];
+    static __thread uint8_t read[TASK_DATA_SIZE_IN_BYTES];
+
+    for (int iteration=0; iteration<TOTAL_TASK_ITERATIONS; iteration++)
+    {
+        W25Q128FV_Status status;
+
+        for (int i=0; i<TASK_DATA_SIZE_IN_BYTES; i++)
+        {
+            written[i] = (uint8_t) rand_r(&seed);
+        }
+        if ((w25q128fv_rtos_erase_sector(sector) != W25Q128FV_EC_OK)
+            || (w25q128fv_rtos_write_flash_memory(sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, TASK_DATA_SIZE_IN_BYTES, written) != W25Q128FV_EC_OK))
+        {
+            atomic_fetch_add(&total_task_failures, 1);
+        }
+        if ((iteration % 2) == 0)
+        {
+            status = w25q128fv_rtos_read_flash_memory(sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, TASK_DATA_SIZE_IN_BYTES, read);
+        }
+        else
+        {
+            status = w25q128fv_rtos_fast_read_flash_memory(sector*W25Q128FV_SECTOR_SIZE_IN_PAGES, 0, TASK_DATA_SIZE_IN_BYTES, read);
+        }
+        if ((status != W25Q128FV_EC_OK) || (memcmp(read, written, TASK_DATA_SIZE_IN_BYTES) != 0))
+        {
+            atomic_fetch_add(&total_task_failures, 1);
+        }
+    }
+    atomic_fetch_add(&total_tasks_done, 1);
+}
+
+static void on_async_done(W25Q128FV_rtos_request_t *request)
+{
+    if (request->status != W25Q128FV_EC_OK)
+    {
+        atomic_fetch_add(&total_async_failures, 1);
+    }
+    atomic_fetch_add(&total_async_done, 1);
+}
+
+int main(void)
+{
+    pthread_t spi_interrupt_thread;
+    pthread_t producer_threads[2];
+
+    flash_model_init();
+    flash_model_set_deferred_dma(1);
+    TEST_CHECK(pthread_create(&spi_interrupt_thread, NULL, spi_interrupt, NULL) == 0);
+
+    /* Rings can only be attached once the worker task exists. */
+    w25q128fv_ring_init(&rings[0]);
+    w25q128fv_ring_init(&rings[1]);
+    TEST_CHECK(w25q128fv_rtos_attach_ring(&rings[0]) == W25Q128FV_EC_ERR);
+    TEST_CHECK(init_w25q128fv_rtos_module(1) == W25Q128FV_EC_OK);
+    for (uint32_t sector=RING_0_FIRST_SECTOR; sector<RING_0_FIRST_SECTOR+TOTAL_RING_WRITES/W25Q128FV_SECTOR_SIZE_IN_PAGES; sector++)
+    {
+        TEST_CHECK(w25q128fv_rtos_erase_sector(sector) == W25Q128FV_EC_OK);
+    }
+    TEST_CHECK(w25q128fv_rtos_erase_sector(ASYNC_SECTOR) == W25Q128FV_EC_OK);
+
+    TEST_CHECK(w25q128fv_rtos_attach_ring(&rings[0]) == W25Q128FV_EC_OK);
+    TEST_CHECK(pthread_create(&producer_threads[0], NULL, ring_producer, (void *) (intptr_t) 0) == 0);
+    for (int id=0; id<TOTAL_TASKS; id++)
+    {
+        TEST_CHECK(osThreadNew(task, (void *) (intptr_t) id, NULL) != NULL);
+    }
+    for (int n=0; n<TOTAL_ASYNC_WRITES; n++)
+    {
+        memset(async_data[n], 0xA0 + n, W25Q128FV_PAGE_SIZE_IN_BYTES);
+        async_requests[n] = (W25Q128FV_rtos_request_t) {.type = W25Q128FV_RTOS_REQUEST_WRITE, .number = ASYNC_SECTOR*W25Q128FV_SECTOR_SIZE_IN_PAGES + (uint32_t) n, .page_bytes_offset = 0,
+                                                        .size = W25Q128FV_PAGE_SIZE_IN_BYTES, .data = async_data[n], .callback = on_async_done};
+        TEST_CHECK(w25q128fv_rtos_submit(&async_requests[n]) == W25Q128FV_EC_OK);
+    }
+
+    /* The second ring is attached while the worker task is already draining the first one. */
+    TEST_CHECK(w25q128fv_rtos_attach_ring(&rings[1]) == W25Q128FV_EC_OK);
+    TEST_CHECK(pthread_create(&producer_threads[1], NULL, ring_producer, (void *) (intptr_t) 1) == 0);
+
+    for (int id=0; id<2; id++)
+    {
+        TEST_CHECK(pthread_join(producer_threads[id], NULL) == 0);
+    }
+    while ((atomic_load(&total_ring_done[0]) < TOTAL_RING_WRITES) || (atomic_load(&total_ring_done[1]) < TOTAL_RING_WRITES)
+           || (atomic_load(&total_async_done) < TOTAL_ASYNC_WRITES) || (atomic_load(&total_tasks_done) < TOTAL_TASKS))
+    {
+        usleep(1000);
+    }
+
+    TEST_CHECK(w25q128fv_rtos_lock() == W25Q128FV_EC_OK);
+    for (int id=0; id<2; id++)
+    {
+        for (int n=0; n<TOTAL_RING_WRITES; n++)
+        {
+            TEST_CHECK(memcmp(&flash_model_memory[get_ring_page(id, n)*W25Q128FV_PAGE_SIZE_IN_BYTES], ring_data[id][n], W25Q128FV_PAGE_SIZE_IN_BYTES) == 0);
+        }
+    }
+    for (int n=0; n<TOTAL_ASYNC_WRITES; n++)
+    {
+        TEST_CHECK(memcmp(&flash_model_memory[(ASYNC_SECTOR*W25Q128FV_SECTOR_SIZE_IN_PAGES + n)*W25Q128FV_PAGE_SIZE_IN_BYTES], async_data[n], W25Q128FV_PAGE_SIZE_IN_BYTES) == 0);
+    }
+    TEST_CHECK(w25q128fv_rtos_unlock() == W25Q128FV_EC_OK);
+    atomic_store(&is_spi_interrupt_stopped, 1);
+    TEST_CHECK(pthread_join(spi_interrupt_thread, NULL) == 0);
+
+    printf("ring failures=%d, async failures=%d, task failures=%d, violations=%lu\n", atomic_load(&total_ring_failures),
+           atomic_load(&total_async_failures), atomic_load(&total_task_failures), flash_model_get_violations());
+    TEST_CHECK(atomic_load(&total_ring_failures) == 0);
+    TEST_CHECK(atomic_load(&total_async_failures) == 0);
+    TEST_CHECK(atomic_load(&total_task_failures) == 0);
+    TEST_CHECK(flash_model_get_violations() == 0);
+    printf("test_rtos_pthreads: OK\n");
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""Builds the read-only asset packs that the W25Q128FV Asset Pack module reads.
+
+Every file under the given directory becomes an asset named after its path relative to that directory (e.g.,
+"fonts/small.bin"). The resulting binary file is meant to be written, as it is, into the W25Q128FV Flash Memory Device
+at any address, which is then given to w25q128fv_assets_mount(). See Inc/w25q128fv_assets.h for the layout of the asset
+pack, which this tool must keep in sync with.
+
+The directory is indexed by a minimal perfect hash built via the hash-and-displace method: the names are distributed
+into buckets and, from the bucket with the most names to the one with the least, a seed is searched for each bucket
+such that all of its names land into distinct free entries of the directory.
+
+Unless -n is given, every asset is split into blocks of 4096 bytes that are compressed independently of each other in
+the LZ4 block format, and it is stored that way if its payload gets smaller. Blocks that do not get smaller are stored
+as they are.
+
+Usage:
+    python3 w25q128fv_asset_pack.py [-a ALIGNMENT] [-b NAMES_PER_BUCKET] [-m MAX_BUCKETS] [-n] -o OUTPUT DIRECTORY
+
+@author Cesar Miranda Meza (cmirandameza3@hotmail.com)
+@date   October 17, 2026.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4B504157              # "WAPK" in little endian.
+HEADER_SIZE = 32
+ENTRY_SIZE = 64
+MAX_NAME_SIZE = 48              # Includes the null terminator.
+MAX_SEED = 0xFFFF
+FLASH_SIZE = 4085 * 4096        # W25Q128FV_TOTAL_SECTORS Sectors of 4096 bytes.
+BLOCK_SIZE = 4096
+FLAG_COMPRESSED = 0x00000001
+
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5           # The last 5 bytes of a block are always literals.
+LZ4_MATCH_FIND_LIMIT = 12       # No match starts within the last 12 bytes of a block.
+
+FNV_OFFSET_BASIS = 0x811C9DC5
+FNV_PRIME = 0x01000193
+SEED_MULTIPLIER = 0x9E3779B9
+
+
+def hash_name(name, seed):
+    """Returns the very same hash that hash_name() of Src/w25q128fv_assets.c calculates."""
+    h = FNV_OFFSET_BASIS ^ ((seed * SEED_MULTIPLIER) & 0xFFFFFFFF)
+    for c in name:
+        h ^= c
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def build_perfect_hash(names, total_buckets):
+    """Returns the seed of each bucket and the name of each entry of the directory."""
+    total_entries = len(names)
+    buckets = [[] for _ in range(total_buckets)]
+    for name in names:
+        buckets[hash_name(name, 0) % total_buckets].append(name)
+
+    seeds = [0] * total_buckets
+    entries = [None] * total_entries
+    for bucket in sorted(range(total_buckets), key=lambda b: len(buckets[b]), reverse=True):
+        if not buckets[bucket]:
+            break
+        for seed in range(1, MAX_SEED + 1):
+            indexes = [hash_name(name, seed) % total_entries for name in buckets[bucket]]
+            if len(set(indexes)) == len(indexes) and all(entries[i] is None for i in indexes):
+                break
+        else:
+            raise RuntimeError("no seed was found for a bucket; use more buckets via -b")
+        seeds[bucket] = seed
+        for name, index in zip(buckets[bucket], indexes):
+            entries[index] = name
+    return seeds, entries
+
+
+def lz4_length(length):
+    """Returns the extra bytes of a literal or match length that does not fit into a nibble of the token."""
+    out = bytearray()
+    length -= 15
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+    return bytes(out)
+
+
+def lz4_compress_block(src):
+    """Compresses a block in the LZ4 block format via a greedy search of 4-byte matches."""
+    out = bytearray()
+    anchor = 0
+    i = 0
+    last_match_start = len(src) - LZ4_MATCH_FIND_LIMIT
+    table = {}
+
+    def emit(literals, match_length, offset):
+        lit_nibble = min(len(literals), 15)
+        match_nibble = 0 if match_length is None else min(match_length - LZ4_MIN_MATCH, 15)
+        out.append((lit_nibble << 4) | match_nibble)
+        if lit_nibble == 15:
+            out.extend(lz4_length(len(literals)))
+        out.extend(literals)
+        if match_length is not None:
+            out.extend(struct.pack("<H", offset))
+            if match_nibble == 15:
+                out.extend(lz4_length(match_length - LZ4_MIN_MATCH))
+
+    while i <= last_match_start:
+        key = src[i:i + LZ4_MIN_MATCH]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None:
+            i += 1
+            continue
+        length = LZ4_MIN_MATCH
+        while i + length < len(src) - LZ4_LAST_LITERALS and src[candidate + length] == src[i + length]:
+            length += 1
+        emit(src[anchor:i], length, i - candidate)
+        i += length
+        anchor = i
+    emit(src[anchor:], None, 0)
+    return bytes(out)
+
+
+def compress_payload(data):
+    """Returns the block table followed by the blocks of the compressed payload of an asset."""
+    blocks = []
+    for start in range(0, len(data), BLOCK_SIZE):
+        block = data[start:start + BLOCK_SIZE]
+        compressed = lz4_compress_block(block)
+        blocks.append(compressed if len(compressed) < len(block) else block)
+    offset = 4 * (len(blocks) + 1)
+    table = []
+    for block in blocks:
+        table.append(offset)
+        offset += len(block)
+    table.append(offset)
+    return struct.pack("<%dI" % len(table), *table) + b"".join(blocks)
+
+
+def align(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def build_pack(assets, alignment, names_per_bucket, max_buckets, compress=True):
+    """Returns the asset pack of the given dictionary of names (as bytes) to data."""
+    for name in assets:
+        if not name or len(name) >= MAX_NAME_SIZE or b"\0" in name:
+            raise ValueError("invalid asset name: %r" % name)
+
+    total_assets = len(assets)
+    total_buckets = (total_assets + names_per_bucket - 1) // names_per_bucket
+    if total_buckets > max_buckets:
+        raise ValueError("%d buckets exceed the maximum of %d; raise -b or W25Q128FV_ASSETS_MAX_BUCKETS" % (total_buckets, max_buckets))
+    seeds, entries = build_perfect_hash(sorted(assets), total_buckets)
+
+    directory_offset = align(HEADER_SIZE + 2 * total_buckets, ENTRY_SIZE)
+    offset = align(directory_offset + ENTRY_SIZE * total_assets, alignment)
+    directory = b""
+    payloads = b""
+    for name in entries:
+        data = assets[name]
+        payload = data
+        flags = 0
+        if compress and data:
+            compressed = compress_payload(data)
+            if len(compressed) < len(data):
+                payload = compressed
+                flags = FLAG_COMPRESSED
+        payloads += b"\xFF" * (offset - directory_offset - ENTRY_SIZE * total_assets - len(payloads))
+        directory += struct.pack("<%dsIIII" % MAX_NAME_SIZE, name, offset, len(data), zlib.crc32(data), flags)
+        payloads += payload
+        offset = align(offset + len(payload), alignment)
+    size_in_bytes = directory_offset + len(directory) + len(payloads)
+
+    fields = struct.pack("<IIIIII", total_assets, total_buckets, directory_offset, alignment, size_in_bytes, 0)
+    fields += struct.pack("<%dH" % total_buckets, *seeds)
+    header = struct.pack("<II", MAGIC, zlib.crc32(fields)) + fields
+    header += b"\xFF" * (directory_offset - len(header))
+    return header + directory + payloads
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Builds a W25Q128FV asset pack from the files of a directory.")
+    parser.add_argument("directory", help="directory whose files, named after their relative path, are packed")
+    parser.add_argument("-o", "--output", required=True, help="asset pack binary file to be created")
+    parser.add_argument("-a", "--alignment", type=int, default=256, help="alignment in bytes of the payloads (default: 256, i.e., a Page)")
+    parser.add_argument("-b", "--names-per-bucket", type=int, default=4, help="average number of names per bucket (default: 4)")
+    parser.add_argument("-m", "--max-buckets", type=int, default=256, help="W25Q128FV_ASSETS_MAX_BUCKETS of the firmware (default: 256)")
+    parser.add_argument("-n", "--no-compression", action="store_true", help="store every asset uncompressed")
+    args = parser.parse_args()
+    if args.alignment < 1 or args.names_per_bucket < 1:
+        parser.error("the alignment and the names per bucket must be positive")
+
+    assets = {}
+    for root, _, files in os.walk(args.directory):
+        for file in files:
+            path = os.path.join(root, file)
+            name = os.path.relpath(path, args.directory).replace(os.sep, "/").encode("utf-8")
+            with open(path, "rb") as f:
+                assets[name] = f.read()
+
+    try:
+        pack = build_pack(assets, args.alignment, args.names_per_bucket, args.max_buckets, not args.no_compression)
+    except (ValueError, RuntimeError) as e:
+        sys.exit("error: %s" % e)
+    if len(pack) > FLASH_SIZE:
+        sys.exit("error: the asset pack of %d bytes does not fit into the W25Q128FV Device" % len(pack))
+    with open(args.output, "wb") as f:
+        f.write(pack)
+    print("%d assets, %d bytes (%d bytes uncompressed)" % (len(assets), len(pack), sum(len(data) for data in assets.values())))
+
+
+if __name__ == "__main__":
+    main()